@@ -261,6 +261,11 @@ class BuildingTypeClass : public TechnoTypeClass {
 		void const * BuildupData;
 
 		void Init_Anim(BStateType state, int start, int count, int rate) const;
+
+		/*
+		**	The compiled rules image keeps the buildup art when it restores a building type.
+		*/
+		friend class RulesClass;
 };
 
 #endif // BUILDINGTYPECLASS_H
\ No newline at end of file
@@ -2,6 +2,7 @@
 #define FIXEDHEAPCLASS_H
 
 #include "BooleanVectorClass.h"
+#include "DynamicVectorClass.h"
 
 /**************************************************************************
 **	This is a block memory management handler. It is used when memory is to
@@ -13,6 +14,12 @@
 class FixedHeapClass
 {
 	public:
+		/*
+		**	A heap never grows past this many sub-blocks. Loading relies on this to reject
+		**	sub-block indices that no heap could have reached.
+		*/
+		enum {GROWTH_LIMIT=0x10000};
+
 		FixedHeapClass(int size);
 		virtual ~FixedHeapClass(void);
 
@@ -27,8 +34,14 @@ class FixedHeapClass
 		virtual int Free(void * pointer);
 		virtual int Free_All(void);
 
-		void * operator[](int index) {return ((char *)Buffer) + (index * Size);};
-		void const * operator[](int index) const {return ((char *)Buffer) + (index * Size);};
+		// Set number of sub-blocks the heap grows by when it fills up (only before it has grown).
+		int Set_Growth_Step(int step) {if (Segments.Count() == 0) GrowthStep = step;return(GrowthStep);};
+
+		// Fetch current growth step.
+		int Growth_Step(void) const {return(GrowthStep);};
+
+		void * operator[](int index) {return((index < BufferCount) ? ((char *)Buffer) + (index * Size) : Segment_Ptr(index));};
+		void const * operator[](int index) const {return((index < BufferCount) ? ((char *)Buffer) + (index * Size) : Segment_Ptr(index));};
 
 	protected:
 		/*
@@ -63,7 +76,26 @@ class FixedHeapClass
 		*/
 		BooleanVectorClass FreeFlag;
 
+		/*
+		**	When all the sub-blocks are in use, the heap will grow by this many
+		**	more. A growth step of zero means the heap never grows.
+		*/
+		int GrowthStep;
+
+		/*
+		**	This is the number of sub-blocks in the heap's first memory buffer.
+		**	Any sub-blocks past these are in the extra buffers that were added as
+		**	the heap grew, each holding a growth step's worth. The buffers are
+		**	never moved, so pointers to the sub-blocks remain valid.
+		*/
+		int BufferCount;
+		DynamicVectorClass<void *> Segments;
+
+		virtual int Grow(void);
+
 	private:
+		char * Segment_Ptr(int index) const;
+
 		// The assignment operator is not supported.
 		FixedHeapClass & operator = (FixedHeapClass const &);
 
@@ -258,6 +258,8 @@ class TechnoTypeClass : public ObjectTypeClass
 
 		bool Is_Two_Shooter(void) const;
 		int Legal_Placement(CELL pos) const;
+		int Legal_Placement(CELL pos, unsigned char const * clear) const;
+		bool Is_Clear_Foundation(CELL cell) const;
 		virtual int Raw_Cost(void) const;
 		virtual int Max_Passengers(void) const {return(MaxPassengers);}
 		virtual int Repair_Cost(void) const;
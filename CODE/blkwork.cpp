@@ -0,0 +1,276 @@
+/*
+**	Command & Conquer Red Alert(tm)
+**	Copyright 2025 Electronic Arts Inc.
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/***********************************************************************************************
+ *                                                                                             *
+ *                 Project Name : Command & Conquer                                            *
+ *                                                                                             *
+ *                    File Name : BLKWORK.CPP                                                  *
+ *                                                                                             *
+ *                   Start Date : 10/19/26                                                     *
+ *                                                                                             *
+ *                  Last Update : October 19, 2026                                             *
+ *                                                                                             *
+ *---------------------------------------------------------------------------------------------*
+ * Functions:                                                                                  *
+ *   BlockWorkClass::Process -- Compress or decompress a batch of blocks.                      *
+ *   BlockWorkClass::Process_Job -- Compress or decompress one block.                          *
+ *   BlockWorkClass::Thread_Count -- Fetch the number of threads that work on a batch.         *
+ *   Worker_Thread -- Worker thread; takes blocks from the current batch.                      *
+ * - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+#include	"blkwork.h"
+#include	"lzo.h"
+#include	"lcw.h"
+#include	<string.h>
+#include	<thread>
+#include	<mutex>
+#include	<condition_variable>
+
+
+/*
+**	Most worker threads that will be started, not counting the caller.
+*/
+#define	MAX_BLOCK_WORKERS		7
+
+/*
+**	Size of the dictionary that LZO compression works with.
+*/
+#define	LZO_WORK_SIZE			(16*1024 * sizeof(void *))
+
+
+/*
+**	The state shared by the caller and the worker threads. Only one batch is worked on at a
+**	time; the batch lock holds off any other caller until it is done.
+*/
+static struct BlockPoolType {
+	BlockPoolType(void) : Jobs(0), JobCount(0), NextJob(0), Finished(0), Batch(0), IsQuitting(false), WorkerCount(-1) {}
+	~BlockPoolType(void);
+
+	std::mutex BatchLock;
+	std::mutex Lock;
+	std::condition_variable WorkReady;
+	std::condition_variable WorkDone;
+
+	BlockJobType * Jobs;
+	int JobCount;
+	int NextJob;
+	int Finished;
+	unsigned Batch;
+	bool IsQuitting;
+
+	int WorkerCount;
+	std::thread Workers[MAX_BLOCK_WORKERS];
+} BlockPool;
+
+
+/*
+**	Work memory for blocks compressed on the calling thread.
+*/
+static char CallerWorkMem[LZO_WORK_SIZE];
+
+
+/*
+**	Stop the workers when the program shuts down.
+*/
+BlockPoolType::~BlockPoolType(void)
+{
+	{
+		std::lock_guard<std::mutex> lock(Lock);
+		IsQuitting = true;
+	}
+	WorkReady.notify_all();
+	for (int index = 0; index < MAX_BLOCK_WORKERS; index++) {
+		if (Workers[index].joinable()) {
+			Workers[index].join();
+		}
+	}
+}
+
+
+/***********************************************************************************************
+ * Worker_Thread -- Worker thread; takes blocks from the current batch.                        *
+ *                                                                                             *
+ *    Each worker waits for a new batch, then takes blocks from it one at a time until there   *
+ *    are none left to start. The last block to finish wakes up the caller.                    *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+static void Worker_Thread(void)
+{
+	char * workmem = new char [LZO_WORK_SIZE];
+	unsigned batch = 0;
+
+	std::unique_lock<std::mutex> lock(BlockPool.Lock);
+	for (;;) {
+		while (!BlockPool.IsQuitting && BlockPool.Batch == batch) {
+			BlockPool.WorkReady.wait(lock);
+		}
+		if (BlockPool.IsQuitting) break;
+		batch = BlockPool.Batch;
+
+		while (BlockPool.NextJob < BlockPool.JobCount) {
+			BlockJobType & job = BlockPool.Jobs[BlockPool.NextJob++];
+			lock.unlock();
+			BlockWorkClass::Process_Job(job, workmem);
+			lock.lock();
+			if (++BlockPool.Finished == BlockPool.JobCount) {
+				BlockPool.WorkDone.notify_one();
+			}
+		}
+	}
+	lock.unlock();
+
+	delete [] workmem;
+}
+
+
+/***********************************************************************************************
+ * BlockWorkClass::Thread_Count -- Fetch the number of threads that work on a batch.           *
+ *                                                                                             *
+ *    The worker threads are started the first time this is called. There is one for each      *
+ *    processor after the first, since the caller works on every batch too.                    *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  Returns with the number of threads, including the caller.                          *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+int BlockWorkClass::Thread_Count(void)
+{
+	std::lock_guard<std::mutex> lock(BlockPool.BatchLock);
+
+	if (BlockPool.WorkerCount < 0) {
+		int workers = (int)std::thread::hardware_concurrency() - 1;
+		if (workers < 0) workers = 0;
+		if (workers > MAX_BLOCK_WORKERS) workers = MAX_BLOCK_WORKERS;
+
+		BlockPool.WorkerCount = 0;
+		for (int index = 0; index < workers; index++) {
+			BlockPool.Workers[index] = std::thread(Worker_Thread);
+			BlockPool.WorkerCount++;
+		}
+	}
+	return(BlockPool.WorkerCount + 1);
+}
+
+
+/***********************************************************************************************
+ * BlockWorkClass::Process_Job -- Compress or decompress one block.                            *
+ *                                                                                             *
+ *    The LZO dictionary is cleared first. LZO will otherwise take matches from whatever was   *
+ *    left in it, and the same data would not always compress to the same bytes.               *
+ *                                                                                             *
+ * INPUT:   job      -- Reference to the block to process.                                     *
+ *                                                                                             *
+ *          workmem  -- Work memory for LZO compression, private to the calling thread.        *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   When decompressing, the destination must be large enough for the whole block.   *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+void BlockWorkClass::Process_Job(BlockJobType & job, void * workmem)
+{
+	if (job.Codec == CODEC_LZO) {
+		unsigned int length = job.DestLength;
+		if (job.IsCompress) {
+			memset(workmem, 0, LZO_WORK_SIZE);
+			lzo1x_1_compress((unsigned char *)job.Source, job.SourceLength, (unsigned char *)job.Dest, &length, workmem);
+		} else {
+			lzo1x_decompress((unsigned char *)job.Source, job.SourceLength, (unsigned char *)job.Dest, &length, NULL);
+		}
+		job.Result = length;
+	} else {
+		if (job.IsCompress) {
+			job.Result = LCW_Comp(job.Source, job.Dest, job.SourceLength);
+		} else {
+			job.Result = LCW_Uncomp(job.Source, job.Dest, job.DestLength);
+		}
+	}
+}
+
+
+/***********************************************************************************************
+ * BlockWorkClass::Process -- Compress or decompress a batch of blocks.                        *
+ *                                                                                             *
+ *    The blocks are handed out to the worker threads and to the caller in order. This         *
+ *    returns once all of them are done, so the results can be used in any order.              *
+ *                                                                                             *
+ * INPUT:   jobs     -- Pointer to the array of blocks to process.                             *
+ *                                                                                             *
+ *          count    -- The number of blocks in the array.                                     *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   Blocks must not share destination buffers.                                      *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+void BlockWorkClass::Process(BlockJobType * jobs, int count)
+{
+	if (count < 1) return;
+
+	/*
+	**	A single block, or no workers to share with, is done right here.
+	*/
+	if (count == 1 || Thread_Count() == 1) {
+		std::lock_guard<std::mutex> batchlock(BlockPool.BatchLock);
+		for (int index = 0; index < count; index++) {
+			Process_Job(jobs[index], CallerWorkMem);
+		}
+		return;
+	}
+
+	std::lock_guard<std::mutex> batchlock(BlockPool.BatchLock);
+	std::unique_lock<std::mutex> lock(BlockPool.Lock);
+	BlockPool.Jobs = jobs;
+	BlockPool.JobCount = count;
+	BlockPool.NextJob = 0;
+	BlockPool.Finished = 0;
+	BlockPool.Batch++;
+	BlockPool.WorkReady.notify_all();
+
+	while (BlockPool.NextJob < count) {
+		BlockJobType & job = jobs[BlockPool.NextJob++];
+		lock.unlock();
+		Process_Job(job, CallerWorkMem);
+		lock.lock();
+		BlockPool.Finished++;
+	}
+
+	while (BlockPool.Finished < count) {
+		BlockPool.WorkDone.wait(lock);
+	}
+	BlockPool.Jobs = NULL;
+	BlockPool.JobCount = 0;
+}
@@ -0,0 +1,83 @@
+/*
+**	Command & Conquer Red Alert(tm)
+**	Copyright 2025 Electronic Arts Inc.
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/***********************************************************************************************
+ *                                                                                             *
+ *                 Project Name : Command & Conquer                                            *
+ *                                                                                             *
+ *                    File Name : BLKWORK.H                                                    *
+ *                                                                                             *
+ *                   Start Date : 10/19/26                                                     *
+ *                                                                                             *
+ *                  Last Update : October 19, 2026                                             *
+ *                                                                                             *
+ *---------------------------------------------------------------------------------------------*
+ * Functions:                                                                                  *
+ * - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+#ifndef BLKWORK_H
+#define BLKWORK_H
+
+
+/*
+**	The block compressors that the parallel pipe and straw can use. Both store each block
+**	behind the same {CompCount, UncompCount} header as LZOPipe and LCWPipe, so the data
+**	is interchangeable with those classes.
+*/
+typedef enum BlockCodecType {
+	CODEC_LZO,
+	CODEC_LCW
+} BlockCodecType;
+
+
+/*
+**	One block to be compressed or decompressed. The caller fills in everything but the
+**	result count, which the worker sets to the number of bytes stored at the destination.
+*/
+typedef struct BlockJobType {
+	BlockCodecType Codec;
+	bool IsCompress;
+	char const * Source;
+	int SourceLength;
+	char * Dest;
+	int DestLength;
+	int Result;
+} BlockJobType;
+
+
+/*
+**	This is a small pool of worker threads that compresses or decompresses a batch of
+**	independent blocks. The calling thread works on the batch too, and does not return
+**	until every block in it is done. With only one processor there are no workers, and
+**	the batch is just processed in order by the caller.
+*/
+class BlockWorkClass
+{
+	public:
+		/*
+		**	Largest number of bytes that compressing a block of the given size may produce.
+		*/
+		static int Compress_Bound(int length) {return(length + length/16 + 64 + 3);}
+
+		static int Thread_Count(void);
+		static void Process(BlockJobType * jobs, int count);
+		static void Process_Job(BlockJobType & job, void * workmem);
+};
+
+
+#endif
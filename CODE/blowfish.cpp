@@ -36,6 +36,7 @@
  *   BlowfishEngine::Decrypt -- Decrypts data using blowfish algorithm.                        *
  *   BlowfishEngine::Encrypt -- Encrypt an arbitrary block of data.                            *
  *   BlowfishEngine::Process_Block -- Process a block of data using Blowfish algorithm.        *
+ *   BlowfishEngine::Process_Blocks -- Process a run of blocks with their rounds interleaved.  *
  *   BlowfishEngine::Sub_Key_Encrypt -- Encrypts a block for use in S-Box processing.          *
  *   BlowfishEngine::Submit_Key -- Submit a key that will allow data processing.               *
  *   BlowfishEngine::~BlowfishEngine -- Destructor for the Blowfish engine.                    *
@@ -64,6 +65,24 @@ typedef union {
 } Int;
 
 
+/*
+**	Fetch and store a long integer in big endian byte order, regardless of the endian
+**	persuasion of the current processor. Only the low 32 bits are stored.
+*/
+static inline unsigned long Fetch_Long(unsigned char const * ptr)
+{
+	return(((unsigned long)ptr[0] << 24) | ((unsigned long)ptr[1] << 16) | ((unsigned long)ptr[2] << 8) | ptr[3]);
+}
+
+static inline void Store_Long(unsigned char * ptr, unsigned long value)
+{
+	ptr[0] = (unsigned char)(value >> 24);
+	ptr[1] = (unsigned char)(value >> 16);
+	ptr[2] = (unsigned char)(value >> 8);
+	ptr[3] = (unsigned char)value;
+}
+
+
 /***********************************************************************************************
  * BlowfishEngine::~BlowfishEngine -- Destructor for the Blowfish engine.                      *
  *                                                                                             *
@@ -228,12 +247,10 @@ int BlowfishEngine::Encrypt(void const * plaintext, int length, void * cyphertex
 		/*
 		**	Process the buffer in 64 bit chunks.
 		*/
-		for (int index = 0; index < blocks; index++) {
-			Process_Block(plaintext, cyphertext, P_Encrypt);
-			plaintext = ((char *)plaintext) + BYTES_PER_BLOCK;
-			cyphertext = ((char *)cyphertext) + BYTES_PER_BLOCK;
-		}
+		Process_Blocks(plaintext, cyphertext, blocks, P_Encrypt);
 		int encrypted = blocks * BYTES_PER_BLOCK;
+		plaintext = ((char *)plaintext) + encrypted;
+		cyphertext = ((char *)cyphertext) + encrypted;
 
 		/*
 		**	Copy over any trailing left over appendix bytes.
@@ -294,12 +311,10 @@ int BlowfishEngine::Decrypt(void const * cyphertext, int length, void * plaintex
 		/*
 		**	Process the buffer in 64 bit chunks.
 		*/
-		for (int index = 0; index < blocks; index++) {
-			Process_Block(cyphertext, plaintext, P_Decrypt);
-			cyphertext = ((char *)cyphertext) + BYTES_PER_BLOCK;
-			plaintext = ((char *)plaintext) + BYTES_PER_BLOCK;
-		}
+		Process_Blocks(cyphertext, plaintext, blocks, P_Decrypt);
 		int encrypted = blocks * BYTES_PER_BLOCK;
+		cyphertext = ((char *)cyphertext) + encrypted;
+		plaintext = ((char *)plaintext) + encrypted;
 
 		/*
 		**	Copy over any trailing left over appendix bytes.
@@ -407,6 +422,105 @@ void BlowfishEngine::Process_Block(void const * plaintext, void * cyphertext, un
 }
 
 
+/***********************************************************************************************
+ * BlowfishEngine::Process_Blocks -- Process a run of blocks with their rounds interleaved.    *
+ *                                                                                             *
+ *    Each round of a block depends on the one before it, so a single block keeps the          *
+ *    processor waiting on one S-Box fetch after another. The blocks are independent of each   *
+ *    other though, so the rounds of several blocks are done side by side here to keep more    *
+ *    fetches in flight at once. The result is exactly the same as processing the blocks one   *
+ *    at a time with Process_Block.                                                            *
+ *                                                                                             *
+ * INPUT:   plaintext   -- Pointer to the source blocks (it actually might be a pointer to     *
+ *                         the cyphertext if this is called as a decryption process).          *
+ *                                                                                             *
+ *          cyphertext  -- Pointer to the output buffer that will hold the processed blocks.   *
+ *                         This may be the same as the source buffer.                          *
+ *                                                                                             *
+ *          blocks      -- The number of 8 byte blocks to process.                             *
+ *                                                                                             *
+ *          ptable      -- Pointer to the permutation table to use.                            *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+void BlowfishEngine::Process_Blocks(void const * plaintext, void * cyphertext, int blocks, unsigned long const * ptable)
+{
+	unsigned char const * source = (unsigned char const *)plaintext;
+	unsigned char * out = (unsigned char *)cyphertext;
+
+	while (blocks >= BLOCKS_PER_BATCH) {
+
+		/*
+		**	Input the halves of each block in big endian order, the same as
+		**	Process_Block does. All the source blocks are read before any output
+		**	is written so that the data may be processed in place.
+		*/
+		unsigned long left0 = Fetch_Long(&source[0]);
+		unsigned long right0 = Fetch_Long(&source[4]);
+		unsigned long left1 = Fetch_Long(&source[8]);
+		unsigned long right1 = Fetch_Long(&source[12]);
+		unsigned long left2 = Fetch_Long(&source[16]);
+		unsigned long right2 = Fetch_Long(&source[20]);
+		unsigned long left3 = Fetch_Long(&source[24]);
+		unsigned long right3 = Fetch_Long(&source[28]);
+
+		/*
+		**	Perform the Feistal rounds on all the blocks in step. Only the low
+		**	32 bits of each half are significant, so the round function masks
+		**	off anything carried above them.
+		*/
+		for (int index = 0; index < ROUNDS; index += 2) {
+			unsigned long p0 = ptable[index];
+			unsigned long p1 = ptable[index+1];
+
+			left0 ^= p0;
+			left1 ^= p0;
+			left2 ^= p0;
+			left3 ^= p0;
+			right0 ^= Round_Function(left0) ^ p1;
+			right1 ^= Round_Function(left1) ^ p1;
+			right2 ^= Round_Function(left2) ^ p1;
+			right3 ^= Round_Function(left3) ^ p1;
+			left0 ^= Round_Function(right0);
+			left1 ^= Round_Function(right1);
+			left2 ^= Round_Function(right2);
+			left3 ^= Round_Function(right3);
+		}
+
+		/*
+		**	Fold in the final two longs of the permutation table and output the
+		**	blocks right half first, as Process_Block does.
+		*/
+		Store_Long(&out[0], right0 ^ ptable[ROUNDS+1]);
+		Store_Long(&out[4], left0 ^ ptable[ROUNDS]);
+		Store_Long(&out[8], right1 ^ ptable[ROUNDS+1]);
+		Store_Long(&out[12], left1 ^ ptable[ROUNDS]);
+		Store_Long(&out[16], right2 ^ ptable[ROUNDS+1]);
+		Store_Long(&out[20], left2 ^ ptable[ROUNDS]);
+		Store_Long(&out[24], right3 ^ ptable[ROUNDS+1]);
+		Store_Long(&out[28], left3 ^ ptable[ROUNDS]);
+
+		source += BLOCKS_PER_BATCH * BYTES_PER_BLOCK;
+		out += BLOCKS_PER_BATCH * BYTES_PER_BLOCK;
+		blocks -= BLOCKS_PER_BATCH;
+	}
+
+	/*
+	**	Any blocks left over are too few to interleave.
+	*/
+	while (blocks > 0) {
+		Process_Block(source, out, ptable);
+		source += BYTES_PER_BLOCK;
+		out += BYTES_PER_BLOCK;
+		blocks--;
+	}
+}
+
 /***********************************************************************************************
  * BlowfishEngine::Sub_Key_Encrypt -- Encrypts a block for use in S-Box processing.            *
  *                                                                                             *
@@ -73,11 +73,16 @@ class BlowfishEngine {
 		void Sub_Key_Encrypt(unsigned long & left, unsigned long & right);
 
 		void Process_Block(void const * plaintext, void * cyphertext, unsigned long const * ptable);
+		void Process_Blocks(void const * plaintext, void * cyphertext, int blocks, unsigned long const * ptable);
+		unsigned long Round_Function(unsigned long half) const {
+			return(((bf_S[0][(half >> 24) & 0xFF] + bf_S[1][(half >> 16) & 0xFF]) ^ bf_S[2][(half >> 8) & 0xFF]) + bf_S[3][half & 0xFF]);
+		}
 		void Initialize_Tables(void);
 
 		enum {
 			ROUNDS = 16,		// Feistal round count (16 is standard).
-			BYTES_PER_BLOCK=8	// The number of bytes in each cypher block (don't change).
+			BYTES_PER_BLOCK=8,	// The number of bytes in each cypher block (don't change).
+			BLOCKS_PER_BATCH=4	// The number of blocks whose rounds are interleaved (don't change).
 		};
 
 		/*
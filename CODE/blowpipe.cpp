@@ -44,6 +44,13 @@
 #include	<assert.h>
 
 
+/*
+**	Most bytes of whole blocks that are processed at once when they have to be gathered up
+**	before being sent on.
+*/
+#define	BLOWPIPE_STAGING_SIZE		1024
+
+
 /***********************************************************************************************
  * BlowPipe::Flush -- Flushes any pending data out the pipe.                                   *
  *                                                                                             *
@@ -132,18 +139,39 @@ int BlowPipe::Put(void const * source, int slen)
 	}
 
 	/*
-	**	Process the input data in blocks until there is not enough
-	**	source data to fill a full block of data.
+	**	Process the input data in runs of whole blocks until there is not enough
+	**	source data to fill a full block of data. If the next pipe segment has
+	**	room to write into, the blocks are processed right into it. Otherwise
+	**	they are gathered into a staging buffer so that they can be sent on
+	**	together.
 	*/
-	while (slen >= sizeof(Buffer)) {
+	while (slen >= (int)sizeof(Buffer)) {
+		char staging[BLOWPIPE_STAGING_SIZE];
+		int len = (slen < (int)sizeof(staging)) ? slen : (int)sizeof(staging);
+		len -= len % sizeof(Buffer);
+
+		void * dest = NULL;
+		int room = (ChainTo != NULL) ? ChainTo->Reserve(dest, len) : 0;
+		room -= room % sizeof(Buffer);
+		if (room > 0) {
+			len = room;
+		} else {
+			dest = staging;
+		}
+
 		if (Control == DECRYPT) {
-			BF->Decrypt(source, sizeof(Buffer), Buffer);
+			BF->Decrypt(source, len, dest);
+		} else {
+			BF->Encrypt(source, len, dest);
+		}
+
+		if (room > 0) {
+			total += ChainTo->Commit(len);
 		} else {
-			BF->Encrypt(source, sizeof(Buffer), Buffer);
+			total += Pipe::Put(staging, len);
 		}
-		total += Pipe::Put(Buffer, sizeof(Buffer));
-		source = ((char *)source) + sizeof(Buffer);
-		slen -= sizeof(Buffer);
+		source = ((char *)source) + len;
+		slen -= len;
 	}
 
 	/*
@@ -33,8 +33,10 @@
  *                                                                                             *
  *---------------------------------------------------------------------------------------------*
  * Functions:                                                                                  *
+ *   BlowStraw::Consume -- Remove data that was looked at through Peek.                        *
  *   BlowStraw::Get -- Fetch a block of data from the straw.                                   *
  *   BlowStraw::Key -- Submit a key to the Blowfish straw.                                     *
+ *   BlowStraw::Peek -- Look at the processed data without copying it.                         *
  * - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
 
 
@@ -62,6 +64,7 @@
  *                                                                                             *
  * HISTORY:                                                                                    *
  *   07/03/1996 JLB : Created.                                                                 *
+ *   10/19/2026 AGT : Hands out any data that Peek processed ahead first.                      *
  *=============================================================================================*/
 int BlowStraw::Get(void * source, int slen)
 {
@@ -82,6 +85,17 @@ int BlowStraw::Get(void * source, int slen)
 
 	int total = 0;
 
+	/*
+	**	Data that Peek has already processed comes before anything still in the source.
+	*/
+	if (ViewStart < ViewEnd) {
+		total = (slen < ViewEnd-ViewStart) ? slen : ViewEnd-ViewStart;
+		memmove(source, &View[ViewStart], total);
+		ViewStart += total;
+		source = ((char *)source) + total;
+		slen -= total;
+	}
+
 	while (slen > 0) {
 
 		/*
@@ -98,6 +112,47 @@ int BlowStraw::Get(void * source, int slen)
 		}
 		if (slen == 0) break;
 
+		/*
+		**	Whole blocks are processed straight into the destination buffer. If the
+		**	source can show its data in place, they are processed right out of it.
+		**	Otherwise they are fetched into the destination and processed there.
+		*/
+		if (slen >= (int)sizeof(Buffer)) {
+			int len = slen - (slen % sizeof(Buffer));
+
+			void const * view = NULL;
+			int incount = (ChainTo != NULL) ? ChainTo->Peek(view, len) : 0;
+			incount -= incount % sizeof(Buffer);
+			if (incount > 0) {
+				if (Control == DECRYPT) {
+					BF->Decrypt(view, incount, source);
+				} else {
+					BF->Encrypt(view, incount, source);
+				}
+				ChainTo->Consume(incount);
+				len = incount;
+			} else {
+				incount = Straw::Get(source, len);
+
+				/*
+				**	Only full blocks are processed. A partial block at the end of
+				**	the data is merely passed through unchanged.
+				*/
+				int whole = incount - (incount % sizeof(Buffer));
+				if (Control == DECRYPT) {
+					BF->Decrypt(source, whole, source);
+				} else {
+					BF->Encrypt(source, whole, source);
+				}
+			}
+
+			source = ((char *)source) + incount;
+			slen -= incount;
+			total += incount;
+			if (incount < len) break;
+			continue;
+		}
+
 		/*
 		**	Fetch and encrypt/decrypt the next block.
 		*/
@@ -127,6 +182,126 @@ int BlowStraw::Get(void * source, int slen)
 }
 
 
+/***********************************************************************************************
+ * BlowStraw::Peek -- Look at the processed data without copying it.                           *
+ *                                                                                             *
+ *    Enough data is drawn from the source and processed into a buffer of this straw's own to  *
+ *    fill the request, and a view of that buffer is returned. The data stays in the buffer    *
+ *    until it is removed by Consume or Get, so asking again returns the same data. Without a  *
+ *    key, the data passes through unchanged and the view of the source is returned instead.   *
+ *                                                                                             *
+ * INPUT:   buffer   -- Reference to the pointer that will be set to the start of the data.    *
+ *                                                                                             *
+ *          slen     -- The number of bytes requested.                                         *
+ *                                                                                             *
+ * OUTPUT:  Returns with the number of bytes that may be looked at. If this is less than       *
+ *          requested, then it indicates that the data source has been exhausted.              *
+ *                                                                                             *
+ * WARNINGS:   The view is only good until the next call to this straw.                        *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+int BlowStraw::Peek(void const * & buffer, int slen)
+{
+	buffer = NULL;
+	if (slen <= 0) {
+		return(0);
+	}
+
+	/*
+	**	If there is no blowfish engine present, then the data is the same as
+	**	the source's.
+	*/
+	if (BF == NULL) {
+		return((ChainTo != NULL) ? ChainTo->Peek(buffer, slen) : 0);
+	}
+
+	int available = ViewEnd - ViewStart;
+	if (available < slen) {
+
+		/*
+		**	Make room for the rest of the request at the end of the data already processed,
+		**	growing the buffer if it is too small. Whole blocks are fetched, so the buffer is
+		**	a block bigger than asked for.
+		*/
+		int size = slen + sizeof(Buffer);
+		if (size > ViewSize) {
+			char * view = new char [size];
+			if (view == NULL) return(0);
+			memmove(view, &View[ViewStart], available);
+			delete [] View;
+			View = view;
+			ViewSize = size;
+		} else {
+			memmove(View, &View[ViewStart], available);
+		}
+		ViewStart = 0;
+		ViewEnd = available;
+
+		/*
+		**	Bytes left over in the block buffer come before anything still in the source.
+		*/
+		if (Counter > 0) {
+			memmove(&View[ViewEnd], &Buffer[sizeof(Buffer)-Counter], Counter);
+			ViewEnd += Counter;
+			Counter = 0;
+		}
+
+		/*
+		**	Fetch and process the rest in place. Only full blocks are processed. A partial
+		**	block at the end of the data is merely passed through unchanged.
+		*/
+		int want = slen - ViewEnd;
+		if (want > 0) {
+			want += (sizeof(Buffer) - (want % sizeof(Buffer))) % sizeof(Buffer);
+			int incount = Straw::Get(&View[ViewEnd], want);
+			int whole = incount - (incount % sizeof(Buffer));
+			if (Control == DECRYPT) {
+				BF->Decrypt(&View[ViewEnd], whole, &View[ViewEnd]);
+			} else {
+				BF->Encrypt(&View[ViewEnd], whole, &View[ViewEnd]);
+			}
+			ViewEnd += incount;
+		}
+		available = ViewEnd - ViewStart;
+	}
+
+	buffer = &View[ViewStart];
+	return((slen < available) ? slen : available);
+}
+
+
+/***********************************************************************************************
+ * BlowStraw::Consume -- Remove data that was looked at through Peek.                          *
+ *                                                                                             *
+ *    This advances past the data just as if it had been fetched with Get.                     *
+ *                                                                                             *
+ * INPUT:   slen     -- The number of bytes to remove.                                         *
+ *                                                                                             *
+ * OUTPUT:  Returns with the number of bytes removed.                                          *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+int BlowStraw::Consume(int slen)
+{
+	if (slen <= 0) {
+		return(0);
+	}
+
+	if (BF == NULL) {
+		return((ChainTo != NULL) ? ChainTo->Consume(slen) : 0);
+	}
+
+	int len = (slen < ViewEnd-ViewStart) ? slen : ViewEnd-ViewStart;
+	ViewStart += len;
+	return(len);
+}
+
+
 /***********************************************************************************************
  * BlowStraw::Key -- Submit a key to the Blowfish straw.                                       *
  *                                                                                             *
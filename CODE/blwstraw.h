@@ -57,10 +57,12 @@ class BlowStraw : public Straw
 			DECRYPT
 		} CryptControl;
 
-		BlowStraw(CryptControl control) : BF(NULL), Counter(0), Control(control) {}
-		virtual ~BlowStraw(void) {delete BF;BF = NULL;}
+		BlowStraw(CryptControl control) : BF(NULL), Counter(0), Control(control), View(NULL), ViewSize(0), ViewStart(0), ViewEnd(0) {}
+		virtual ~BlowStraw(void) {delete BF;BF = NULL;delete [] View;View = NULL;}
 
 		virtual int Get(void * source, int slen);
+		virtual int Peek(void const * & buffer, int slen);
+		virtual int Consume(int slen);
 
 		// Submit key for blowfish engine.
 		void Key(void const * key, int length);
@@ -79,6 +81,15 @@ class BlowStraw : public Straw
 		int Counter;
 		CryptControl Control;
 
+		/*
+		**	Data processed ahead so that it can be handed out by Peek. The bytes from ViewStart
+		**	up to ViewEnd have been processed but not yet removed from the straw.
+		*/
+		char * View;
+		int ViewSize;
+		int ViewStart;
+		int ViewEnd;
+
 		BlowStraw(BlowStraw & rvalue);
 		BlowStraw & operator = (BlowStraw const & straw);
 };
@@ -33,11 +33,20 @@
  *                                                                                             *
  *---------------------------------------------------------------------------------------------*
  * Functions:                                                                                  *
+ *   CDFileClass::Add_To_Index -- Adds a file found on disk to the snapshot index.             *
+ *   CDFileClass::Build_Index -- Takes a snapshot of the files in every search directory.      *
  *   CDFileClass::Clear_Search_Drives -- Removes all record of a search path.                  *
+ *   CDFileClass::Find_Path -- Checks for a file without failed probes of the disk.            *
+ *   CDFileClass::Index_Directory -- Finds which snapshot directory a pathname is in.          *
+ *   CDFileClass::Index_Lookup -- Looks up a pathname in the snapshot index.                   *
+ *   CDFileClass::Invalidate_Index -- Discards the snapshot index and the missing file cache.  *
+ *   CDFileClass::Is_Available -- Checks for the file using the snapshot index.                *
  *   CDFileClass::Open -- Opens the file object -- with path search.                           *
  *   CDFileClass::Open -- Opens the file wherever it can be found.                             *
+ *   CDFileClass::Rescan_Directory -- Reads one directory of the snapshot index again.         *
  *   CDFileClass::Set_Name -- Performs a multiple directory scan to set the filename.          *
  *   CDFileClass::Set_Search_Drives -- Sets a list of search paths for file access.            *
+ *   CDFileClass::Update_Index -- Brings the snapshot index up to date with changed files.     *
  *   Is_Disk_Inserted -- Checks to see if a disk is inserted in specified drive.               *
  *   harderr_handler -- Handles hard DOS errors.                                               *
  * - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
@@ -46,6 +55,7 @@
 #include	"cdfile.h"
 #include	<stdio.h>
 #include	<string.h>
+#include	<ctype.h>
 #include	"file.h"
 #include	"ex_string.h"
 
@@ -67,6 +77,44 @@ int  CDFileClass::CurrentCDDrive = 0;
 int  CDFileClass::LastCDDrive = 0;
 char CDFileClass::RawPath[512] = {0};
 
+/*
+**	The snapshot of the search directories and the cache of files known to be missing.
+*/
+CDFileClass::FileIndexType * CDFileClass::Index = NULL;
+int CDFileClass::IndexSize = 0;
+int CDFileClass::IndexCount = 0;
+char const ** CDFileClass::IndexDirs = NULL;
+int CDFileClass::IndexDirCount = 0;
+bool CDFileClass::IsIndexValid = false;
+unsigned long CDFileClass::IndexChangeCount = 0;
+char const * CDFileClass::Missing[MISSING_SIZE];
+int CDFileClass::MissingCount = 0;
+
+
+/*
+**	Converts a pathname into the form used as an index key: upper case, with every
+**	directory separator as an antivirgule.
+*/
+static void Make_Key(char * key, char const * path)
+{
+	while (*path) {
+		*key = (*path == '/') ? '\\' : (char)toupper((unsigned char)*path);
+		key++;
+		path++;
+	}
+	*key = '\0';
+}
+
+
+static unsigned Hash_Key(char const * key)
+{
+	unsigned hash = 0;
+	while (*key) {
+		hash = hash * 31 + (unsigned char)*key++;
+	}
+	return(hash ^ (hash >> 16));
+}
+
 CDFileClass::CDFileClass(char const *filename) :
 	IsDisabled(false)
 {
@@ -486,6 +534,7 @@ void CDFileClass::Add_Search_Drive(char *path)
 	*/
 	srch->Path = strdup(path);
 	srch->Next = NULL;
+	Invalidate_Index();
 
 	/*
 	**	Attach this path record to the end of the path chain.
@@ -556,6 +605,7 @@ void CDFileClass::Clear_Search_Drives(void)
 		chain = next;
 	}
 	First = 0;
+	Invalidate_Index();
 }
 
 
@@ -588,7 +638,7 @@ char const * CDFileClass::Set_Name(char const *filename)
 	**	no multi-drive search path.
 	*/
 	BufferIOFileClass::Set_Name(filename);
-	if (IsDisabled || !First || BufferIOFileClass::Is_Available()) return(File_Name());
+	if (IsDisabled || Find_Path(filename) || !First) return(File_Name());
 
 	/*
 	**	Attempt to find the file first. Check the current directory. If not found there, then
@@ -611,8 +661,7 @@ char const * CDFileClass::Set_Name(char const *filename)
 		**	prompt if necessary when the CD-ROM drive has been removed. In all other cases,
 		**	it will return false and the search process will continue.
 		*/
-		BufferIOFileClass::Set_Name(path);
-		if (BufferIOFileClass::Is_Available()) {
+		if (Find_Path(path)) {
 			return(File_Name());
 		}
 
@@ -684,6 +733,495 @@ int CDFileClass::Open(char const *filename, int rights)
 }
 
 
+/***********************************************************************************************
+ * CDFileClass::Is_Available -- Checks for the file using the snapshot index.                  *
+ *                                                                                             *
+ *    A file in the current directory or in one of the search paths is checked against the     *
+ *    snapshot index rather than the disk. This lets a file that is only held in a mixfile be  *
+ *    checked for without a failed open.                                                       *
+ *                                                                                             *
+ * INPUT:   forced   -- Should the file be checked on disk regardless?                         *
+ *                                                                                             *
+ * OUTPUT:  bool; Is the file available to open?                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+int CDFileClass::Is_Available(int forced)
+{
+	if (IsDisabled || forced || Is_Open() || File_Name() == NULL) {
+		return(BufferIOFileClass::Is_Available(forced));
+	}
+
+	/*
+	**	The name is copied since Find_Path() resets it. A name too long to copy can't be in
+	**	the index, so it is checked on disk.
+	*/
+	char path[_MAX_PATH];
+	if (strlen(File_Name()) >= sizeof(path)) {
+		return(BufferIOFileClass::Is_Available(forced));
+	}
+	strcpy(path, File_Name());
+	return(Find_Path(path));
+}
+
+
+/***********************************************************************************************
+ * CDFileClass::Find_Path -- Checks for a file without failed probes of the disk.              *
+ *                                                                                             *
+ *    If the file's directory is in the snapshot index, the index decides whether the file     *
+ *    exists. Where case matters, a name that only matches a file on disk when case is         *
+ *    ignored is checked on disk, just as it was before the index. Files in other              *
+ *    directories are checked on disk, unless they have already been found to be missing.      *
+ *                                                                                             *
+ * INPUT:   path     -- The pathname of the file to check for.                                 *
+ *                                                                                             *
+ * OUTPUT:  bool; Was the file found?                                                          *
+ *                                                                                             *
+ * WARNINGS:   The name of this file object is set to the pathname (on Windows, with the       *
+ *             case of the file on disk if it was found).                                      *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+bool CDFileClass::Find_Path(char const * path)
+{
+	Update_Index();
+
+	char key[_MAX_PATH];
+	Make_Key(key, path);
+
+	char const * found = NULL;
+	switch (Index_Lookup(key, &found)) {
+		case 1:
+#ifndef _WIN32
+			/*
+			**	The index ignores case but the disk may not. If the name differs from the
+			**	file on disk in case, ask the disk, so the file is found exactly when opening
+			**	it by that name would work.
+			*/
+			if (strcmp(found, path) != 0) {
+				BufferIOFileClass::Set_Name(path);
+				return(BufferIOFileClass::Is_Available());
+			}
+#endif
+			BufferIOFileClass::Set_Name(found);
+			return(true);
+
+		case 0:
+			BufferIOFileClass::Set_Name(path);
+			return(false);
+
+		default:
+			break;
+	}
+
+	/*
+	**	Check the cache of files that are known to be missing.
+	*/
+	BufferIOFileClass::Set_Name(path);
+	unsigned slot = Hash_Key(key) & (MISSING_SIZE-1);
+	while (Missing[slot] != NULL) {
+		if (strcmp(Missing[slot], key) == 0) return(false);
+		slot = (slot + 1) & (MISSING_SIZE-1);
+	}
+
+	if (BufferIOFileClass::Is_Available()) return(true);
+
+	/*
+	**	Remember that the file is missing. The cache is emptied once it gets half full.
+	*/
+	if (MissingCount >= MISSING_SIZE/2) {
+		for (int index = 0; index < MISSING_SIZE; index++) {
+			free((char *)Missing[index]);
+			Missing[index] = NULL;
+		}
+		MissingCount = 0;
+		slot = Hash_Key(key) & (MISSING_SIZE-1);
+	}
+	Missing[slot] = strdup(key);
+	MissingCount++;
+	return(false);
+}
+
+
+/***********************************************************************************************
+ * CDFileClass::Invalidate_Index -- Discards the snapshot index and the missing file cache.    *
+ *                                                                                             *
+ *    Files opened for writing, renamed or deleted through any file class are noticed          *
+ *    without this. Call this routine when files have been added to or removed from any of     *
+ *    the search directories by some other means, such as another program. The index is        *
+ *    rebuilt on the next lookup.                                                              *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+void CDFileClass::Invalidate_Index(void)
+{
+	for (int index = 0; index < IndexSize; index++) {
+		free((char *)Index[index].Name);
+		free((char *)Index[index].Path);
+	}
+	delete [] Index;
+	Index = NULL;
+	IndexSize = 0;
+	IndexCount = 0;
+
+	for (int dir = 0; dir < IndexDirCount; dir++) {
+		free((char *)IndexDirs[dir]);
+	}
+	delete [] IndexDirs;
+	IndexDirs = NULL;
+	IndexDirCount = 0;
+
+	for (int slot = 0; slot < MISSING_SIZE; slot++) {
+		free((char *)Missing[slot]);
+		Missing[slot] = NULL;
+	}
+	MissingCount = 0;
+
+	IsIndexValid = false;
+}
+
+
+/***********************************************************************************************
+ * CDFileClass::Build_Index -- Takes a snapshot of the files in every search directory.        *
+ *                                                                                             *
+ *    The current directory and each of the search paths are read once, so that looking for    *
+ *    a file in them does not have to touch the disk.                                          *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   Files added or removed by other programs are not seen until the next call to    *
+ *             Invalidate_Index().                                                             *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+void CDFileClass::Build_Index(void)
+{
+	Invalidate_Index();
+
+	int count = 1;
+	for (SearchDriveType * srch = First; srch; srch = (SearchDriveType *)srch->Next) {
+		count++;
+	}
+	IndexDirs = new char const * [count];
+
+	IndexSize = 256;
+	Index = new FileIndexType [IndexSize];
+	memset(Index, 0, IndexSize * sizeof(FileIndexType));
+
+	/*
+	**	The current directory has an empty path and is searched first.
+	*/
+	SearchDriveType * srch = NULL;
+	char const * dir = "";
+	for (;;) {
+		char key[_MAX_PATH];
+		Make_Key(key, dir);
+		IndexDirs[IndexDirCount++] = strdup(key);
+
+		char pattern[_MAX_PATH];
+		strcpy(pattern, dir);
+		strcat(pattern, "*");
+
+		FindFileState state;
+		if (Find_First_File(pattern, state)) {
+			do {
+				Add_To_Index(dir, state.name);
+			} while (Find_Next_File(state));
+		}
+
+		srch = (srch == NULL) ? First : (SearchDriveType *)srch->Next;
+		if (srch == NULL) break;
+		dir = srch->Path;
+	}
+
+	IndexChangeCount = ChangeCount;
+	IsIndexValid = true;
+}
+
+
+/***********************************************************************************************
+ * CDFileClass::Update_Index -- Brings the snapshot index up to date with changed files.       *
+ *                                                                                             *
+ *    Each file opened for writing, renamed or deleted since the index was last brought up to  *
+ *    date is checked on disk. Only if it has been added or removed is the directory it is in  *
+ *    read again. A file in a directory that isn't in the index is dropped from the missing    *
+ *    file cache. If the changes are no longer all in the log, the index is rebuilt.           *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+void CDFileClass::Update_Index(void)
+{
+	if (!IsIndexValid) {
+		Build_Index();
+		return;
+	}
+
+	while (IndexChangeCount != ChangeCount) {
+		char const * filename = Changed_File(IndexChangeCount);
+		if (filename == NULL) {
+			Build_Index();
+			return;
+		}
+		IndexChangeCount++;
+
+		char key[_MAX_PATH];
+		Make_Key(key, filename);
+		int dir = Index_Directory(key);
+
+		if (dir < 0) {
+			/*
+			**	If the file was thought to be missing, forget everything that was thought
+			**	to be missing; the cache is rebuilt as files are looked for.
+			*/
+			unsigned slot = Hash_Key(key) & (MISSING_SIZE-1);
+			while (Missing[slot] != NULL) {
+				if (strcmp(Missing[slot], key) == 0) {
+					for (int index = 0; index < MISSING_SIZE; index++) {
+						free((char *)Missing[index]);
+						Missing[index] = NULL;
+					}
+					MissingCount = 0;
+					break;
+				}
+				slot = (slot + 1) & (MISSING_SIZE-1);
+			}
+			continue;
+		}
+
+		char const * found = NULL;
+		bool indexed = (Index_Lookup(key, &found) == 1);
+		RawFileClass file(filename);
+		if (indexed != (file.Is_Available() != 0)) {
+			Rescan_Directory(dir);
+		}
+	}
+}
+
+
+/***********************************************************************************************
+ * CDFileClass::Rescan_Directory -- Reads one directory of the snapshot index again.           *
+ *                                                                                             *
+ *    Every file in the directory is dropped from the index and the directory is then read     *
+ *    from disk as Build_Index() reads it.                                                     *
+ *                                                                                             *
+ * INPUT:   dir      -- The number of the directory in the index (0 is the current directory,  *
+ *                      then each search path in order).                                       *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+void CDFileClass::Rescan_Directory(int dir)
+{
+	/*
+	**	Find the directory as it was read, not as its key.
+	*/
+	char const * path = "";
+	SearchDriveType * srch = First;
+	for (int index = 1; index < dir && srch != NULL; index++) {
+		srch = (SearchDriveType *)srch->Next;
+	}
+	if (dir > 0) {
+		if (srch == NULL) {
+			Build_Index();
+			return;
+		}
+		path = srch->Path;
+	}
+
+	/*
+	**	Put every file of the other directories into a fresh table.
+	*/
+	FileIndexType * old = Index;
+	int oldsize = IndexSize;
+	Index = new FileIndexType [IndexSize];
+	memset(Index, 0, IndexSize * sizeof(FileIndexType));
+	IndexCount = 0;
+
+	int dirlen = strlen(IndexDirs[dir]);
+	for (int index = 0; index < oldsize; index++) {
+		char const * name = old[index].Name;
+		if (name == NULL) continue;
+
+		int namedir = 0;
+		for (int pos = 0; name[pos]; pos++) {
+			if (name[pos] == '\\' || name[pos] == ':') namedir = pos+1;
+		}
+		if (namedir == dirlen && strncmp(name, IndexDirs[dir], dirlen) == 0) {
+			free((char *)old[index].Name);
+			free((char *)old[index].Path);
+			continue;
+		}
+
+		unsigned slot = Hash_Key(name) & (IndexSize-1);
+		while (Index[slot].Name != NULL) {
+			slot = (slot + 1) & (IndexSize-1);
+		}
+		Index[slot] = old[index];
+		IndexCount++;
+	}
+	delete [] old;
+
+	char pattern[_MAX_PATH];
+	strcpy(pattern, path);
+	strcat(pattern, "*");
+
+	FindFileState state;
+	if (Find_First_File(pattern, state)) {
+		do {
+			Add_To_Index(path, state.name);
+		} while (Find_Next_File(state));
+	}
+}
+
+
+/***********************************************************************************************
+ * CDFileClass::Add_To_Index -- Adds a file found on disk to the snapshot index.               *
+ *                                                                                             *
+ * INPUT:   dir      -- The search directory the file was found in.                            *
+ *                                                                                             *
+ *          name     -- The name of the file as found. Any directory part is ignored.          *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+void CDFileClass::Add_To_Index(char const * dir, char const * name)
+{
+	char const * base = name;
+	for (char const * ptr = name; *ptr; ptr++) {
+		if (*ptr == '/' || *ptr == '\\' || *ptr == ':') base = ptr+1;
+	}
+
+	char path[_MAX_PATH];
+	if (strlen(dir) + strlen(base) >= sizeof(path)) return;
+	strcpy(path, dir);
+	strcat(path, base);
+
+	char key[_MAX_PATH];
+	Make_Key(key, path);
+
+	/*
+	**	Keep the table no more than half full.
+	*/
+	if ((IndexCount+1) * 2 > IndexSize) {
+		FileIndexType * old = Index;
+		int oldsize = IndexSize;
+
+		IndexSize *= 2;
+		Index = new FileIndexType [IndexSize];
+		memset(Index, 0, IndexSize * sizeof(FileIndexType));
+
+		for (int index = 0; index < oldsize; index++) {
+			if (old[index].Name != NULL) {
+				unsigned slot = Hash_Key(old[index].Name) & (IndexSize-1);
+				while (Index[slot].Name != NULL) {
+					slot = (slot + 1) & (IndexSize-1);
+				}
+				Index[slot] = old[index];
+			}
+		}
+		delete [] old;
+	}
+
+	unsigned slot = Hash_Key(key) & (IndexSize-1);
+	while (Index[slot].Name != NULL) {
+		if (strcmp(Index[slot].Name, key) == 0) return;
+		slot = (slot + 1) & (IndexSize-1);
+	}
+	Index[slot].Name = strdup(key);
+	Index[slot].Path = strdup(path);
+	IndexCount++;
+}
+
+
+/***********************************************************************************************
+ * CDFileClass::Index_Directory -- Finds which snapshot directory a pathname is in.            *
+ *                                                                                             *
+ * INPUT:   key      -- The pathname, as converted by Make_Key().                              *
+ *                                                                                             *
+ * OUTPUT:  Returns with the number of the directory in the snapshot, or -1 if the directory   *
+ *          is not in the snapshot.                                                            *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+int CDFileClass::Index_Directory(char const * key)
+{
+	int dirlen = 0;
+	for (int index = 0; key[index]; index++) {
+		if (key[index] == '\\' || key[index] == ':') dirlen = index+1;
+	}
+
+	for (int dir = 0; dir < IndexDirCount; dir++) {
+		if ((int)strlen(IndexDirs[dir]) == dirlen && strncmp(IndexDirs[dir], key, dirlen) == 0) {
+			return(dir);
+		}
+	}
+	return(-1);
+}
+
+
+/***********************************************************************************************
+ * CDFileClass::Index_Lookup -- Looks up a pathname in the snapshot index.                     *
+ *                                                                                             *
+ * INPUT:   key      -- The pathname, as converted by Make_Key().                              *
+ *                                                                                             *
+ *          path     -- The pathname to open the file with is stored here if it was found.     *
+ *                                                                                             *
+ * OUTPUT:  Returns 1 if the file exists, 0 if it doesn't, or -1 if its directory is not in    *
+ *          the snapshot.                                                                      *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+int CDFileClass::Index_Lookup(char const * key, char const ** path)
+{
+	if (Index_Directory(key) < 0) return(-1);
+
+	unsigned slot = Hash_Key(key) & (IndexSize-1);
+	while (Index[slot].Name != NULL) {
+		if (strcmp(Index[slot].Name, key) == 0) {
+			*path = Index[slot].Path;
+			return(1);
+		}
+		slot = (slot + 1) & (IndexSize-1);
+	}
+	return(0);
+}
+
+
 #ifdef NEVER
 /*
 ** Get the drive letters if the CD's online */
@@ -58,6 +58,7 @@ class CDFileClass : public BufferIOFileClass
 		virtual ~CDFileClass(void) {};
 
 		virtual char const * Set_Name(char const *filename);
+		virtual int Is_Available(int forced=false);
 		virtual int Open(char const *filename, int rights=READ);
 		virtual int Open(int rights=READ);
 
@@ -71,9 +72,12 @@ class CDFileClass : public BufferIOFileClass
 		static void Set_CD_Drive(int drive);
 		static int  Get_CD_Drive(void) {return(CurrentCDDrive);};
 		static int  Get_Last_CD_Drive(void) {return(LastCDDrive);};
+		static void Invalidate_Index(void);
 
 	private:
 
+		bool Find_Path(char const * path);
+
 		/*
 		**	Is multi-drive searching disabled for this file object?
 		*/
@@ -106,6 +110,41 @@ class CDFileClass : public BufferIOFileClass
 		** The drive letter of the last used CD drive
 		*/
 		static int LastCDDrive;
+
+		/*
+		**	This is a snapshot of the files in the current directory and in every search
+		**	path, keyed by the upper case pathname. Names in those directories are looked
+		**	up here instead of being probed on disk. On the next lookup after a file is opened
+		**	for writing, renamed or deleted, just the directory it is in is read again, and
+		**	only if the file was added or removed. It is rebuilt after Invalidate_Index(), or
+		**	if more files changed than RawFileClass keeps a log of.
+		*/
+		typedef struct {
+			char const * Name;		// Upper case pathname; NULL for an empty slot.
+			char const * Path;		// Pathname with the case found on disk.
+		} FileIndexType;
+		static FileIndexType * Index;
+		static int IndexSize;					// Always a power of 2.
+		static int IndexCount;
+		static char const ** IndexDirs;		// Upper case directories in the snapshot.
+		static int IndexDirCount;
+		static bool IsIndexValid;
+		static unsigned long IndexChangeCount;	// RawFileClass::ChangeCount when it was built.
+
+		static void Build_Index(void);
+		static void Update_Index(void);
+		static void Rescan_Directory(int dir);
+		static void Add_To_Index(char const * dir, char const * name);
+		static int Index_Directory(char const * key);
+		static int Index_Lookup(char const * key, char const ** path);
+
+		/*
+		**	These are the upper case names of files in other directories that were looked
+		**	for on disk and not found.
+		*/
+		enum {MISSING_SIZE=256};				// Must be a power of 2.
+		static char const * Missing[MISSING_SIZE];
+		static int MissingCount;
 };
 
 #endif
@@ -954,6 +954,7 @@ static int _ocompare(const void * left, const void * right)
  *   12/11/1994 JLB : Mixes up clear terrain through pseudo-random table.                      *
  *   04/25/1995 JLB : Smudges drawn BELOW overlays.                                            *
  *   07/22/1996 JLB : Objects added to draw process.                                           *
+ *   10/19/2026 AGT : Copies the static terrain from the terrain cache when it can.            *
  *=============================================================================================*/
 void CellClass::Draw_It(int x, int y, bool objects) const
 {
@@ -974,6 +975,7 @@ void CellClass::Draw_It(int x, int y, bool objects) const
 	#endif
 
 		CellCount++;
+		Metrics.Add(METRIC_CELL_COUNT);
 
 		/*
 		**	Fetch a pointer to the template type associated with this cell.
@@ -1021,10 +1023,21 @@ void CellClass::Draw_It(int x, int y, bool objects) const
 			}
 	#endif
 
+			/*
+			**	The template, smudge and overlay make up the static terrain layer. If the terrain
+			**	cache holds an up to date image of them for this cell, it is copied from there
+			**	and none of them need to be drawn.
+			*/
+			bool cacheable = (remap == NULL && TerrainCache.Is_Cacheable(x, y));
+	#ifdef SCENARIO_EDITOR
+			if (Debug_Map) cacheable = false;
+	#endif
+			bool cached = (cacheable && TerrainCache.Fetch(*this, x, y));
+
 			/*
 			**	This is the underlying terrain icon.
 			*/
-			if (ttype->Get_Image_Data()) {
+			if (!cached && ttype->Get_Image_Data()) {
 				LogicPage->Draw_Stamp(ttype->Get_Image_Data(), icon, x, y, NULL, WINDOW_TACTICAL);
 				if (remap) {
 					LogicPage->Remap(x+Map.TacPixelX, y+Map.TacPixelY, ICON_PIXEL_W, ICON_PIXEL_H, remap);
@@ -1046,20 +1059,27 @@ void CellClass::Draw_It(int x, int y, bool objects) const
 			/*
 			**	Redraw any smudge.
 			*/
-			if (Smudge != SMUDGE_NONE) {
+			if (!cached && Smudge != SMUDGE_NONE) {
 				SmudgeTypeClass::As_Reference(Smudge).Draw_It(x, y, SmudgeData);
 			}
 
 			/*
 			**	Draw the overlay object.
 			*/
-			if (Overlay != OVERLAY_NONE) {
+			if (!cached && Overlay != OVERLAY_NONE) {
 				OverlayTypeClass const & otype = OverlayTypeClass::As_Reference(Overlay);
 				IsTheaterShape = (bool)otype.IsTheater;	//Tell Build_Frame if this overlay is theater specific
 				CC_Draw_Shape(otype.Get_Image_Data(), OverlayData, (x+(CELL_PIXEL_W>>1)), (y+(CELL_PIXEL_H>>1)), WINDOW_TACTICAL, SHAPE_CENTER|SHAPE_WIN_REL|SHAPE_GHOST, NULL, DisplayClass::UnitShadow);
 				IsTheaterShape = false;
 			}
 
+			/*
+			**	Remember the freshly drawn terrain so that it can be copied the next time.
+			*/
+			if (cacheable && !cached) {
+				TerrainCache.Store(*this, x, y);
+			}
+
 	#ifdef SCENARIO_EDITOR
 			if (Debug_Map) {
 				/*
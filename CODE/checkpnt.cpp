@@ -0,0 +1,787 @@
+/*
+**	Command & Conquer Red Alert(tm)
+**	Copyright 2025 Electronic Arts Inc.
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/***********************************************************************************************
+ *                                                                                             *
+ *                 Project Name : Command & Conquer                                            *
+ *                                                                                             *
+ *                    File Name : CHECKPNT.CPP                                                 *
+ *                                                                                             *
+ *                   Start Date : 10/19/26                                                     *
+ *                                                                                             *
+ *                  Last Update : October 19, 2026                                             *
+ *                                                                                             *
+ *---------------------------------------------------------------------------------------------*
+ * Functions:                                                                                  *
+ *   CheckpointClass::Add_Chunks -- Splits the data between two tables into records.           *
+ *   CheckpointClass::Add_Record -- Adds a record to a list of records.                        *
+ *   CheckpointClass::Apply -- Builds an image from the records of a checkpoint file.          *
+ *   CheckpointClass::Capture -- Starts capturing the image for the next checkpoint.           *
+ *   CheckpointClass::CheckpointClass -- Constructor for the checkpoint chain manager.         *
+ *   CheckpointClass::Compare_Records -- Orders records by key for sorting.                    *
+ *   CheckpointClass::File_Name -- Builds the file name for a checkpoint in the chain.         *
+ *   CheckpointClass::Find -- Finds the record with a key in the current image.                *
+ *   CheckpointClass::Mark_Table -- Marks a table of keyed records in the captured image.      *
+ *   CheckpointClass::Read -- Reconstructs the latest image from the checkpoint chain.         *
+ *   CheckpointClass::Reserve -- Ensures an image buffer is large enough.                      *
+ *   CheckpointClass::Sort_Records -- Sorts the records of the current image by key.           *
+ *   CheckpointClass::Split -- Splits an image into its records.                               *
+ *   CheckpointClass::Write -- Writes a base or delta checkpoint of the captured image.        *
+ *   CheckpointClass::Write_File -- Writes a checkpoint file in place of any older one.        *
+ *   CheckpointClass::~CheckpointClass -- Destructor for the checkpoint chain manager.         *
+ * - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+#include	"function.h"
+#include	"checkpnt.h"
+
+
+/*
+**	Identifies a checkpoint file ("CKPR").
+*/
+#define	CHECKPOINT_ID			0x52504B43UL
+
+/*
+**	Compression block size used for the records.
+*/
+#define	CHECKPOINT_BLOCK_SIZE	4096
+
+/*
+**	Most chunks that the data between two tables is split into. Any data past the last one
+**	is added to it.
+*/
+#define	CHECKPOINT_CHUNK_MAX		4096
+
+
+/***********************************************************************************************
+ * CheckpointClass::CheckpointClass -- Constructor for the checkpoint chain manager.           *
+ *                                                                                             *
+ *    The checkpoint manager starts with no image. The first write will produce a base         *
+ *    checkpoint.                                                                              *
+ *                                                                                             *
+ * INPUT:   name  -- The base name of the checkpoint files. The sequence number of each        *
+ *                   checkpoint is its extension.                                              *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *   10/19/2026 AGT : Takes the base name of the files.                                        *
+ *=============================================================================================*/
+CheckpointClass::CheckpointClass(char const * name) :
+	TableCount(0),
+	Image(NULL),
+	Size(0),
+	MaxSize(0),
+	Records(NULL),
+	Sorted(NULL),
+	RecordCount(0),
+	RecordMax(0),
+	SortedMax(0),
+	Scratch(NULL),
+	ScratchMax(0),
+	ScratchRecords(NULL),
+	ScratchCount(0),
+	ScratchRecordMax(0),
+	Sequence(-1),
+	Changed(0),
+	ImageCRC(0),
+	IsNet(false),
+	Frame(0)
+{
+	strncpy(Name, name, sizeof(Name)-1);
+	Name[sizeof(Name)-1] = '\0';
+}
+
+
+/***********************************************************************************************
+ * CheckpointClass::~CheckpointClass -- Destructor for the checkpoint chain manager.           *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+CheckpointClass::~CheckpointClass(void)
+{
+	delete [] Image;
+	Image = NULL;
+	delete [] Scratch;
+	Scratch = NULL;
+	delete [] Records;
+	Records = NULL;
+	delete [] Sorted;
+	Sorted = NULL;
+	delete [] ScratchRecords;
+	ScratchRecords = NULL;
+}
+
+
+/***********************************************************************************************
+ * CheckpointClass::File_Name -- Builds the file name for a checkpoint in the chain.           *
+ *                                                                                             *
+ * INPUT:   buffer   -- Pointer to the buffer to hold the file name.                           *
+ *                                                                                             *
+ *          sequence -- The sequence number of the checkpoint (0 is the base).                 *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+void CheckpointClass::File_Name(char * buffer, int sequence) const
+{
+	sprintf(buffer, "%s.%03d", Name, sequence);
+}
+
+
+/***********************************************************************************************
+ * CheckpointClass::Capture -- Starts capturing the image for the next checkpoint.             *
+ *                                                                                             *
+ *    The save game data is put to the pipe returned, and the tables of keyed records in it    *
+ *    are marked as it goes. Write then stores it as the next checkpoint.                      *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  Returns with the pipe to put the image to.                                         *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+Pipe & CheckpointClass::Capture(void)
+{
+	Captured.Reset();
+	TableCount = 0;
+	return(Captured);
+}
+
+
+/***********************************************************************************************
+ * CheckpointClass::Mark_Table -- Marks a table of keyed records in the captured image.        *
+ *                                                                                             *
+ *    Call this just before a table is put to the capture pipe. A table is a count of its      *
+ *    records followed by each record, which starts with its key. Each record is compared      *
+ *    with the record with the same key in the previous checkpoint, wherever in the image it   *
+ *    was, so adding or removing a record changes nothing else.                                *
+ *                                                                                             *
+ * INPUT:   keysize     -- The size of the key at the start of each record (no more than 4).   *
+ *                                                                                             *
+ *          recordsize  -- The size of the rest of each record.                                *
+ *                                                                                             *
+ *          skip        -- The number of bytes that will be put before the count.              *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+void CheckpointClass::Mark_Table(int keysize, int recordsize, int skip)
+{
+	if (TableCount < MAX_TABLES && keysize > 0 && keysize <= (int)sizeof(uint32_t) && recordsize >= 0) {
+		Tables[TableCount].Offset = Captured.Get_Length() + skip;
+		Tables[TableCount].KeySize = keysize;
+		Tables[TableCount].RecordSize = recordsize;
+		TableCount++;
+	}
+}
+
+
+/***********************************************************************************************
+ * CheckpointClass::Reserve -- Ensures an image buffer is large enough.                        *
+ *                                                                                             *
+ *    The existing contents of the buffer are preserved if it must be enlarged.                *
+ *                                                                                             *
+ * INPUT:   image -- Reference to the image buffer pointer.                                    *
+ *                                                                                             *
+ *          max   -- Reference to the allocated size of the image buffer.                      *
+ *                                                                                             *
+ *          size  -- The number of bytes required.                                             *
+ *                                                                                             *
+ * OUTPUT:  bool; Is the buffer large enough?                                                  *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+bool CheckpointClass::Reserve(char * & image, int & max, int size)
+{
+	if (size <= max) return(true);
+
+	/*
+	**	Leave some slack since the image tends to grow slowly as the game progresses.
+	*/
+	int newmax = size + size / 8;
+	char * newimage = new char[newmax];
+	if (newimage == NULL) return(false);
+
+	if (image != NULL) {
+		memcpy(newimage, image, max);
+		delete [] image;
+	}
+	image = newimage;
+	max = newmax;
+	return(true);
+}
+
+
+/***********************************************************************************************
+ * CheckpointClass::Add_Record -- Adds a record to a list of records.                          *
+ *                                                                                             *
+ * INPUT:   records  -- Reference to the list of records. It is enlarged as needed.            *
+ *                                                                                             *
+ *          count    -- Reference to the number of records in the list.                        *
+ *                                                                                             *
+ *          max      -- Reference to the number of records the list has room for.              *
+ *                                                                                             *
+ *          key      -- The key of the record.                                                 *
+ *                                                                                             *
+ *          offset   -- Where the record starts in its image.                                  *
+ *                                                                                             *
+ *          length   -- The length of the record.                                              *
+ *                                                                                             *
+ * OUTPUT:  bool; Was the record added?                                                        *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+bool CheckpointClass::Add_Record(RecordType * & records, int & count, int & max, uint32_t key, int offset, int length)
+{
+	if (count >= max) {
+		int newmax = (max < 256) ? 256 : max * 2;
+		RecordType * newrecords = new RecordType[newmax];
+		if (newrecords == NULL) return(false);
+
+		if (records != NULL) {
+			memcpy(newrecords, records, count * sizeof(RecordType));
+			delete [] records;
+		}
+		records = newrecords;
+		max = newmax;
+	}
+
+	records[count].Key = key;
+	records[count].Offset = offset;
+	records[count].Length = length;
+	count++;
+	return(true);
+}
+
+
+/***********************************************************************************************
+ * CheckpointClass::Add_Chunks -- Splits the data between two tables into records.             *
+ *                                                                                             *
+ *    The data is split into chunks of CHUNK_SIZE, keyed by which span of data between the     *
+ *    tables they are in and where in it they lie.                                             *
+ *                                                                                             *
+ * INPUT:   records  -- Reference to the list of records to add to.                            *
+ *                                                                                             *
+ *          count    -- Reference to the number of records in the list.                        *
+ *                                                                                             *
+ *          max      -- Reference to the number of records the list has room for.              *
+ *                                                                                             *
+ *          span     -- The number of the span of data between the tables.                     *
+ *                                                                                             *
+ *          start    -- Where the span starts in the image.                                    *
+ *                                                                                             *
+ *          end      -- Where the span ends in the image.                                      *
+ *                                                                                             *
+ * OUTPUT:  bool; Were the records added?                                                      *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+bool CheckpointClass::Add_Chunks(RecordType * & records, int & count, int & max, int span, int start, int end)
+{
+	for (int chunk = 0; start < end; chunk++) {
+		int length = (end - start < CHUNK_SIZE || chunk == CHECKPOINT_CHUNK_MAX-1) ? (end - start) : CHUNK_SIZE;
+		if (!Add_Record(records, count, max, ((uint32_t)span << 12) | (uint32_t)chunk, start, length)) return(false);
+		start += length;
+	}
+	return(true);
+}
+
+
+/***********************************************************************************************
+ * CheckpointClass::Split -- Splits an image into its records.                                 *
+ *                                                                                             *
+ *    Each record of the tables marked in the image is keyed by the table number and the key   *
+ *    it starts with. The data before, between and after the tables, including the count of    *
+ *    each table, is split into chunks.                                                        *
+ *                                                                                             *
+ * INPUT:   image    -- Pointer to the image to split.                                         *
+ *                                                                                             *
+ *          size     -- The size of the image.                                                 *
+ *                                                                                             *
+ *          records  -- Reference to the list to add the records to.                           *
+ *                                                                                             *
+ *          count    -- Reference to the number of records in the list.                        *
+ *                                                                                             *
+ *          max      -- Reference to the number of records the list has room for.              *
+ *                                                                                             *
+ * OUTPUT:  bool; Was the image split?                                                         *
+ *                                                                                             *
+ * WARNINGS:   A table that does not fit in the image, and any table marked after it, is       *
+ *             treated as data between the tables.                                             *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+bool CheckpointClass::Split(char const * image, int size, RecordType * & records, int & count, int & max) const
+{
+	int pos = 0;
+	for (int table = 0; table < TableCount; table++) {
+		TableType const & info = Tables[table];
+		int32_t entries;
+		if (info.Offset < pos || info.Offset + (int)sizeof(entries) > size) break;
+		memcpy(&entries, image + info.Offset, sizeof(entries));
+
+		if (!Add_Chunks(records, count, max, table, pos, info.Offset + sizeof(entries))) return(false);
+		pos = info.Offset + sizeof(entries);
+
+		int length = info.KeySize + info.RecordSize;
+		for (int index = 0; index < entries && pos + length <= size; index++) {
+			uint32_t key = 0;
+			memcpy(&key, image + pos, info.KeySize);
+			if (!Add_Record(records, count, max, ((uint32_t)(table + 1) << 24) | (key & 0x00FFFFFFUL), pos, length)) return(false);
+			pos += length;
+		}
+	}
+	return(Add_Chunks(records, count, max, TableCount, pos, size));
+}
+
+
+/***********************************************************************************************
+ * CheckpointClass::Compare_Records -- Orders records by key for sorting.                      *
+ *                                                                                             *
+ *    Records with the same key (which only a damaged image would have) are kept in image      *
+ *    order, so that the same one is always found.                                             *
+ *                                                                                             *
+ * INPUT:   left, right -- Pointers to the records to compare.                                 *
+ *                                                                                             *
+ * OUTPUT:  Returns with less than zero if the left record comes first, more than zero if the  *
+ *          right one does.                                                                    *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+int CheckpointClass::Compare_Records(void const * left, void const * right)
+{
+	RecordType const * lrecord = (RecordType const *)left;
+	RecordType const * rrecord = (RecordType const *)right;
+	if (lrecord->Key != rrecord->Key) return((lrecord->Key < rrecord->Key) ? -1 : 1);
+	return(lrecord->Offset - rrecord->Offset);
+}
+
+
+/***********************************************************************************************
+ * CheckpointClass::Sort_Records -- Sorts the records of the current image by key.             *
+ *                                                                                             *
+ *    The sorted copy is what Find searches.                                                   *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   If there is not the memory for the copy, no record will be found and the next   *
+ *             checkpoint stores every record.                                                 *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+void CheckpointClass::Sort_Records(void)
+{
+	if (SortedMax < RecordCount) {
+		delete [] Sorted;
+		Sorted = new RecordType[RecordMax];
+		SortedMax = (Sorted != NULL) ? RecordMax : 0;
+	}
+	if (Sorted == NULL) return;
+
+	memcpy(Sorted, Records, RecordCount * sizeof(RecordType));
+	qsort(Sorted, RecordCount, sizeof(RecordType), Compare_Records);
+}
+
+
+/***********************************************************************************************
+ * CheckpointClass::Find -- Finds the record with a key in the current image.                  *
+ *                                                                                             *
+ * INPUT:   key   -- The key of the record to find.                                            *
+ *                                                                                             *
+ * OUTPUT:  Returns with a pointer to the record, or NULL if there is none with that key.      *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+CheckpointClass::RecordType const * CheckpointClass::Find(uint32_t key) const
+{
+	if (Sorted == NULL || SortedMax < RecordCount) return(NULL);
+
+	int low = 0;
+	int high = RecordCount;
+	while (low < high) {
+		int middle = (low + high) / 2;
+		if (Sorted[middle].Key < key) {
+			low = middle + 1;
+		} else {
+			high = middle;
+		}
+	}
+	if (low < RecordCount && Sorted[low].Key == key) {
+		return(&Sorted[low]);
+	}
+	return(NULL);
+}
+
+
+/***********************************************************************************************
+ * CheckpointClass::Write -- Writes a base or delta checkpoint of the captured image.          *
+ *                                                                                             *
+ *    The image is split into its records, and each record is compared against the record      *
+ *    with the same key in the previous checkpoint. Only the records that differ, or that the  *
+ *    previous checkpoint did not have, are stored. If there is no previous checkpoint or the  *
+ *    chain has grown too long, then a full base checkpoint is written instead and any stale   *
+ *    deltas are removed.                                                                      *
+ *                                                                                             *
+ * INPUT:   version  -- The save game version to stamp into the checkpoint.                    *
+ *                                                                                             *
+ *          net      -- Is this a multiplayer game image?                                      *
+ *                                                                                             *
+ *          frame    -- The game frame that the image was taken at.                            *
+ *                                                                                             *
+ * OUTPUT:  bool; Was the checkpoint written?                                                  *
+ *                                                                                             *
+ * WARNINGS:   The image must have been captured with Capture.                                 *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *   10/19/2026 AGT : Writes through a temporary file; records the frame.                      *
+ *   10/19/2026 AGT : Compares records by key rather than pages by position.                   *
+ *=============================================================================================*/
+bool CheckpointClass::Write(unsigned long version, int net, long frame)
+{
+	char const * data = (char const *)Captured.Get_Buffer();
+	int size = Captured.Get_Length();
+	if (data == NULL || size <= 0) return(false);
+
+	bool base = (Sequence < 0 || Sequence >= MAX_CHAIN || net != IsNet);
+
+	/*
+	**	The records of the new image are kept in the scratch list until the checkpoint is
+	**	safely written.
+	*/
+	ScratchCount = 0;
+	if (!Split(data, size, ScratchRecords, ScratchCount, ScratchRecordMax)) return(false);
+
+	CRCEngine crc;
+	crc(data, size);
+
+	CheckpointHeader header;
+	memset(&header, '\0', sizeof(header));
+	header.ID = CHECKPOINT_ID;
+	header.Version = version;
+	header.Sequence = base ? 0 : Sequence + 1;
+	header.Size = size;
+	header.RecordCount = ScratchCount;
+	header.Net = net;
+	header.Frame = frame;
+	header.ParentCRC = base ? 0 : ImageCRC;
+	header.CRC = crc();
+
+	/*
+	**	Compress the records into memory, so that the whole file can be written out and
+	**	checked in one go.
+	*/
+	int changed = 0;
+	Buffer.Reset();
+	{
+		LZOPipe pipe(LZOPipe::COMPRESS, CHECKPOINT_BLOCK_SIZE);
+		pipe.Put_To(Buffer);
+		uint32_t lastkey = 0;
+		for (int index = 0; index < ScratchCount; index++) {
+			RecordType const & record = ScratchRecords[index];
+			uint32_t key = record.Key - lastkey;
+			lastkey = record.Key;
+			int32_t length = record.Length;
+			if (!base) {
+				RecordType const * old = Find(record.Key);
+				if (old != NULL && old->Length == record.Length && memcmp(Image + old->Offset, data + record.Offset, record.Length) == 0) {
+					length = -1;
+				}
+			}
+			pipe.Put(&key, sizeof(key));
+			pipe.Put(&length, sizeof(length));
+			if (length >= 0) {
+				pipe.Put(data + record.Offset, record.Length);
+				changed++;
+			}
+		}
+		pipe.Flush();
+		pipe.End();
+	}
+
+	/*
+	**	If the file could not be written, the chain on disk is just as it was, so the image
+	**	it ends with is kept too. The next checkpoint will try again against that image.
+	*/
+	if (!Write_File(header)) {
+		return(false);
+	}
+
+	/*
+	**	A new base invalidates the whole chain. Remove the old deltas so they can never be
+	**	mistaken for part of this chain. This is done only once the new base is safely in
+	**	place; any delta left behind by a crash before then fails its parent CRC check.
+	*/
+	if (base) {
+		char name[_MAX_FNAME+_MAX_EXT];
+		for (int sequence = 1; sequence <= MAX_CHAIN; sequence++) {
+			File_Name(name, sequence);
+			RawFileClass old(name);
+			if (old.Is_Available()) {
+				old.Delete();
+			}
+		}
+	}
+
+	/*
+	**	Retain the image and its records so that the next checkpoint can be compared
+	**	against it.
+	*/
+	if (!Reserve(Image, MaxSize, size)) {
+		Sequence = -1;
+		return(false);
+	}
+	memcpy(Image, data, size);
+
+	RecordType * temp = Records;
+	Records = ScratchRecords;
+	ScratchRecords = temp;
+	int tempcount = RecordMax;
+	RecordMax = ScratchRecordMax;
+	ScratchRecordMax = tempcount;
+	RecordCount = ScratchCount;
+	Sort_Records();
+
+	Size = size;
+	ImageCRC = header.CRC;
+	Sequence = header.Sequence;
+	IsNet = net;
+	Frame = frame;
+	Changed = changed;
+	return(true);
+}
+
+
+/***********************************************************************************************
+ * CheckpointClass::Write_File -- Writes a checkpoint file in place of any older one.          *
+ *                                                                                             *
+ *    The header and the compressed records are written to a temporary file. Only once every   *
+ *    byte of it is known to have been written is it renamed over the checkpoint file, so a    *
+ *    crash or a full disk part way through never leaves a damaged checkpoint behind.          *
+ *                                                                                             *
+ * INPUT:   header   -- The header of the checkpoint. The records are in the buffer.           *
+ *                                                                                             *
+ * OUTPUT:  bool; Was the checkpoint file written?                                             *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+bool CheckpointClass::Write_File(CheckpointHeader const & header)
+{
+	char tempname[_MAX_FNAME+_MAX_EXT];
+	char name[_MAX_FNAME+_MAX_EXT];
+	sprintf(tempname, "%s.TMP", Name);
+	File_Name(name, header.Sequence);
+
+	RawFileClass file(tempname);
+	bool ok = (file.Open(WRITE) != 0);
+	if (ok) {
+		ok = (file.Write(&header, sizeof(header)) == sizeof(header));
+		if (ok && Buffer.Get_Length() > 0) {
+			ok = (file.Write(Buffer.Get_Buffer(), Buffer.Get_Length()) == Buffer.Get_Length());
+		}
+		file.Close();
+	}
+
+	if (ok) {
+		ok = file.Rename(name);
+	}
+
+	if (!ok) {
+		file.Delete();
+	}
+	return(ok);
+}
+
+
+/***********************************************************************************************
+ * CheckpointClass::Apply -- Builds an image from the records of a checkpoint file.            *
+ *                                                                                             *
+ *    The new image is built in the scratch image, and its records in the scratch list. A      *
+ *    record that is the same as in the parent image is copied from the current image.         *
+ *                                                                                             *
+ * INPUT:   straw    -- The source of the (decompressed) records.                              *
+ *                                                                                             *
+ *          header   -- The header of the checkpoint file being applied.                       *
+ *                                                                                             *
+ * OUTPUT:  bool; Were all the records read successfully, and do they make up the whole        *
+ *                image?                                                                       *
+ *                                                                                             *
+ * WARNINGS:   The scratch image must be at least as large as the size in the header.          *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *   10/19/2026 AGT : Reads records by key rather than pages by position.                      *
+ *=============================================================================================*/
+bool CheckpointClass::Apply(Straw & straw, CheckpointHeader const & header)
+{
+	ScratchCount = 0;
+	int pos = 0;
+	uint32_t key = 0;
+	for (int index = 0; index < header.RecordCount; index++) {
+		uint32_t step;
+		int32_t length;
+		if (straw.Get(&step, sizeof(step)) != sizeof(step) || straw.Get(&length, sizeof(length)) != sizeof(length)) {
+			return(false);
+		}
+		key += step;
+
+		if (length == -1) {
+			RecordType const * old = (header.Sequence > 0) ? Find(key) : NULL;
+			if (old == NULL || old->Length > header.Size - pos) {
+				return(false);
+			}
+			memcpy(Scratch + pos, Image + old->Offset, old->Length);
+			length = old->Length;
+		} else {
+			if (length < 0 || length > header.Size - pos || straw.Get(Scratch + pos, length) != length) {
+				return(false);
+			}
+		}
+
+		if (!Add_Record(ScratchRecords, ScratchCount, ScratchRecordMax, key, pos, length)) {
+			return(false);
+		}
+		pos += length;
+	}
+	return(pos == header.Size);
+}
+
+
+/***********************************************************************************************
+ * CheckpointClass::Read -- Reconstructs the latest image from the checkpoint chain.           *
+ *                                                                                             *
+ *    The base checkpoint is read and then each delta that follows it is applied in order.     *
+ *    The chain ends at the first delta that is missing, was made against a different image,   *
+ *    or fails its CRC check. The image up to that point remains valid.                        *
+ *                                                                                             *
+ * INPUT:   version  -- The save game version that the checkpoints must match.                 *
+ *                                                                                             *
+ *          maxframe -- Checkpoints taken after this game frame are not applied.               *
+ *                                                                                             *
+ * OUTPUT:  bool; Was at least the base checkpoint read successfully?                          *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *   10/19/2026 AGT : Added maxframe.                                                          *
+ *=============================================================================================*/
+bool CheckpointClass::Read(unsigned long version, long maxframe)
+{
+	Sequence = -1;
+
+	for (int sequence = 0; sequence <= MAX_CHAIN; sequence++) {
+		char name[_MAX_FNAME+_MAX_EXT];
+		File_Name(name, sequence);
+
+		RawFileClass file(name);
+		if (!file.Is_Available()) break;
+
+		FileStraw fstraw(file);
+		CheckpointHeader header;
+		if (fstraw.Get(&header, sizeof(header)) != sizeof(header)) break;
+
+		if (header.ID != CHECKPOINT_ID || header.Version != (uint32_t)version || header.Sequence != sequence || header.Size <= 0) break;
+		if (header.Frame > maxframe) break;
+		if (sequence > 0 && (header.ParentCRC != ImageCRC || header.Net != IsNet)) break;
+
+		/*
+		**	Build the new image in the scratch buffer, taking the records that did not
+		**	change from the current image.
+		*/
+		if (!Reserve(Scratch, ScratchMax, header.Size)) break;
+
+		LZOStraw straw(LZOStraw::DECOMPRESS, CHECKPOINT_BLOCK_SIZE);
+		straw.Get_From(fstraw);
+		if (!Apply(straw, header)) break;
+
+		CRCEngine crc;
+		crc(Scratch, header.Size);
+		if (crc() != header.CRC) break;
+
+		/*
+		**	The delta is good, so make it the current image.
+		*/
+		char * temp = Image;
+		Image = Scratch;
+		Scratch = temp;
+		int tempmax = MaxSize;
+		MaxSize = ScratchMax;
+		ScratchMax = tempmax;
+
+		RecordType * temprecords = Records;
+		Records = ScratchRecords;
+		ScratchRecords = temprecords;
+		tempmax = RecordMax;
+		RecordMax = ScratchRecordMax;
+		ScratchRecordMax = tempmax;
+		RecordCount = ScratchCount;
+		Sort_Records();
+
+		Size = header.Size;
+		ImageCRC = header.CRC;
+		IsNet = header.Net;
+		Frame = header.Frame;
+		Sequence = sequence;
+	}
+
+	return(Sequence >= 0);
+}
@@ -0,0 +1,205 @@
+/*
+**	Command & Conquer Red Alert(tm)
+**	Copyright 2025 Electronic Arts Inc.
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/***********************************************************************************************
+ *                                                                                             *
+ *                 Project Name : Command & Conquer                                            *
+ *                                                                                             *
+ *                    File Name : CHECKPNT.H                                                   *
+ *                                                                                             *
+ *                   Start Date : 10/19/26                                                     *
+ *                                                                                             *
+ *                  Last Update : October 19, 2026                                             *
+ *                                                                                             *
+ *---------------------------------------------------------------------------------------------*
+ * Functions:                                                                                  *
+ * - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+#ifndef CHECKPNT_H
+#define CHECKPNT_H
+
+#include	<limits.h>
+#include	<stdint.h>
+#include	"straw.h"
+#include	"ex_string.h"
+
+
+/*
+**	This manages a chain of checkpoint files. A checkpoint is the complete save game data image
+**	(as produced by Put_All). As the image is captured, the tables of keyed records in it (the
+**	map cells and the objects in each heap) are marked, and the image is split into records
+**	keyed by table and cell or heap slot. The data between the tables is split into records
+**	keyed by where it lies. The first checkpoint in a chain stores every record in full. Each
+**	one after that stores only the records that differ from the record with the same key in
+**	the previous checkpoint, so an object being added or removed does not make everything
+**	after it look changed. Loading reads the base image and applies each delta in sequence.
+**	Every delta records the CRC of the image it was made against so that a stale or partially
+**	written file simply ends the chain rather than corrupting the reconstructed image.
+*/
+class CheckpointClass
+{
+	public:
+		enum CheckpointEnum {
+			CHUNK_SIZE=1024,		// Size the data between the tables is split into.
+			MAX_TABLES=32,			// Tables of keyed records that can be marked.
+			MAX_CHAIN=30			// Deltas allowed before a new base is written.
+		};
+
+		CheckpointClass(char const * name="CHECKPNT");
+		~CheckpointClass(void);
+
+		Pipe & Capture(void);
+		void Mark_Table(int keysize, int recordsize, int skip=0);
+		bool Write(unsigned long version, int net, long frame);
+		bool Read(unsigned long version, long maxframe=LONG_MAX);
+		void Reset(void) {Sequence = -1;}
+
+		void const * Get_Image(void) const {return(Image);}
+		int Get_Size(void) const {return(Size);}
+		int Get_Sequence(void) const {return(Sequence);}
+		int Get_Records(void) const {return(RecordCount);}
+		int Get_Changed(void) const {return(Changed);}
+		int Is_Net(void) const {return(IsNet);}
+		long Get_Frame(void) const {return(Frame);}
+
+	private:
+
+		/*
+		**	Each checkpoint file starts with this header. It is followed by a compressed stream
+		**	of records in image order. Each record is its key (less the key of the record before
+		**	it, which compresses better) and length followed by its data, or by nothing when it
+		**	is the same as the record with that key in the parent image (its length is then -1). The fields are all of fixed size so that the files read back the same on
+		**	any platform.
+		*/
+		typedef struct {
+			uint32_t ID;
+			uint32_t Version;
+			int32_t Sequence;
+			int32_t Size;
+			int32_t RecordCount;
+			int32_t Net;
+			int32_t Frame;
+			int32_t ParentCRC;
+			int32_t CRC;
+		} CheckpointHeader;
+
+		/*
+		**	A table of keyed records marked in the image being captured. At the offset is the
+		**	count of records, and then each record: its key followed by the rest of it.
+		*/
+		typedef struct {
+			int Offset;
+			int KeySize;
+			int RecordSize;
+		} TableType;
+
+		/*
+		**	Where one record lies in an image. The top byte of the key is the table number
+		**	(zero for the data between the tables) and the rest is the key within the table.
+		*/
+		typedef struct {
+			uint32_t Key;
+			int Offset;
+			int Length;
+		} RecordType;
+
+		void File_Name(char * buffer, int sequence) const;
+		bool Apply(Straw & straw, CheckpointHeader const & header);
+		bool Reserve(char * & image, int & max, int size);
+		bool Add_Record(RecordType * & records, int & count, int & max, uint32_t key, int offset, int length);
+		bool Add_Chunks(RecordType * & records, int & count, int & max, int span, int start, int end);
+		bool Split(char const * image, int size, RecordType * & records, int & count, int & max) const;
+		void Sort_Records(void);
+		static int Compare_Records(void const * left, void const * right);
+		RecordType const * Find(uint32_t key) const;
+		bool Write_File(CheckpointHeader const & header);
+
+		/*
+		**	The base name of the checkpoint files.
+		*/
+		char Name[_MAX_FNAME];
+
+		/*
+		**	The image being captured for the next checkpoint, and the tables marked in it.
+		*/
+		DynamicBufferPipe Captured;
+		TableType Tables[MAX_TABLES];
+		int TableCount;
+
+		/*
+		**	The image of the most recent checkpoint written or read, and the records it is
+		**	split into, in image order and sorted by key. New checkpoints are compared against
+		**	this to determine which records have changed.
+		*/
+		char * Image;
+		int Size;
+		int MaxSize;
+		RecordType * Records;
+		RecordType * Sorted;
+		int RecordCount;
+		int RecordMax;
+		int SortedMax;
+
+		/*
+		**	Scratch image and records used while applying or writing a checkpoint, so that a
+		**	damaged file can be rejected without losing the last good image.
+		*/
+		char * Scratch;
+		int ScratchMax;
+		RecordType * ScratchRecords;
+		int ScratchCount;
+		int ScratchRecordMax;
+
+		/*
+		**	Sequence number of the last checkpoint in the chain. A value of -1 means there
+		**	is no base checkpoint and the next write will produce one.
+		*/
+		int Sequence;
+
+		/*
+		**	The number of records whose data the last checkpoint written had to store.
+		*/
+		int Changed;
+
+		/*
+		**	CRC of the current image. This is the parent CRC of the next delta.
+		*/
+		int32_t ImageCRC;
+
+		/*
+		**	Was the image taken from a network (multiplayer) game?
+		*/
+		int IsNet;
+
+		/*
+		**	The game frame that the current image was taken at.
+		*/
+		long Frame;
+
+		/*
+		**	The records of the checkpoint being written are compressed into this before
+		**	any of the file is written.
+		*/
+		DynamicBufferPipe Buffer;
+
+		CheckpointClass(CheckpointClass const & rvalue);
+		CheckpointClass & operator = (CheckpointClass const & rvalue);
+};
+
+
+#endif
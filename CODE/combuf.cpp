@@ -47,6 +47,8 @@
  *   CommBufferClass::Avg_Response_Time -- returns average response time  	*
  *   CommBufferClass::Max_Response_Time -- returns max response time  		*
  *   CommBufferClass::Reset_Response_Time -- resets computations				*
+ *   CommBufferClass::Percentile_Response_Time -- response time percentile	*
+ *   CommBufferClass::Response_Jitter -- returns response time jitter		*
  *   Mono_Debug_Print -- Debug output routine                              *
  * - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
 
@@ -201,6 +203,11 @@ void CommBufferClass::Init(void)
 	MeanDelay = 0L;
 	MaxDelay = 0L;
 
+	memset(DelayHistogram, 0, sizeof(DelayHistogram));
+	HistogramTotal = 0L;
+	LastDelay = 0L;
+	Jitter16 = 0L;
+
 	SendCount = 0;
 
 	ReceiveCount = 0;
@@ -213,6 +220,7 @@ void CommBufferClass::Init(void)
 		SendQueue[i].IsACK = 0;
 		SendQueue[i].FirstTime = 0L;
 		SendQueue[i].LastTime = 0L;
+		SendQueue[i].AckTime = 0L;
 		SendQueue[i].SendCount = 0L;
 		SendQueue[i].BufLen = 0;
 		SendQueue[i].ExtraLen = 0;
@@ -273,6 +281,7 @@ void CommBufferClass::Init_Send_Queue(void)
 		SendQueue[i].IsACK = 0;
 		SendQueue[i].FirstTime = 0L;
 		SendQueue[i].LastTime = 0L;
+		SendQueue[i].AckTime = 0L;
 		SendQueue[i].SendCount = 0L;
 		SendQueue[i].BufLen = 0;
 		SendQueue[i].ExtraLen = 0;
@@ -333,6 +342,7 @@ int CommBufferClass::Queue_Send(void *buf, int buflen, void *extrabuf,
 	SendQueue[index].IsACK = 0;				// entry hasn't been ACK'd
 	SendQueue[index].FirstTime = 0L;			// filled in by Manager when sent
 	SendQueue[index].LastTime = 0L;			// filled in by Manager when sent
+	SendQueue[index].AckTime = 0L;			// filled in when ACK arrives
 	SendQueue[index].SendCount = 0L;			// filled in by Manager when sent
 	SendQueue[index].BufLen = buflen;		// save buffer size
 
@@ -428,6 +438,7 @@ int CommBufferClass::UnQueue_Send(void *buf, int *buflen, int index,
 	SendQueue[SendIndex[index]].IsACK = 0;
 	SendQueue[SendIndex[index]].FirstTime = 0L;
 	SendQueue[SendIndex[index]].LastTime = 0L;
+	SendQueue[SendIndex[index]].AckTime = 0L;
 	SendQueue[SendIndex[index]].SendCount = 0L;
 	SendQueue[SendIndex[index]].BufLen = 0;
 	SendQueue[SendIndex[index]].ExtraLen = 0;
@@ -692,6 +703,7 @@ ReceiveQueueType * CommBufferClass::Get_Receive(int index)
  *                                                                         *
  * HISTORY:                                                                *
  *   01/19/1995 BR : Created.                                              *
+ *   10/19/2026 AGT : Publishes the delay to the metrics registry.         *
  *=========================================================================*/
 void CommBufferClass::Add_Delay(unsigned long delay)
 {
@@ -714,6 +726,39 @@ void CommBufferClass::Add_Delay(unsigned long delay)
 		MaxDelay = delay;
 	}
 
+	/*------------------------------------------------------------------------
+	Update the jitter estimate; each new sample moves it 1/16th of the way.
+	------------------------------------------------------------------------*/
+	if (HistogramTotal > 0) {
+		long diff = (long)delay - (long)LastDelay;
+		if (diff < 0) {
+			diff = -diff;
+		}
+		Jitter16 = Jitter16 + diff - (Jitter16 >> 4);
+	}
+	LastDelay = delay;
+
+	/*------------------------------------------------------------------------
+	Add the delay to the histogram, aging out the old samples first.
+	------------------------------------------------------------------------*/
+	if (HistogramTotal >= HISTORY_COUNT) {
+		HistogramTotal = 0;
+		for (int i = 0; i < HISTOGRAM_SIZE; i++) {
+			DelayHistogram[i] >>= 1;
+			HistogramTotal += DelayHistogram[i];
+		}
+	}
+	DelayHistogram[MIN(delay, (unsigned long)HISTOGRAM_SIZE - 1)]++;
+	HistogramTotal++;
+
+	/*------------------------------------------------------------------------
+	Publish the delay, in seconds, to the metrics registry.
+	------------------------------------------------------------------------*/
+	if (Metrics.IsActive) {
+		Metrics.Observe(HISTOGRAM_NETWORK_RTT, delay / 60.0);
+		Metrics.Set(METRIC_RESPONSE_TIME, MeanDelay / 60.0);
+	}
+
 }	/* end of Add_Delay */
 
 
@@ -783,9 +828,84 @@ void CommBufferClass::Reset_Response_Time(void)
 	MeanDelay = 0L;
 	MaxDelay = 0L;
 
+	memset(DelayHistogram, 0, sizeof(DelayHistogram));
+	HistogramTotal = 0L;
+	LastDelay = 0L;
+	Jitter16 = 0L;
+
 }	/* end of Reset_Response_Time */
 
 
+/***************************************************************************
+ * CommBufferClass::Percentile_Response_Time -- response time percentile	*
+ *                                                                         *
+ * INPUT:                                                                  *
+ *		percent		percentile to find (1-100)											*
+ *                                                                         *
+ * OUTPUT:                                                                 *
+ *		smallest response time that at least 'percent' percent of recent		*
+ *		responses were within; 0 if there are no samples yet						*
+ *                                                                         *
+ * WARNINGS:                                                               *
+ *		none.																						*
+ *                                                                         *
+ * HISTORY:                                                                *
+ *   10/19/2026 AGT : Created.                                             *
+ *=========================================================================*/
+unsigned long CommBufferClass::Percentile_Response_Time(int percent)
+{
+	unsigned long needed;
+	unsigned long count = 0;
+	int i;
+
+	if (HistogramTotal == 0) {
+		return(0);
+	}
+
+	needed = (HistogramTotal * percent + 99) / 100;
+
+	for (i = 0; i < HISTOGRAM_SIZE - 1; i++) {
+		count += DelayHistogram[i];
+		if (count >= needed) {
+			break;
+		}
+	}
+
+	/*------------------------------------------------------------------------
+	The last bucket holds every delay that's too long to count individually;
+	the longest one seen is the best estimate we have.
+	------------------------------------------------------------------------*/
+	if (i == HISTOGRAM_SIZE - 1) {
+		return(MAX(MaxDelay, (unsigned long)i));
+	}
+
+	return(i);
+
+}	/* end of Percentile_Response_Time */
+
+
+/***************************************************************************
+ * CommBufferClass::Response_Jitter -- returns response time jitter			*
+ *                                                                         *
+ * INPUT:                                                                  *
+ *		none.																						*
+ *                                                                         *
+ * OUTPUT:                                                                 *
+ *		smoothed difference between consecutive response times, in ticks		*
+ *                                                                         *
+ * WARNINGS:                                                               *
+ *		none.																						*
+ *                                                                         *
+ * HISTORY:                                                                *
+ *   10/19/2026 AGT : Created.                                             *
+ *=========================================================================*/
+unsigned long CommBufferClass::Response_Jitter(void)
+{
+	return((Jitter16 + 8) >> 4);
+
+}	/* end of Response_Jitter */
+
+
 /***************************************************************************
  * CommBufferClass::Configure_Debug -- sets up special debug values        *
  *                                                                         *
@@ -63,6 +63,7 @@ typedef struct {
 	unsigned int IsACK		: 1;	// 1 = ACK received for this packet
 	unsigned long FirstTime;		// time this packet was first sent
 	unsigned long LastTime;			// time this packet was last sent
+	unsigned long AckTime;			// time the ACK arrived; 0 = not recorded
 	unsigned long SendCount;		// # of times this packet has been sent
 	int BufLen;							// size of the packet stored in this entry
 	char *Buffer;						// the data packet
@@ -132,6 +133,8 @@ class CommBufferClass
 		unsigned long Avg_Response_Time(void);	// gets mean response time
 		unsigned long Max_Response_Time(void);	// gets max response time
 		void Reset_Response_Time(void);			// resets computations
+		unsigned long Percentile_Response_Time(int percent);	// from histogram
+		unsigned long Response_Jitter(void);	// smoothed delay variation
 
 		/*
 		........................ Debug output routines ........................
@@ -161,6 +164,22 @@ class CommBufferClass
 		unsigned long MeanDelay;			// current average delay time
 		unsigned long MaxDelay;				// max delay ever for this queue
 
+		/*
+		....................... Response time distribution ......................
+		Each bucket counts delays of that many ticks; the last one counts all
+		longer delays.  Counts are halved once HISTORY_COUNT samples have been
+		added, so old line conditions age out.  The jitter is the smoothed
+		difference between consecutive delays, times 16.
+		*/
+		enum {
+			HISTOGRAM_SIZE = 128,
+			HISTORY_COUNT = 256
+		};
+		unsigned short DelayHistogram[HISTOGRAM_SIZE];
+		unsigned long HistogramTotal;		// # samples in histogram
+		unsigned long LastDelay;			// previous delay, for jitter
+		unsigned long Jitter16;				// jitter estimate * 16
+
 		/*
 		........................ Send Queue variables .........................
 		*/
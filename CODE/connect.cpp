@@ -132,6 +132,8 @@ ConnectionClass::ConnectionClass (int numsend, int numreceive,
 	------------------------------------------------------------------------*/
 	Queue = new CommBufferClass (numsend, numreceive, MaxPacketLen, extralen);
 
+	PacketTime = 0;
+
 }	/* end of ConnectionClass */
 
 
@@ -186,6 +188,8 @@ void ConnectionClass::Init (void)
 	LastSeqID = 0xffffffff;
 	LastReadID = 0xffffffff;
 
+	PacketTime = 0;
+
 	Queue->Init();
 
 }	/* end of Init */
@@ -315,6 +319,7 @@ int ConnectionClass::Receive_Packet (void * buf, int buflen)
 				if (packet->PacketID==entry_data->PacketID &&
 					entry_data->Code == PACKET_DATA_ACK) {
 					send_entry->IsACK = 1;
+					send_entry->AckTime = PacketTime;
 					break;
 				}
 			}
@@ -618,7 +623,16 @@ int ConnectionClass::Service_Send_Queue (void)
 			..................................................................*/
 			packet_hdr = (CommHeaderType *)send_entry->Buffer;
 			if (packet_hdr->Code == PACKET_DATA_ACK) {
-				Queue->Add_Delay(Time() - send_entry->FirstTime);
+				/*...............................................................
+				Use the arrival time of the ACK if the transport recorded it;
+				otherwise the ACK is timed when it is found here, as it always
+				has been.
+				...............................................................*/
+				if (send_entry->AckTime) {
+					Queue->Add_Delay(send_entry->AckTime - send_entry->FirstTime);
+				} else {
+					Queue->Add_Delay(Time() - send_entry->FirstTime);
+				}
 			}
 
 			/*..................................................................
@@ -176,6 +176,12 @@ class ConnectionClass
 		.....................................................................*/
 		static unsigned long Time (void);
 
+		/*.....................................................................
+		Sets the arrival time of the packet about to be passed to
+		Receive_Packet; zero means it arrived just now.
+		.....................................................................*/
+		void Set_Packet_Time (unsigned long time) { PacketTime = time; }
+
 		/*.....................................................................
 		Utility routines.
 		.....................................................................*/
@@ -270,6 +276,12 @@ class ConnectionClass
 		.....................................................................*/
 		uint32_t LastReadID;
 
+		/*.....................................................................
+		Arrival time of the packet being received, if the transport recorded
+		it (zero if not); ACK'd packets use this to compute the response time.
+		.....................................................................*/
+		unsigned long PacketTime;
+
 		/*.....................................................................
 		Names of all packet commands
 		.....................................................................*/
@@ -127,6 +127,8 @@ class ConnManClass
 		.....................................................................*/
 		virtual void Reset_Response_Time(void) = 0;
 		virtual unsigned long Response_Time(void) = 0;
+		virtual unsigned long Percentile_Response_Time(int) {return (Response_Time());}
+		virtual unsigned long Response_Jitter(void) {return (0);}
 		virtual void Set_Timing (unsigned long retrydelta,
 			unsigned long maxretries, unsigned long timeout) = 0;
 
@@ -427,6 +427,13 @@ void Main_Game(int argc, char * argv[])
 		}
 #endif	//WIN32
 
+		/*
+		**	A regression run is over once the recording has been played back.
+		*/
+		if (Regression.IsActive) {
+			Emergency_Exit(Regression.Finish());
+		}
+
 		/*
 		**	Scenario is done; fade palette to black
 		*/
@@ -445,6 +452,7 @@ void Main_Game(int argc, char * argv[])
 		*/
 		if (Session.Record || Session.Play) {
 			Session.RecordFile.Close();
+			Replay.Clear();
 		}
 
 		if (Session.Type == GAME_NULL_MODEM || Session.Type == GAME_MODEM) {
@@ -833,6 +841,19 @@ void Keyboard_Process(KeyNumType & input)
 		input = KN_NONE;
 	}
 
+	/*
+	**	Starts the profiler, or stops it and writes out what it recorded.
+	*/
+	if (key != 0 && key == Options.KeyProfile) {
+		if (Profiler.IsActive) {
+			Profiler.Stop();
+			Profiler.Dump(PROFILE_FILE_NAME);
+		} else {
+			Profiler.Start();
+		}
+		input = KN_NONE;
+	}
+
 	/*
 	**	Scrolls the sidebar up one slot.
 	*/
@@ -2090,6 +2111,7 @@ FacingType KN_To_Facing(int input)
  * HISTORY:                                                                                    *
  *   01/04/1995 JLB : Created.                                                                 *
  *   03/06/1995 JLB : Fixed.                                                                   *
+ *   10/19/2026 AGT : Hands playback keys to the replay seeker.                                *
  *=============================================================================================*/
 static void Sync_Delay(void)
 {
@@ -2097,6 +2119,7 @@ static void Sync_Delay(void)
 	**	Accumulate the number of 'spare' ticks that are frittered away here.
 	*/
 	SpareTicks += FrameTimer;
+	Metrics.Add(METRIC_SPARE_TICKS, FrameTimer);
 
 	/*
 	**	Delay until the frame timer expires. This forces the game loop to be regulated to a
@@ -2113,7 +2136,12 @@ static void Sync_Delay(void)
 			KeyNumType input = KN_NONE;
 			int x, y;
 			Map.Input(input, x, y);
-			if (input) {
+
+			/*
+			**	The keys that move a playback are handed on, since this is where they are
+			**	read when the playback waits out the frame delay.
+			*/
+			if (input && !(Session.Play && Replay.Key(input))) {
 				Keyboard_Process(input);
 			}
 			Map.Render();
@@ -2207,7 +2235,7 @@ Mono_Set_Cursor(0,0);
 	**	Setup the timer so that the Main_Loop function processes at the correct rate.
 	*/
 	if (Session.Type != GAME_NORMAL && Session.Type != GAME_SKIRMISH &&
-		Session.CommProtocol == COMM_PROTOCOL_MULTI_E_COMP) {
+		Session.CommProtocol >= COMM_PROTOCOL_MULTI_E_COMP) {
 
 		//
 		// In playback mode, run as fast as possible.
@@ -2232,6 +2260,14 @@ Mono_Set_Cursor(0,0);
 		}
 	}
 
+	/*
+	**	A regression run plays back as fast as possible, whatever the game type, as does a
+	**	playback that is being run ahead to the frame it was asked to seek to.
+	*/
+	if (Regression.IsActive || Replay.Is_Seeking()) {
+		FrameTimer = 0;
+	}
+
 	/*
 	**	Update the display, unless we're inside a dialog.
 	*/
@@ -2310,6 +2346,25 @@ Mono_Set_Cursor(0,0);
 
 	Call_Back();
 
+	/*
+	**	Write a crash recovery checkpoint if one is due. Only the pages of the game state
+	**	that changed since the last checkpoint are written. Checkpoints are due on game
+	**	frames rather than on the clock, so that every player in a multiplayer game takes
+	**	them on the same frames and can be put back to the same one after a lost connection.
+	*/
+	if (Options.CheckpointInterval > 0 && !Session.Play && Frame > 0 &&
+		(Frame % (Options.CheckpointInterval * TICKS_PER_SECOND)) == 0) {
+		Save_Checkpoint();
+	}
+
+	/*
+	**	A regression run ends with the game; there is no one to show the score to.
+	*/
+	if (Regression.IsActive && (PlayerWins || PlayerLoses || PlayerRestarts)) {
+		GameActive = false;
+		return(!GameActive);
+	}
+
 	/*
 	**	Check for player wins or loses according to global event flag.
 	*/
@@ -2455,6 +2510,8 @@ Mono_Set_Cursor(0,0);
 #endif
 
 	BEnd(BENCH_GAME_FRAME);
+	if (Profiler.IsActive) Profiler.Frame();
+	Metrics.Frame();
 
 	Sync_Delay();
 	return(!GameActive);
@@ -5095,6 +5152,8 @@ bool Force_CD_Available(int cd)
  *                                                                                             *
  * HISTORY:                                                                                    *
  *   08/15/1995 BRR : Created.                                                                 *
+ *   10/19/2026 AGT : Draws nothing in a regression run.                                       *
+ *   10/19/2026 AGT : Draws nothing while seeking.                                             *
  *=============================================================================================*/
 static void Do_Record_Playback(void)
 {
@@ -5226,9 +5285,13 @@ Session.RecordFile.Read (&FormMove, sizeof(FormMove));
 Session.RecordFile.Read (&FormSpeed, sizeof(FormSpeed));
 Session.RecordFile.Read (&FormMaxSpeed, sizeof(FormMaxSpeed));
 		/*
-		**	The map isn't drawn in playback mode, so draw it here.
+		**	The map isn't drawn in playback mode, so draw it here. A regression run draws
+		**	nothing, so that its timings are of the game logic alone, and neither does a
+		**	playback that is catching up to the frame it was asked to seek to.
 		*/
-		Map.Render();
+		if (!Regression.IsActive && !Replay.Is_Seeking()) {
+			Map.Render();
+		}
 	}
 }
 
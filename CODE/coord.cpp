@@ -46,6 +46,7 @@
  *   Distance -- Determines the cell distance between two cells.                               *
  *   Distance -- Determines the lepton distance between two coordinates.                       *
  *   Distance -- Fetch distance between two target values.                                     *
+ *   Distance_List -- Determines the lepton distance from a coordinate to a list of others.    *
  *   Fixed_To_Cardinal -- Converts a fixed point number into a cardinal number.                *
  *   Normal_Move_Point -- Moves point with tilt compensation.                                  *
  * - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
@@ -53,6 +54,11 @@
 #include	"function.h"
 #include "coord.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define COORD_SSE2 1
+#endif
+
 
 /***********************************************************************************************
  * Coord_Cell -- Convert a coordinate into a cell number.                                      *
@@ -137,6 +143,68 @@ int Distance(COORDINATE coord1, COORDINATE coord2)
 }
 
 
+/***********************************************************************************************
+ * Distance_List -- Determines the lepton distance from a coordinate to a list of others.      *
+ *                                                                                             *
+ *    This gives the same result as calling Distance() for each coordinate in the list, but    *
+ *    works on four coordinates at a time where SSE2 is available. Use it when a scan needs    *
+ *    the distance to many objects and can gather their coordinates first.                     *
+ *                                                                                             *
+ * INPUT:   coord     -- The coordinate to measure the distances from.                         *
+ *                                                                                             *
+ *          list      -- Pointer to the coordinates to measure the distances to.               *
+ *                                                                                             *
+ *          distances -- Pointer to the array to store the lepton distances into. It must      *
+ *                       have room for one distance per coordinate in the list.                *
+ *                                                                                             *
+ *          count     -- The number of coordinates in the list.                                *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+void Distance_List(COORDINATE coord, COORDINATE const * list, int * distances, int count)
+{
+	int index = 0;
+
+#ifdef COORD_SSE2
+	/*
+	**	The X and Y components are split into 32 bit lanes, so that the differences and
+	**	the sum cannot overflow. The larger of the two differences plus half the smaller
+	**	is the same sum that Distance() makes, whichever of them is the larger.
+	*/
+	__m128i const low = _mm_set1_epi32(0xFFFF);
+	__m128i const x1 = _mm_set1_epi32(Coord_X(coord));
+	__m128i const y1 = _mm_set1_epi32(Coord_Y(coord));
+
+	for (; index + 4 <= count; index += 4) {
+		__m128i coords = _mm_loadu_si128((__m128i const *)&list[index]);
+
+		__m128i xdiff = _mm_sub_epi32(_mm_and_si128(coords, low), x1);
+		__m128i ydiff = _mm_sub_epi32(_mm_srli_epi32(coords, 16), y1);
+
+		__m128i sign = _mm_srai_epi32(xdiff, 31);
+		xdiff = _mm_sub_epi32(_mm_xor_si128(xdiff, sign), sign);
+		sign = _mm_srai_epi32(ydiff, 31);
+		ydiff = _mm_sub_epi32(_mm_xor_si128(ydiff, sign), sign);
+
+		__m128i ybigger = _mm_cmpgt_epi32(ydiff, xdiff);
+		__m128i bigger = _mm_or_si128(_mm_and_si128(ybigger, ydiff), _mm_andnot_si128(ybigger, xdiff));
+		__m128i smaller = _mm_or_si128(_mm_and_si128(ybigger, xdiff), _mm_andnot_si128(ybigger, ydiff));
+
+		_mm_storeu_si128((__m128i *)&distances[index], _mm_add_epi32(bigger, _mm_srli_epi32(smaller, 1)));
+	}
+#endif
+
+	for (; index < count; index++) {
+		distances[index] = Distance(coord, list[index]);
+	}
+}
+
+
 /***********************************************************************************************
  * Coord_Spillage_List -- Determines the offset list for cell spillage/occupation.             *
  *                                                                                             *
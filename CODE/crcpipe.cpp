@@ -34,7 +34,9 @@
  *---------------------------------------------------------------------------------------------*
  * Functions:                                                                                  *
  *   CRCPipe::Result -- Fetches the current CRC of the data.                                   *
+ *   CRCPipe::Commit -- Process the CRC with the data written and send it on.                  *
  *   CRCPipe::Put -- Retrieves the data bytes specified and calculates CRC on it.              *
+ *   CRCPipe::Reserve -- Fetch space to write data to in the pipe.                             *
  * - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
 
 
@@ -88,3 +90,65 @@ long CRCPipe::Result(void) const
 	return(CRC());
 }
 
+
+/***********************************************************************************************
+ * CRCPipe::Reserve -- Fetch space to write data to in the pipe.                               *
+ *                                                                                             *
+ *    The space is passed along from the pipe segment that this one feeds. The data written    *
+ *    there is submitted to the CRC processor when it is committed.                            *
+ *                                                                                             *
+ * INPUT:   buffer   -- Reference to the pointer that will be set to the start of the space.   *
+ *                                                                                             *
+ *          slen     -- The number of bytes of space requested.                                *
+ *                                                                                             *
+ * OUTPUT:  Returns with the number of bytes that may be written. Zero means that Put must be  *
+ *          used instead.                                                                      *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+int CRCPipe::Reserve(void * & buffer, int slen)
+{
+	buffer = NULL;
+	Space = NULL;
+	SpaceLength = 0;
+	if (ChainTo == NULL || slen < 1) {
+		return(0);
+	}
+
+	SpaceLength = ChainTo->Reserve(buffer, slen);
+	Space = buffer;
+	return(SpaceLength);
+}
+
+
+/***********************************************************************************************
+ * CRCPipe::Commit -- Process the CRC with the data written and send it on.                    *
+ *                                                                                             *
+ *    The data is processed right where it was written, then committed to the pipe segment     *
+ *    that this one feeds.                                                                     *
+ *                                                                                             *
+ * INPUT:   slen     -- The number of bytes written to the reserved space.                     *
+ *                                                                                             *
+ * OUTPUT:  Returns with the actual number of bytes output at the far distant final link in    *
+ *          the pipe chain.                                                                    *
+ *                                                                                             *
+ * WARNINGS:   Only space handed out by the last call to Reserve may be committed.             *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+int CRCPipe::Commit(int slen)
+{
+	if (ChainTo == NULL || Space == NULL || slen < 1) {
+		return(0);
+	}
+	if (slen > SpaceLength) slen = SpaceLength;
+
+	CRC(Space, slen);
+	Space = NULL;
+	SpaceLength = 0;
+	return(ChainTo->Commit(slen));
+}
@@ -49,8 +49,10 @@
 class CRCPipe : public Pipe
 {
 	public:
-		CRCPipe(void) {}
+		CRCPipe(void) : Space(NULL), SpaceLength(0) {}
 		virtual int Put(void const * source, int slen);
+		virtual int Reserve(void * & buffer, int slen);
+		virtual int Commit(int slen);
 
 		// Fetch the CRC value.
 		long Result(void) const;
@@ -59,6 +61,13 @@ class CRCPipe : public Pipe
 		CRCEngine CRC;
 
 	private:
+		/*
+		**	The space last handed out by Reserve. The data is run through the CRC
+		**	as it is committed.
+		*/
+		void * Space;
+		int SpaceLength;
+
 		CRCPipe(CRCPipe & rvalue);
 		CRCPipe & operator = (CRCPipe const & pipe);
 };
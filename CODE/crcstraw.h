@@ -49,8 +49,10 @@
 class CRCStraw : public Straw
 {
 	public:
-		CRCStraw(void) {}
+		CRCStraw(void) : View(NULL), ViewLength(0) {}
 		virtual int Get(void * source, int slen);
+		virtual int Peek(void const * & buffer, int slen);
+		virtual int Consume(int slen);
 
 		// Calculate and return the CRC value.
 		long Result(void) const;
@@ -59,6 +61,13 @@ class CRCStraw : public Straw
 		CRCEngine CRC;
 
 	private:
+		/*
+		**	The view last handed out by Peek. The data is run through the CRC as it
+		**	is consumed.
+		*/
+		void const * View;
+		int ViewLength;
+
 		CRCStraw(CRCStraw & rvalue);
 		CRCStraw & operator = (CRCStraw const & pipe);
 };
@@ -487,6 +487,7 @@ typedef enum DiffType {
 #define FAME_FILE_NAME			"HALLFAME.DAT"
 #define NET_SAVE_FILE_NAME		"SAVEGAME.NET"
 #define CONFIG_FILE_NAME		"REDALERT.INI"
+#define PROFILE_FILE_NAME		"PROFILE.JSON"
 
 
 /**********************************************************************
@@ -2745,12 +2746,69 @@ typedef enum BenchType {
 } BenchType;
 
 
+/*
+**	Runtime metrics that the game publishes for monitoring. The counters only ever go up,
+**	while the gauges hold the latest value.
+*/
+typedef enum MetricType {
+	METRIC_FRAMES,					// Game frames processed (counter).
+	METRIC_SPARE_TICKS,			// Ticks spent waiting for the frame timer (counter).
+	METRIC_PATH_COUNT,			// Find path calls (counter).
+	METRIC_TARGET_SCAN,			// Target scans (counter).
+	METRIC_CELL_COUNT,			// Cells drawn (counter).
+	METRIC_SIDEBAR_REDRAWS,		// Sidebar redraws (counter).
+
+	METRIC_FRAMES_PER_SECOND,	// Frame rate over the last publish interval (gauge).
+	METRIC_RESPONSE_TIME,		// Average network response time in seconds (gauge).
+	METRIC_UNITS,					// Objects in each heap (gauges).
+	METRIC_INFANTRY,
+	METRIC_BUILDINGS,
+	METRIC_AIRCRAFT,
+	METRIC_VESSELS,
+	METRIC_BULLETS,
+	METRIC_ANIMS,
+	METRIC_TERRAINS,
+	METRIC_TEAMS,
+	METRIC_TRIGGERS,
+	METRIC_FACTORIES,
+
+	METRIC_COUNT,
+	METRIC_FIRST=0
+} MetricType;
+
+/*
+**	Runtime metrics that are published as a distribution of the values seen.
+*/
+typedef enum HistogramType {
+	HISTOGRAM_FRAME_TIME,		// Time from one game frame to the next.
+	HISTOGRAM_FINDPATH_TIME,	// Time taken by each find path call.
+	HISTOGRAM_NETWORK_RTT,		// Time for a network packet to be acknowledged.
+
+	HISTOGRAM_COUNT,
+	HISTOGRAM_FIRST=0
+} HistogramType;
+
+
+/*
+**	The result of restoring the game from the crash recovery checkpoints.
+*/
+typedef enum CheckpointLoadType {
+	CHECKPOINT_NONE,				// No usable checkpoint; the game was left as it was.
+	CHECKPOINT_LOADED,			// The game was restored from the checkpoint.
+	CHECKPOINT_FAILED				// The game was cleared but could not be restored.
+} CheckpointLoadType;
+
+
+/*
+**	The benchmarks are always recorded by the profiler when it is running, and are also
+**	kept as running averages for the debug display when the cheat keys are compiled in.
+*/
 #ifdef CHEAT_KEYS
-#define	BStart(a)	if (Benches != NULL) Benches[a].Begin()
-#define	BEnd(a)		if (Benches != NULL) Benches[a].End()
+#define	BStart(a)	do {if (Benches != NULL) Benches[a].Begin(); if (Profiler.IsActive) Profiler.Begin(a);} while (false)
+#define	BEnd(a)		do {if (Benches != NULL) Benches[a].End(); if (Profiler.IsActive) Profiler.End(a);} while (false)
 #else
-#define	BStart(a)
-#define	BEnd(a)
+#define	BStart(a)	do {if (Profiler.IsActive) Profiler.Begin(a);} while (false)
+#define	BEnd(a)		do {if (Profiler.IsActive) Profiler.End(a);} while (false)
 #endif
 
 
@@ -320,6 +320,7 @@ void DisplayClass::Init_IO(void)
  * HISTORY:                                                                                    *
  *   03/17/1995 BRR : Created.                                                                 *
  *   05/07/1996 JLB : Added translucent tables.                                                *
+ *   10/19/2026 AGT : Flushes the terrain cache.                                               *
  *=============================================================================================*/
 void DisplayClass::Init_Theater(TheaterType theater)
 {
@@ -374,6 +375,11 @@ void DisplayClass::Init_Theater(TheaterType theater)
 	*/
 	Scen.Theater = theater;
 
+	/*
+	**	The cached terrain images were drawn with the old theater's imagery.
+	*/
+	TerrainCache.Flush();
+
 	/*
 	** Unload old mixfiles, and cache the new ones
 	*/
@@ -313,6 +313,7 @@ template class DynamicVectorClass<char *>;
 template class DynamicVectorClass<unsigned char *>;
 template class DynamicVectorClass<char const*>;
 template class DynamicVectorClass<void *>;
+template class DynamicVectorClass<unsigned long>;
 
 #ifdef WINSOCK_IPX
 template class DynamicVectorClass<WinsockInterfaceClass::WinsockBufferType *>;
@@ -157,6 +157,10 @@ extern CCINIClass					RuleINI;
 extern CCINIClass					AftermathINI;
 #endif
 extern Benchmark *				Benches;
+extern ProfilerClass				Profiler;
+extern MetricsClass				Metrics;
+extern RegressionClass			Regression;
+extern ReplayClass				Replay;
 extern int							MapTriggerID;
 extern int							LogicTriggerID;
 extern PKey							FastKey;
@@ -194,6 +198,7 @@ extern MapEditClass 				Map;
 #else
 extern MouseClass 				Map;
 #endif
+extern TerrainCacheClass			TerrainCache;
 extern ScoreClass 				Score;
 extern MonoClass 					MonoArray[DMONO_COUNT];
 extern MFCD *						TheaterData;
@@ -418,6 +423,9 @@ extern GraphicBufferClass	HidPage;
 extern int 						MenuList[][8];
 extern CDTimerClass<SystemTimerClass> FrameTimer;
 extern CDTimerClass<SystemTimerClass> CountDownTimer;
+extern CheckpointClass			Checkpoint;
+extern bool						RecoverCheckpoint;
+extern char const *			SelfTestName;
 
 extern SpecialDialogType	SpecialDialog;
 
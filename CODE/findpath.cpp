@@ -461,8 +461,10 @@ PathType * FootClass::Find_Path(CELL dest, FacingType * final_moves, int maxlen,
 	if (!final_moves) return(NULL);
 
 	BStart(BENCH_FINDPATH);
+	double start = Metrics.IsActive ? MetricsClass::Now() : 0;
 
 	PathCount++;
+	Metrics.Add(METRIC_PATH_COUNT);
 
 	if (Team && Team->Class->IsRoundAbout) {
 		unit_threat			= (Team) ? Team->Risk : Risk();
@@ -746,6 +748,7 @@ end_of_list:
 		Optimize_Moves(&path, threshhold);
 	#endif
 
+	if (Metrics.IsActive) Metrics.Observe(HISTOGRAM_FINDPATH_TIME, MetricsClass::Now() - start);
 	BEnd(BENCH_FINDPATH);
 
 	return(&path);
@@ -196,11 +196,13 @@ class TPoint2D
 #include	"pipe.h"
 #include	"xpipe.h"
 #include	"ramfile.h"
+#include	"checkpnt.h"
 #include	"lcw.h"
 #include	"lzw.h"
 #include	"lcwpipe.h"
 #include	"lzwpipe.h"
 #include	"lzopipe.h"
+#include	"parpipe.h"
 #include	"crcpipe.h"
 #include	"shapipe.h"
 #include	"b64pipe.h"
@@ -210,6 +212,7 @@ class TPoint2D
 #include	"lcwstraw.h"
 #include	"lzwstraw.h"
 #include	"lzostraw.h"
+#include	"parstraw.h"
 #include	"crcstraw.h"
 #include	"shastraw.h"
 #include	"rndstraw.h"
@@ -284,6 +287,10 @@ extern long Frame;
 #include	"utracker.h"
 #include	"crate.h"
 #include	"rules.h"
+#include	"profiler.h"
+#include	"metrics.h"
+#include	"regress.h"
+#include	"replay.h"
 #include	"ini.h"
 #include	"int.h"
 #include	"pk.h"
@@ -325,6 +332,7 @@ extern long Frame;
 #include	"gscreen.h"
 #include	"map.h"
 #include	"display.h"
+#include	"tcache.h"
 #include	"radar.h"
 #include	"power.h"
 #include	"sidebar.h"
@@ -547,6 +555,7 @@ DirType Direction256(COORDINATE coord1, COORDINATE coord2);
 DirType Direction8(COORDINATE coord1, COORDINATE coord2);
 int Distance(COORDINATE coord1, COORDINATE coord2);
 int Distance(TARGET target1, TARGET target2);
+void Distance_List(COORDINATE coord, COORDINATE const * list, int * distances, int count);
 short const * Coord_Spillage_List(COORDINATE coord, int maxsize);
 
 /*
@@ -842,8 +851,13 @@ bool Load_MPlayer_Values(Straw & file);
 bool Save_MPlayer_Values(Pipe & file);
 bool Get_Savefile_Info(int id, char * buf, unsigned * scenp, HousesType * housep);
 bool Load_Game(int id);
+CheckpointLoadType Load_Checkpoint(int net, long maxframe=LONG_MAX);
 bool Read_Object (void * ptr, int base_size, int class_size, FileClass & file, void * vtable);
 bool Save_Game(int id, char const * descr, bool bargraph=false);
+bool Save_Checkpoint(void);
+bool Save_Emergency_Game(char const * descr);
+void Save_Snapshot(Pipe & pipe);
+bool Load_Snapshot(Straw & straw);
 bool Write_Object (void * ptr, int class_size, FileClass & file);
 void Code_All_Pointers(void);
 void Decode_All_Pointers(void);
@@ -875,6 +889,11 @@ void Bit_It_In(int x, int y, int w, int h, GraphicBufferClass *src, GraphicBuffe
 void Call_Back_Delay(int time);
 int Alloc_Object(ScoreAnimClass *obj);
 
+/*
+**	SELFTEST.CPP
+*/
+int Self_Test(char const * name);
+
 /*
 **	SPECIAL.CPP
 */
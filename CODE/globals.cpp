@@ -247,6 +247,30 @@ CCINIClass AftermathINI;
 */
 Benchmark * Benches;
 
+/***************************************************************************
+**	This records the benchmarked scopes of every frame when it is turned on,
+**	in any version of the game.
+*/
+ProfilerClass Profiler;
+
+/***************************************************************************
+**	This is the registry of runtime metrics. It is published to a file when
+**	one is named in the options.
+*/
+MetricsClass Metrics;
+
+/***************************************************************************
+**	This runs a recorded game as a regression benchmark, when one is named
+**	on the command line.
+*/
+RegressionClass Regression;
+
+/***************************************************************************
+**	This keeps snapshots of a recorded game as it plays back, so that the
+**	playback can seek to any frame.
+*/
+ReplayClass Replay;
+
 
 /***************************************************************************
 **	General rules that control the game.
@@ -443,6 +467,11 @@ MapEditClass Map;
 MouseClass Map;
 #endif
 
+/***************************************************************************
+**	This holds the finished images of the terrain cells on the tactical map.
+*/
+TerrainCacheClass TerrainCache;
+
 
 /**************************************************************************
 **	The running game score is handled by this class (and member functions).
@@ -747,6 +776,13 @@ GraphicBufferClass & VisiblePage = SeenBuff;
 int 						SoundOn;
 CDTimerClass<SystemTimerClass> FrameTimer;
 CDTimerClass<SystemTimerClass> CountDownTimer;
+CheckpointClass Checkpoint;
+bool RecoverCheckpoint = false;
+
+/*
+**	The self test to run instead of the game (an empty name runs them all), or NULL to play.
+*/
+char const * SelfTestName = NULL;
 
 NewConfigType NewConfig;
 TheaterType LastTheater = THEATER_NONE;	//Lets us know when theater type changes.
@@ -38,13 +38,16 @@
  *   FixedHeapClass::FixedHeapClass -- Normal constructor for heap management class.           *
  *   FixedHeapClass::Free -- Frees a sub-block in the heap.                                    *
  *   FixedHeapClass::Free_All -- Frees all objects in the fixed heap.                          *
+ *   FixedHeapClass::Grow -- Adds more sub-blocks to the heap.                                 *
  *   FixedHeapClass::ID -- Converts a pointer to a sub-block index number.                     *
+ *   FixedHeapClass::Segment_Ptr -- Fetches a sub-block that is past the first buffer.         *
  *   FixedHeapClass::Set_Heap -- Assigns a memory block for this heap manager.                 *
  *   FixedHeapClass::~FixedHeapClass -- Destructor for the heap manager class.                 *
  *   FixedIHeapClass::Allocate -- Allocate an object from the heap.                            *
  *   FixedIHeapClass::Clear -- Clears the fixed heap of all entries.                           *
  *   FixedIHeapClass::Free -- Frees an object in the heap.                                     *
  *   FixedIHeapClass::Free_All -- Frees all objects out of the indexed heap.                   *
+ *   FixedIHeapClass::Grow -- Adds more objects to the heap.                                   *
  *   FixedIHeapClass::Logical_ID -- Fetches the logical ID number.                             *
  *   FixedIHeapClass::Set_Heap -- Set the heap to the buffer provided.                         *
  *   TFixedIHeapClass::Code_Pointers -- codes pointers for every object, to prepare for save   *
@@ -84,7 +87,9 @@ FixedHeapClass::FixedHeapClass(int size) :
 	Size(size),
 	TotalCount(0),
 	ActiveCount(0),
-	Buffer(0)
+	Buffer(0),
+	GrowthStep(0),
+	BufferCount(0)
 {
 }
 
@@ -164,6 +169,7 @@ int FixedHeapClass::Set_Heap(int count, void * buffer)
 		}
 		Buffer = buffer;
 		TotalCount = count;
+		BufferCount = count;
 		return(true);
 	}
 	return(false);
@@ -175,7 +181,8 @@ int FixedHeapClass::Set_Heap(int count, void * buffer)
  *                                                                                             *
  *    Finds the first available sub-block in the heap and returns a pointer to it. The sub-    *
  *    block is marked as allocated by this routine. If there are no more sub-blocks            *
- *    available, then this routine will return NULL.                                           *
+ *    available, then the heap will grow if it is allowed to. Otherwise this routine will      *
+ *    return NULL.                                                                             *
  *                                                                                             *
  * INPUT:   none                                                                               *
  *                                                                                             *
@@ -188,6 +195,10 @@ int FixedHeapClass::Set_Heap(int count, void * buffer)
  *=============================================================================================*/
 void * FixedHeapClass::Allocate(void)
 {
+	if (ActiveCount == TotalCount && GrowthStep > 0) {
+		Grow();
+	}
+
 	if (ActiveCount < TotalCount) {
 		int index = FreeFlag.First_False();
 
@@ -254,7 +265,22 @@ int FixedHeapClass::Free(void * pointer)
 int FixedHeapClass::ID(void const * pointer) const
 {
 	if (pointer && Size) {
-		return((int)(((char *)pointer - (char *)Buffer) / Size));
+		long offset = (char *)pointer - (char *)Buffer;
+
+		/*
+		**	Look through the buffers added as the heap grew if the sub-block is not in
+		**	the first one.
+		*/
+		if (Segments.Count() > 0 && (offset < 0 || offset >= (long)BufferCount * Size)) {
+			for (int segment = 0; segment < Segments.Count(); segment++) {
+				offset = (char *)pointer - (char *)Segments[segment];
+				if (offset >= 0 && offset < (long)GrowthStep * Size) {
+					return(BufferCount + (segment * GrowthStep) + (int)(offset / Size));
+				}
+			}
+			return(-1);
+		}
+		return((int)(offset / Size));
 	}
 	return(-1);
 }
@@ -288,7 +314,16 @@ void FixedHeapClass::Clear(void)
 	IsAllocated = false;
 	ActiveCount = 0;
 	TotalCount = 0;
+	BufferCount = 0;
 	FreeFlag.Clear();
+
+	/*
+	**	Free any buffers that were added as the heap grew.
+	*/
+	for (int index = 0; index < Segments.Count(); index++) {
+		delete[] (char *)Segments[index];
+	}
+	Segments.Clear();
 }
 
 
@@ -315,6 +350,68 @@ int FixedHeapClass::Free_All(void)
 }
 
 
+/***********************************************************************************************
+ * FixedHeapClass::Grow -- Adds more sub-blocks to the heap.                                   *
+ *                                                                                             *
+ *    This adds another buffer to the heap, holding the number of sub-blocks specified by the  *
+ *    growth step. They follow on from the heap's last sub-block, so existing sub-blocks keep  *
+ *    both their address and their ID number.                                                  *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  bool; Did the heap grow? It never grows past GROWTH_LIMIT sub-blocks.              *
+ *                                                                                             *
+ * WARNINGS:   The heap must already have been given its first buffer with Set_Heap().         *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+int FixedHeapClass::Grow(void)
+{
+	if (GrowthStep <= 0 || !Size || !BufferCount) return(false);
+	if (TotalCount + GrowthStep > GROWTH_LIMIT) return(false);
+
+	char * segment = new char[GrowthStep * Size];
+	if (segment == NULL) return(false);
+
+	if (!FreeFlag.Resize(TotalCount + GrowthStep)) {
+		delete[] segment;
+		return(false);
+	}
+	Segments.Add(segment);
+	TotalCount += GrowthStep;
+	return(true);
+}
+
+
+/***********************************************************************************************
+ * FixedHeapClass::Segment_Ptr -- Fetches a sub-block that is past the first buffer.           *
+ *                                                                                             *
+ *    Sub-blocks that were added as the heap grew are found in the buffer that holds them by   *
+ *    this routine. The index operator takes care of those in the first buffer by itself.      *
+ *                                                                                             *
+ * INPUT:   index -- The ID number of the sub-block.                                           *
+ *                                                                                             *
+ * OUTPUT:  Returns with a pointer to the sub-block.                                           *
+ *                                                                                             *
+ * WARNINGS:   An index past the end of the heap gets the same (invalid) pointer as it did     *
+ *             before heaps could grow.                                                        *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+char * FixedHeapClass::Segment_Ptr(int index) const
+{
+	if (index >= BufferCount && Segments.Count() > 0) {
+		int segment = (index - BufferCount) / GrowthStep;
+		if (segment < Segments.Count()) {
+			return(((char *)Segments[segment]) + (((index - BufferCount) % GrowthStep) * Size));
+		}
+	}
+	return(((char *)Buffer) + (index * Size));
+}
+
+
 /////////////////////////////////////////////////////////////////////
 
 
@@ -360,6 +457,7 @@ void FixedIHeapClass::Clear(void)
 {
 	FixedHeapClass::Clear();
 	ActivePointers.Clear();
+	ActiveIndex.Clear();
 }
 
 
@@ -386,7 +484,7 @@ int FixedIHeapClass::Set_Heap(int count, void * buffer)
 	// avoid reallocating if possible
 	// this is a workaround to prevent use-after-free errors in rule loading
 	void *reuse_buf = NULL;
-	if(count == TotalCount && !buffer && IsAllocated) {
+	if(count == BufferCount && !buffer && IsAllocated) {
 		reuse_buf = buffer = Buffer;
 		Buffer = NULL;
 	}
@@ -395,6 +493,7 @@ int FixedIHeapClass::Set_Heap(int count, void * buffer)
 
 	if (FixedHeapClass::Set_Heap(count, buffer)) {
 		ActivePointers.Resize(count);
+		ActiveIndex.Resize(count);
 
 		if(reuse_buf)
 			IsAllocated = true;
@@ -404,6 +503,32 @@ int FixedIHeapClass::Set_Heap(int count, void * buffer)
 }
 
 
+/***********************************************************************************************
+ * FixedIHeapClass::Grow -- Adds more objects to the heap.                                     *
+ *                                                                                             *
+ *    This grows the heap, and makes room for the new objects in the active pointer tracking   *
+ *    arrays as well.                                                                          *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  bool; Did the heap grow?                                                           *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+int FixedIHeapClass::Grow(void)
+{
+	if (FixedHeapClass::Grow()) {
+		ActivePointers.Resize(TotalCount);
+		ActiveIndex.Resize(TotalCount);
+		return(true);
+	}
+	return(false);
+}
+
+
 /***********************************************************************************************
  * FixedIHeapClass::Allocate -- Allocate an object from the heap.                              *
  *                                                                                             *
@@ -423,6 +548,7 @@ void * FixedIHeapClass::Allocate(void)
 {
 	void * ptr = FixedHeapClass::Allocate();
 	if (ptr)	{
+		ActiveIndex[ID(ptr)] = ActivePointers.Count();
 		ActivePointers.Add(ptr);
 		memset (ptr, 0, Size);
 	}
@@ -445,11 +571,24 @@ void * FixedIHeapClass::Allocate(void)
  *                                                                                             *
  * HISTORY:                                                                                    *
  *   02/21/1995 JLB : Created.                                                                 *
+ *   10/19/2026 AGT : Finds the object from where it was placed; moves the rest with memmove.  *
  *=============================================================================================*/
 int FixedIHeapClass::Free(void * pointer)
 {
 	if (FixedHeapClass::Free(pointer)) {
-		ActivePointers.Delete(pointer);
+		int index = Logical_ID(pointer);
+		if (index != -1) {
+
+			/*
+			**	Move the pointers that follow it down to fill the hole, so that the active
+			**	objects stay in the same order.
+			*/
+			int count = ActivePointers.Count() - 1;
+			if (index < count) {
+				memmove(&ActivePointers[index], &ActivePointers[index+1], (count - index) * sizeof(void *));
+			}
+			ActivePointers.Delete(count);
+		}
 	}
 	return(false);
 }
@@ -468,16 +607,46 @@ int FixedIHeapClass::Free(void * pointer)
  *          be used as a regular index into the heap until such time as the heap has been      *
  *          compacted (by some means or another) without modifying the block order.            *
  *                                                                                             *
- * WARNINGS:   Runs in linear time.                                                            *
+ * WARNINGS:   none                                                                            *
  *                                                                                             *
  * HISTORY:                                                                                    *
  *   05/06/1996 JLB : Created.                                                                 *
+ *   10/19/2026 AGT : Starts the search from where the object was placed.                      *
+ *   10/19/2026 AGT : Records where the object was found.                                      *
  *=============================================================================================*/
 int FixedIHeapClass::Logical_ID(void const * pointer) const
 {
 	if (pointer != NULL) {
-		for (int index = 0; index < Count(); index++) {
-			if (Active_Ptr(index) == pointer) {
+		int count = ActivePointers.Count();
+
+		/*
+		**	An object's pointer only ever moves down the active pointer array, as the objects
+		**	ahead of it are freed. Searching back from where it was last seen finds it after
+		**	no more steps than there have been such objects freed since.
+		*/
+		int start = count - 1;
+		int id = ID(pointer);
+		bool known = ((unsigned)id < (unsigned)TotalCount);
+		if (known && (unsigned)ActiveIndex[id] < (unsigned)start) {
+			start = ActiveIndex[id];
+		}
+
+		/*
+		**	Where the object is found is recorded, so the next search for it starts there.
+		*/
+		for (int index = start; index >= 0; index--) {
+			if (ActivePointers[index] == pointer) {
+				if (known) ActiveIndex[id] = index;
+				return(index);
+			}
+		}
+
+		/*
+		**	It can only be further on if the array was rearranged directly.
+		*/
+		for (int index = start+1; index < count; index++) {
+			if (ActivePointers[index] == pointer) {
+				if (known) ActiveIndex[id] = index;
 				return(index);
 			}
 		}
@@ -540,6 +709,7 @@ int TFixedIHeapClass<T>::Save(Pipe & file) const
  *                                                                                             *
  * HISTORY:                                                                                    *
  *   03/15/1995 BRR : Created.                                                                 *
+ *   10/19/2026 AGT : Grows the heap as needed, up to GROWTH_LIMIT.                            *
  *=============================================================================================*/
 template<class T>
 int TFixedIHeapClass<T>::Load(Straw & file)
@@ -559,7 +729,7 @@ int TFixedIHeapClass<T>::Load(Straw & file)
 	/*
 	** Error if more objects than we can hold
 	*/
-	if (a_count > TotalCount) {
+	if (a_count < 0 || (a_count > TotalCount && (GrowthStep <= 0 || a_count > GROWTH_LIMIT))) {
 		return(false);
 	}
 
@@ -574,12 +744,27 @@ int TFixedIHeapClass<T>::Load(Straw & file)
 			return(false);
 		}
 
+		/*
+		** Grow the heap if the object was in a part that was added as it grew. An index
+		** that is out of range, or past where any heap could have grown, means the saved
+		** data is bad.
+		*/
+		if (idx < 0 || (idx >= TotalCount && idx >= GROWTH_LIMIT)) {
+			return(false);
+		}
+		while (idx >= TotalCount) {
+			if (!Grow()) {
+				return(false);
+			}
+		}
+
 		/*
 		** Get a pointer to the object, activate that object
 		*/
 		ptr = (T *)(*this)[idx];
 		FreeFlag[idx] = true;
 		ActiveCount++;
+		ActiveIndex[idx] = ActivePointers.Count();
 		ActivePointers.Add(ptr);
 
 		/*
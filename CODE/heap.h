@@ -60,8 +60,8 @@ class TFixedHeapClass : public FixedHeapClass
 		virtual T * Alloc(void) {return (T*)FixedHeapClass::Allocate();};
 		virtual int Free(T * pointer) {return(FixedHeapClass::Free(pointer));};
 
-		T & operator[](int index) {return *(T *)(((char *)Buffer) + (index * Size));};
-		T const & operator[](int index) const {return *(T*)(((char *)Buffer) + (index * Size));};
+		T & operator[](int index) {return *(T *)FixedHeapClass::operator[](index);};
+		T const & operator[](int index) const {return *(T const *)FixedHeapClass::operator[](index);};
 };
 
 
@@ -95,6 +95,16 @@ class FixedIHeapClass : public FixedHeapClass
 		**	performed.
 		*/
 		DynamicVectorClass<void *> ActivePointers;
+
+		/*
+		**	For each sub-block, this is where its pointer was last seen in the active
+		**	pointer array: where it was placed when allocated, or where Logical_ID last
+		**	found it. It can only have moved down from there.
+		*/
+		mutable VectorClass<int> ActiveIndex;
+
+	protected:
+		virtual int Grow(void);
 };
 
 
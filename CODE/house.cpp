@@ -7625,6 +7625,7 @@ void HouseClass::Update_Spied_Power_Plants(void)
  * HISTORY:                                                                                    *
  *   11/01/1996 JLB : Created.                                                                 *
  *   11/04/1996 JLB : Not so strict on zone requirement.                                       *
+ *   10/19/2026 AGT : Checks each cell once and skips cells farther than the best.             *
  *=============================================================================================*/
 CELL HouseClass::Find_Cell_In_Zone(TechnoClass const * techno, ZoneType zone) const
 {
@@ -7644,14 +7645,27 @@ CELL HouseClass::Find_Cell_In_Zone(TechnoClass const * techno, ZoneType zone) co
 		list = techno->Occupy_List(true);
 	}
 
+	/*
+	**	Record which cells could be part of the foundation. Each cell is then only checked once,
+	**	rather than once for every placement that would cover it.
+	*/
+	static unsigned char _clear[MAP_CELL_TOTAL];
+	for (CELL cell = 0; cell < MAP_CELL_TOTAL; cell++) {
+		_clear[cell] = ttype->Is_Clear_Foundation(cell);
+	}
+
 	/*
 	**	Find a legal placement position as close as possible to the picked location while still
-	**	remaining within the zone.
+	**	remaining within the zone. Positions that are no closer than the best one found so far
+	**	are not checked any further.
 	*/
 	for (CELL cell = 0; cell < MAP_CELL_TOTAL; cell++) {
 //		if (Map.In_Radar(cell)) {
 		if (Map.In_Radar(cell) && Which_Zone(cell) != ZONE_NONE) {
-			bool ok = ttype->Legal_Placement(cell);
+			int dist = Distance(Cell_Coord(cell), Cell_Coord(trycell));
+			if (bestval != -1 && dist >= bestval) continue;
+
+			bool ok = ttype->Legal_Placement(cell, _clear);
 
 			/*
 			**	Another (adjacency) check is required for buildings.
@@ -7661,11 +7675,8 @@ CELL HouseClass::Find_Cell_In_Zone(TechnoClass const * techno, ZoneType zone) co
 			}
 
 			if (ok) {
-				int dist = Distance(Cell_Coord(cell), Cell_Coord(trycell));
-				if (bestval == -1 || dist < bestval) {
-					bestval = dist;
-					bestcell = cell;
-				}
+				bestval = dist;
+				bestcell = cell;
 			}
 		}
 	}
@@ -33,30 +33,41 @@
  *                                                                                             *
  *---------------------------------------------------------------------------------------------*
  * Functions:                                                                                  *
+ *   INIClass::Add_Entry -- Attach an entry to a section.                                      *
+ *   INIClass::Add_Section -- Create a new, empty section.                                     *
+ *   INIClass::Allocate -- Allocate memory from the INI database arena.                        *
  *   INIClass::Clear -- Clears out a section (or all sections) of the INI data.                *
+ *   INIClass::Duplicate -- Copy a string into the INI database arena.                         *
  *   INIClass::Entry_Count -- Fetches the number of entries in a specified section.            *
  *   INIClass::Find_Entry -- Find specified entry within section.                              *
+ *   INIClass::Find_Entry -- Finds a specified entry and returns pointer to it.                *
  *   INIClass::Find_Section -- Find the specified section within the INI data.                 *
  *   INIClass::Get_Bool -- Fetch a boolean value for the section and entry specified.          *
  *   INIClass::Get_Entry -- Get the entry identifier name given ordinal number and section name*
  *   INIClass::Get_Fixed -- Fetch a fixed point number from the section & entry.               *
- *   INIClass::Put_Fixed -- Store a fixed point number to the INI database.                    *
  *   INIClass::Get_Hex -- Fetches integer [hex format] from the section and entry specified.   *
  *   INIClass::Get_Int -- Fetch an integer entry from the specified section.                   *
  *   INIClass::Get_PKey -- Fetch a key from the ini database.                                  *
  *   INIClass::Get_String -- Fetch the value of a particular entry in a specified section.     *
  *   INIClass::Get_TextBlock -- Fetch a block of normal text.                                  *
  *   INIClass::Get_UUBlock -- Fetch an encoded block from the section specified.               *
- *   INIClass::INISection::Find_Entry -- Finds a specified entry and returns pointer to it.    *
+ *   INIClass::Grow_Entries -- Rebuild the entry hash table with more room.                    *
+ *   INIClass::Grow_Sections -- Rebuild the section hash table with more room.                 *
+ *   INIClass::Index_Entry -- Enter an entry into the entry hash table.                        *
+ *   INIClass::Index_Section -- Enter a section into the section hash table.                   *
+ *   INIClass::Link_Section -- Attach a section to the INI database.                           *
  *   INIClass::Load -- Load INI data from the file specified.                                  *
  *   INIClass::Load -- Load the INI data from the data stream (straw).                         *
  *   INIClass::Put_Bool -- Store a boolean value into the INI database.                        *
+ *   INIClass::Put_Fixed -- Store a fixed point number to the INI database.                    *
  *   INIClass::Put_Hex -- Store an integer into the INI database, but use a hex format.        *
  *   INIClass::Put_Int -- Stores a signed integer into the INI data base.                      *
  *   INIClass::Put_PKey -- Stores the key to the INI database.                                 *
  *   INIClass::Put_String -- Output a string to the section and entry specified.               *
  *   INIClass::Put_TextBlock -- Stores a block of text into an INI section.                    *
  *   INIClass::Put_UUBlock -- Store a binary encoded data block into the INI database.         *
+ *   INIClass::Remove_Entry -- Detach an entry from its section.                               *
+ *   INIClass::Remove_Section -- Detach a section and all its entries.                         *
  *   INIClass::Save -- Save the ini data to the file specified.                                *
  *   INIClass::Save -- Saves the INI data to a pipe stream.                                    *
  *   INIClass::Section_Count -- Counts the number of sections in the INI data.                 *
@@ -69,6 +80,7 @@
 #include	<stddef.h>
 #include	<stdio.h>
 #include	<ctype.h>
+#include	<new>
 #include	"ini.h"
 #include	"readline.h"
 #include	"xpipe.h"
@@ -77,16 +89,59 @@
 #include	"b64straw.h"
 
 
-#ifdef FIXIT_FAST_LOAD
-#include	"cstraw.h"
-#endif
-
 
 
 // Disable the "temporary object used to initialize a non-constant reference" warning.
 #pragma warning 665 9
 
 
+/*
+**	Hash table slots that held a removed section or entry are marked with this value so
+**	that probing carries on past them.
+*/
+static void * const REMOVED_SLOT = (void *)1;
+
+
+/*
+**	Fold the name CRC (and, for entries, the owning section) into a table position. The
+**	caller masks it to the table size.
+*/
+static inline unsigned Hash_Slot(int crc, void const * owner)
+{
+	unsigned hash = (unsigned)crc ^ (unsigned)((size_t)owner >> 4) * 0x9E3779B1U;
+	return(hash ^ (hash >> 16));
+}
+
+
+/*
+**	Fetch the next line from the text loaded into memory. The line is NUL terminated and
+**	trimmed in place, just the way Read_Line() would deliver it from the straw.
+*/
+static char * Next_Line(char * & text, char * end, int len, bool & eof)
+{
+	char * line = text;
+	char * newline = (char *)memchr(text, '\x0A', end - text);
+	if (newline == NULL) {
+		eof = true;
+		text = end;
+		*end = '\0';
+		return(end);
+	}
+	text = newline + 1;
+
+	int count = 0;
+	for (char * ptr = line; ptr < newline; ptr++) {
+		if (*ptr != '\x0D' && count+1 < len) {
+			line[count++] = *ptr;
+		}
+	}
+	line[count] = '\0';
+
+	strtrim(line);
+	return(line);
+}
+
+
 /***********************************************************************************************
  * INIClass::~INIClass -- Destructor for INI handler.                                          *
  *                                                                                             *
@@ -129,32 +184,42 @@ INIClass::~INIClass(void)
  *   07/02/1996 JLB : Created.                                                                 *
  *   08/21/1996 JLB : Optionally clears section too.                                           *
  *   11/02/1996 JLB : Updates the index list.                                                  *
+ *   10/19/2026 AGT : Releases the arena and hash tables.                                      *
  *=============================================================================================*/
 bool INIClass::Clear(char const * section, char const * entry)
 {
 	if (section == NULL) {
-		SectionList.Delete();
-		SectionIndex.Clear();
+
+		/*
+		**	The nodes all live in the arena, so they are just unlinked before it is released.
+		*/
+		while (!SectionList.Is_Empty()) {
+			SectionList.First()->Unlink();
+		}
+		while (Arena != NULL) {
+			ArenaBlock * next = Arena->Next;
+			free(Arena);
+			Arena = next;
+		}
+
+		delete [] SectionTable;
+		SectionTable = NULL;
+		SectionSlots = 0;
+		SectionsUsed = 0;
+		delete [] EntryTable;
+		EntryTable = NULL;
+		EntrySlots = 0;
+		EntriesUsed = 0;
 	} else {
 		INISection * secptr = Find_Section(section);
 		if (secptr != NULL) {
 			if (entry != NULL) {
-				INIEntry * entptr = secptr->Find_Entry(entry);
+				INIEntry * entptr = Find_Entry(secptr, entry);
 				if (entptr != NULL) {
-					/*
-					**	Remove the entry from the entry index list.
-					*/
-					secptr->EntryIndex.Remove_Index(entptr->Index_ID());
-
-					delete entptr;
+					Remove_Entry(entptr);
 				}
 			} else {
-				/*
-				**	Remove this section index from the section index list.
-				*/
-				SectionIndex.Remove_Index(secptr->Index_ID());
-
-				delete secptr;
+				Remove_Section(secptr);
 			}
 		}
 	}
@@ -196,26 +261,67 @@ bool INIClass::Load(FileClass & file)
  *                                                                                             *
  * HISTORY:                                                                                    *
  *   07/10/1996 JLB : Created.                                                                 *
+ *   10/19/2026 AGT : Parses the text in place, in a single arena block.                       *
+ *   10/19/2026 AGT : Trims the arena block to the text.                                       *
  *=============================================================================================*/
-#ifdef FIXIT_FAST_LOAD
-bool INIClass::Load(Straw & ffile)
-#else
 bool INIClass::Load(Straw & file)
-#endif
 {
-	bool end_of_file = false;
-	char buffer[MAX_LINE_LENGTH];
+	/*
+	**	Read the whole file into a single arena block. The lines are then broken up in
+	**	place, and the sections and entries point straight into this text.
+	*/
+	int size = ARENA_BLOCK_SIZE;
+	int length = 0;
+	ArenaBlock * block = (ArenaBlock *)malloc(sizeof(ArenaBlock) + size + 1);
+	if (block == NULL) return(false);
 
-#ifdef FIXIT_FAST_LOAD
-	CacheStraw file;
-	file.Get_From(ffile);
-#endif
+	for (;;) {
+		if (length == size) {
+			ArenaBlock * bigger = (ArenaBlock *)realloc(block, sizeof(ArenaBlock) + size*2 + 1);
+			if (bigger == NULL) {
+				free(block);
+				return(false);
+			}
+			block = bigger;
+			size *= 2;
+		}
+
+		int count = file.Get(((char *)(block+1)) + length, size - length);
+		if (count <= 0) break;
+		length += count;
+	}
+
+	/*
+	**	Give back the space that the text didn't need.
+	*/
+	if (length < size) {
+		ArenaBlock * fitted = (ArenaBlock *)realloc(block, sizeof(ArenaBlock) + length + 1);
+		if (fitted != NULL) {
+			block = fitted;
+			size = length;
+		}
+	}
+
+	block->Size = size + 1;
+	block->Used = size + 1;
+	if (Arena != NULL) {
+		block->Next = Arena->Next;
+		Arena->Next = block;
+	} else {
+		block->Next = NULL;
+		Arena = block;
+	}
+
+	char * text = (char *)(block+1);
+	char * end = text + length;
+	bool end_of_file = false;
+	char * buffer;
 
 	/*
 	**	Prescan until the first section is found.
 	*/
-	while (!end_of_file) {
-		Read_Line(file, buffer, sizeof(buffer), end_of_file);
+	for (;;) {
+		buffer = Next_Line(text, end, MAX_LINE_LENGTH, end_of_file);
 		if (end_of_file) return(false);
 		if (buffer[0] == '[' && strchr(buffer, ']') != NULL) break;
 	}
@@ -229,11 +335,12 @@ bool INIClass::Load(Straw & file)
 		char * ptr = strchr(buffer, ']');
 		if (ptr) *ptr = '\0';
 		strtrim(buffer);
-		INISection * secptr = new INISection(strdup(buffer));
-		if (secptr == NULL) {
+		void * secmem = Allocate(sizeof(INISection));
+		if (secmem == NULL) {
 			Clear();
 			return(false);
 		}
+		INISection * secptr = new (secmem) INISection(buffer);
 
 		/*
 		**	Read in the entries of this section.
@@ -245,7 +352,8 @@ bool INIClass::Load(Straw & file)
 			**	of the entry loop and let the outer section loop take
 			**	care of it.
 			*/
-			int len = Read_Line(file, buffer, sizeof(buffer), end_of_file);
+			buffer = Next_Line(text, end, MAX_LINE_LENGTH, end_of_file);
+			int len = strlen(buffer);
 			if (buffer[0] == '[' && strchr(buffer, ']') != NULL) break;
 
 			/*
@@ -272,26 +380,18 @@ bool INIClass::Load(Straw & file)
 			strtrim(divider);
 			if (!strlen(divider)) continue;
 
-			INIEntry * entryptr = new INIEntry(strdup(buffer), strdup(divider));
-			if (entryptr == NULL) {
-				delete secptr;
+			if (Add_Entry(secptr, buffer, divider) == NULL) {
 				Clear();
 				return(false);
 			}
-
-			secptr->EntryIndex.Add_Index(entryptr->Index_ID(), entryptr);
-			secptr->EntryList.Add_Tail(entryptr);
 		}
 
 		/*
 		**	All the entries for this section have been parsed. If this section is blank, then
 		**	don't bother storing it.
 		*/
-		if (secptr->EntryList.Is_Empty()) {
-			delete secptr;
-		} else {
-			SectionIndex.Add_Index(secptr->Index_ID(), secptr);
-			SectionList.Add_Tail(secptr);
+		if (!secptr->EntryList.Is_Empty()) {
+			Link_Section(secptr);
 		}
 	}
 	return(true);
@@ -393,15 +493,20 @@ int INIClass::Save(Pipe & pipe) const
  * HISTORY:                                                                                    *
  *   07/02/1996 JLB : Created.                                                                 *
  *   11/02/1996 JLB : Uses index manager.                                                      *
+ *   10/19/2026 AGT : Looks in the hashed section table.                                       *
  *=============================================================================================*/
 INIClass::INISection * INIClass::Find_Section(char const * section) const
 {
-	if (section != NULL) {
+	if (section != NULL && SectionSlots > 0) {
 
-		long crc = CRCEngine()(section, strlen(section));
+		int crc = CRCEngine()(section, strlen(section));
 
-		if (SectionIndex.Is_Present(crc)) {
-			return(SectionIndex.Fetch_Index(crc));
+		unsigned slot = Hash_Slot(crc, NULL) & (SectionSlots-1);
+		while (SectionTable[slot] != NULL) {
+			if (SectionTable[slot] != (INISection *)REMOVED_SLOT && SectionTable[slot]->ID == crc) {
+				return(SectionTable[slot]);
+			}
+			slot = (slot + 1) & (SectionSlots-1);
 		}
 	}
 	return(NULL);
@@ -426,7 +531,13 @@ INIClass::INISection * INIClass::Find_Section(char const * section) const
  *=============================================================================================*/
 int INIClass::Section_Count(void) const
 {
-	return(SectionIndex.Count());
+	int count = 0;
+	INISection * secptr = SectionList.First();
+	while (secptr && secptr->Is_Valid()) {
+		count++;
+		secptr = secptr->Next();
+	}
+	return(count);
 }
 
 
@@ -450,7 +561,7 @@ int INIClass::Entry_Count(char const * section) const
 {
 	INISection * secptr = Find_Section(section);
 	if (secptr != NULL) {
-		return(secptr->EntryIndex.Count());
+		return(secptr->Count);
 	}
 	return(0);
 }
@@ -478,7 +589,7 @@ INIClass::INIEntry * INIClass::Find_Entry(char const * section, char const * ent
 {
 	INISection * secptr = Find_Section(section);
 	if (secptr != NULL) {
-		return(secptr->Find_Entry(entry));
+		return(Find_Entry(secptr, entry));
 	}
 	return(NULL);
 }
@@ -506,7 +617,7 @@ char const * INIClass::Get_Entry(char const * section, int index) const
 {
 	INISection * secptr = Find_Section(section);
 
-	if (secptr != NULL && index < secptr->EntryIndex.Count()) {
+	if (secptr != NULL && index < secptr->Count) {
 		INIEntry * entryptr = secptr->EntryList.First();
 
 		while (entryptr != NULL && entryptr->Is_Valid()) {
@@ -918,6 +1029,7 @@ int INIClass::Get_Hex(char const * section, char const * entry, int defvalue) co
  * HISTORY:                                                                                    *
  *   07/02/1996 JLB : Created.                                                                 *
  *   11/02/1996 JLB : Uses index handler.                                                      *
+ *   10/19/2026 AGT : Reuses the old entry and its value space.                                *
  *=============================================================================================*/
 bool INIClass::Put_String(char const * section, char const * entry, char const * string)
 {
@@ -926,34 +1038,51 @@ bool INIClass::Put_String(char const * section, char const * entry, char const *
 	INISection * secptr = Find_Section(section);
 
 	if (secptr == NULL) {
-		secptr = new INISection(strdup(section));
+		secptr = Add_Section(section);
 		if (secptr == NULL) return(false);
-		SectionList.Add_Tail(secptr);
-		SectionIndex.Add_Index(secptr->Index_ID(), secptr);
 	}
 
 	/*
-	**	Remove the old entry if found.
+	**	An empty value removes the old entry if found.
 	*/
-	INIEntry * entryptr = secptr->Find_Entry(entry);
-	if (entryptr != NULL) {
-		secptr->EntryIndex.Remove_Index(entryptr->Index_ID());
-		delete entryptr;
+	INIEntry * entryptr = Find_Entry(secptr, entry);
+	if (string == NULL || strlen(string) == 0) {
+		if (entryptr != NULL) {
+			Remove_Entry(entryptr);
+		}
+		return(true);
 	}
 
 	/*
-	**	Create and add the new entry.
+	**	The old entry is reused if found. Its value is written over when the new one fits, so
+	**	only a longer value takes more of the arena. It moves to the end of the section, just
+	**	as a new entry would.
 	*/
-	if (string != NULL && strlen(string) > 0) {
-		entryptr = new INIEntry(strdup(entry), strdup(string));
-
-		if (entryptr == NULL) {
-			return(false);
+	if (entryptr != NULL) {
+		int len = strlen(string) + 1;
+		if (len > entryptr->Room) {
+			char * stringcopy = (char *)Allocate(len);
+			if (stringcopy == NULL) {
+				return(false);
+			}
+			entryptr->Value = stringcopy;
+			entryptr->Room = len;
 		}
+		memcpy(entryptr->Value, string, len);
+		entryptr->Unlink();
 		secptr->EntryList.Add_Tail(entryptr);
-		secptr->EntryIndex.Add_Index(entryptr->Index_ID(), entryptr);
+		return(true);
 	}
-	return(true);
+
+	/*
+	**	Create and add the new entry.
+	*/
+	char * entrycopy = Duplicate(entry);
+	char * stringcopy = Duplicate(string);
+	if (entrycopy == NULL || stringcopy == NULL) {
+		return(false);
+	}
+	return(Add_Entry(secptr, entrycopy, stringcopy) != NULL);
 }
 
 
@@ -1098,12 +1227,14 @@ bool INIClass::Get_Bool(char const * section, char const * entry, bool defvalue)
 
 
 /***********************************************************************************************
- * INIClass::INISection::Find_Entry -- Finds a specified entry and returns pointer to it.      *
+ * INIClass::Find_Entry -- Finds a specified entry and returns pointer to it.                  *
  *                                                                                             *
  *    This routine scans the supplied entry for the section specified. This is used for        *
  *    internal database maintenance.                                                           *
  *                                                                                             *
- * INPUT:   entry -- The entry to scan for.                                                    *
+ * INPUT:   secptr   -- Pointer to the section to look in.                                     *
+ *                                                                                             *
+ *          entry    -- The entry to scan for.                                                 *
  *                                                                                             *
  * OUTPUT:  Returns with a pointer to the entry control structure if the entry was found.      *
  *          Otherwise it returns NULL.                                                         *
@@ -1113,19 +1244,432 @@ bool INIClass::Get_Bool(char const * section, char const * entry, bool defvalue)
  * HISTORY:                                                                                    *
  *   07/03/1996 JLB : Created.                                                                 *
  *   11/02/1996 JLB : Uses index handler.                                                      *
+ *   10/19/2026 AGT : Looks in the hashed entry table.                                         *
  *=============================================================================================*/
-INIClass::INIEntry * INIClass::INISection::Find_Entry(char const * entry) const
+INIClass::INIEntry * INIClass::Find_Entry(INISection const * secptr, char const * entry) const
 {
-	if (entry != NULL) {
+	if (entry != NULL && EntrySlots > 0) {
 		int crc = CRCEngine()(entry, strlen(entry));
-		if (EntryIndex.Is_Present(crc)) {
-			return(EntryIndex.Fetch_Index(crc));
+
+		unsigned slot = Hash_Slot(crc, secptr) & (EntrySlots-1);
+		while (EntryTable[slot] != NULL) {
+			INIEntry * entptr = EntryTable[slot];
+			if (entptr != (INIEntry *)REMOVED_SLOT && entptr->Owner == secptr && entptr->ID == crc) {
+				return(entptr);
+			}
+			slot = (slot + 1) & (EntrySlots-1);
 		}
 	}
 	return(NULL);
 }
 
 
+/***********************************************************************************************
+ * INIClass::Allocate -- Allocate memory from the INI database arena.                          *
+ *                                                                                             *
+ *    All of the section and entry objects, and the strings they refer to, are carved out of   *
+ *    a few large blocks. The blocks are only released when the whole database is cleared.     *
+ *                                                                                             *
+ * INPUT:   size  -- The number of bytes to allocate.                                          *
+ *                                                                                             *
+ * OUTPUT:  Returns with a pointer to the memory, or NULL if it could not be allocated.        *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+void * INIClass::Allocate(int size)
+{
+	size = (size + sizeof(void *)-1) & ~(int)(sizeof(void *)-1);
+
+	/*
+	**	Big requests get a block of their own. It goes in behind the current block so that
+	**	the space left in that block is still used up by later requests.
+	*/
+	if (size > ARENA_BLOCK_SIZE/4) {
+		ArenaBlock * block = (ArenaBlock *)malloc(sizeof(ArenaBlock) + size);
+		if (block == NULL) return(NULL);
+		block->Size = size;
+		block->Used = size;
+		if (Arena != NULL) {
+			block->Next = Arena->Next;
+			Arena->Next = block;
+		} else {
+			block->Next = NULL;
+			Arena = block;
+		}
+		return(block+1);
+	}
+
+	if (Arena == NULL || Arena->Used + size > Arena->Size) {
+		ArenaBlock * block = (ArenaBlock *)malloc(sizeof(ArenaBlock) + ARENA_BLOCK_SIZE);
+		if (block == NULL) return(NULL);
+		block->Next = Arena;
+		block->Size = ARENA_BLOCK_SIZE;
+		block->Used = 0;
+		Arena = block;
+	}
+
+	void * ptr = ((char *)(Arena+1)) + Arena->Used;
+	Arena->Used += size;
+	return(ptr);
+}
+
+
+/***********************************************************************************************
+ * INIClass::Duplicate -- Copy a string into the INI database arena.                           *
+ *                                                                                             *
+ *    This is the arena equivalent of strdup().                                                *
+ *                                                                                             *
+ * INPUT:   string   -- Pointer to the string to copy.                                         *
+ *                                                                                             *
+ * OUTPUT:  Returns with a pointer to the copy, or NULL if there was no memory for it.         *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+char * INIClass::Duplicate(char const * string)
+{
+	int len = strlen(string) + 1;
+	char * copy = (char *)Allocate(len);
+	if (copy != NULL) {
+		memcpy(copy, string, len);
+	}
+	return(copy);
+}
+
+
+/***********************************************************************************************
+ * INIClass::Add_Section -- Create a new, empty section.                                       *
+ *                                                                                             *
+ *    The section is added to the end of the section list and to the section hash table.       *
+ *                                                                                             *
+ * INPUT:   section  -- The name of the section to create.                                     *
+ *                                                                                             *
+ * OUTPUT:  Returns with a pointer to the new section, or NULL if it could not be created.     *
+ *                                                                                             *
+ * WARNINGS:   There must not already be a section by this name.                               *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+INIClass::INISection * INIClass::Add_Section(char const * section)
+{
+	char * name = Duplicate(section);
+	void * mem = Allocate(sizeof(INISection));
+	if (name == NULL || mem == NULL) return(NULL);
+
+	INISection * secptr = new (mem) INISection(name);
+	Link_Section(secptr);
+	return(secptr);
+}
+
+
+/***********************************************************************************************
+ * INIClass::Link_Section -- Attach a section to the INI database.                             *
+ *                                                                                             *
+ *    This adds the section to the end of the section list. It is entered into the section     *
+ *    hash table unless a section by the same name is already there, in which case that        *
+ *    earlier section is the one that will be found.                                           *
+ *                                                                                             *
+ * INPUT:   secptr   -- Pointer to the section to attach.                                      *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+void INIClass::Link_Section(INISection * secptr)
+{
+	if (Find_Section(secptr->Section) == NULL) {
+		Index_Section(secptr);
+	}
+	SectionList.Add_Tail(secptr);
+}
+
+
+/***********************************************************************************************
+ * INIClass::Add_Entry -- Attach an entry to a section.                                        *
+ *                                                                                             *
+ *    The entry is created and added to the end of the section's entry list. It is entered     *
+ *    into the entry hash table unless the section already has an entry by this name, in       *
+ *    which case that earlier entry is the one that will be found.                             *
+ *                                                                                             *
+ * INPUT:   secptr   -- Pointer to the section to add the entry to.                            *
+ *                                                                                             *
+ *          entry    -- The entry name.                                                        *
+ *                                                                                             *
+ *          value    -- The entry value.                                                       *
+ *                                                                                             *
+ * OUTPUT:  Returns with a pointer to the new entry, or NULL if it could not be created.       *
+ *                                                                                             *
+ * WARNINGS:   The strings are not copied. They must remain until the database is cleared.     *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+INIClass::INIEntry * INIClass::Add_Entry(INISection * secptr, char * entry, char * value)
+{
+	void * mem = Allocate(sizeof(INIEntry));
+	if (mem == NULL) return(NULL);
+
+	INIEntry * entptr = new (mem) INIEntry(entry, value, secptr);
+	if (Find_Entry(secptr, entry) == NULL) {
+		Index_Entry(entptr);
+	}
+	secptr->EntryList.Add_Tail(entptr);
+	secptr->Count++;
+	return(entptr);
+}
+
+
+/***********************************************************************************************
+ * INIClass::Remove_Section -- Detach a section and all its entries.                           *
+ *                                                                                             *
+ *    The section and its entries are taken out of the lists and the hash tables. If another   *
+ *    section by the same name remains, then it takes the place of this one in the table.      *
+ *                                                                                             *
+ * INPUT:   secptr   -- Pointer to the section to remove.                                      *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   The memory is not reclaimed until the whole database is cleared.                *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+void INIClass::Remove_Section(INISection * secptr)
+{
+	while (!secptr->EntryList.Is_Empty()) {
+		Remove_Entry(secptr->EntryList.First());
+	}
+	secptr->Unlink();
+
+	unsigned slot = Hash_Slot(secptr->ID, NULL) & (SectionSlots-1);
+	while (SectionTable[slot] != NULL) {
+		if (SectionTable[slot] == secptr) {
+			SectionTable[slot] = (INISection *)REMOVED_SLOT;
+
+			/*
+			**	Let a duplicate section that was hidden by this one be found instead.
+			*/
+			INISection * other = SectionList.First();
+			while (other != NULL && other->Is_Valid()) {
+				if (other->ID == secptr->ID) {
+					Index_Section(other);
+					break;
+				}
+				other = other->Next();
+			}
+			break;
+		}
+		slot = (slot + 1) & (SectionSlots-1);
+	}
+}
+
+
+/***********************************************************************************************
+ * INIClass::Remove_Entry -- Detach an entry from its section.                                 *
+ *                                                                                             *
+ *    The entry is taken out of its section's list and out of the entry hash table. If the     *
+ *    section has another entry by the same name, then it takes the place of this one in       *
+ *    the table.                                                                               *
+ *                                                                                             *
+ * INPUT:   entptr   -- Pointer to the entry to remove.                                        *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   The memory is not reclaimed until the whole database is cleared.                *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+void INIClass::Remove_Entry(INIEntry * entptr)
+{
+	INISection * secptr = entptr->Owner;
+	entptr->Unlink();
+	secptr->Count--;
+
+	unsigned slot = Hash_Slot(entptr->ID, secptr) & (EntrySlots-1);
+	while (EntryTable[slot] != NULL) {
+		if (EntryTable[slot] == entptr) {
+			EntryTable[slot] = (INIEntry *)REMOVED_SLOT;
+
+			/*
+			**	Let a duplicate entry that was hidden by this one be found instead.
+			*/
+			INIEntry * other = secptr->EntryList.First();
+			while (other != NULL && other->Is_Valid()) {
+				if (other->ID == entptr->ID) {
+					Index_Entry(other);
+					break;
+				}
+				other = other->Next();
+			}
+			break;
+		}
+		slot = (slot + 1) & (EntrySlots-1);
+	}
+}
+
+
+/***********************************************************************************************
+ * INIClass::Index_Section -- Enter a section into the section hash table.                     *
+ *                                                                                             *
+ *    The table is grown first if this would leave it more than half full.                     *
+ *                                                                                             *
+ * INPUT:   secptr   -- Pointer to the section to enter.                                       *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   No section by this name may be entered already.                                 *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+void INIClass::Index_Section(INISection * secptr)
+{
+	if ((SectionsUsed+1)*2 > SectionSlots) {
+		Grow_Sections();
+	}
+
+	unsigned slot = Hash_Slot(secptr->ID, NULL) & (SectionSlots-1);
+	while (SectionTable[slot] != NULL && SectionTable[slot] != (INISection *)REMOVED_SLOT) {
+		slot = (slot + 1) & (SectionSlots-1);
+	}
+	if (SectionTable[slot] == NULL) SectionsUsed++;
+	SectionTable[slot] = secptr;
+}
+
+
+/***********************************************************************************************
+ * INIClass::Index_Entry -- Enter an entry into the entry hash table.                          *
+ *                                                                                             *
+ *    The table is grown first if this would leave it more than half full.                     *
+ *                                                                                             *
+ * INPUT:   entptr   -- Pointer to the entry to enter.                                         *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   No entry by this name may be entered for its section already.                   *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+void INIClass::Index_Entry(INIEntry * entptr)
+{
+	if ((EntriesUsed+1)*2 > EntrySlots) {
+		Grow_Entries();
+	}
+
+	unsigned slot = Hash_Slot(entptr->ID, entptr->Owner) & (EntrySlots-1);
+	while (EntryTable[slot] != NULL && EntryTable[slot] != (INIEntry *)REMOVED_SLOT) {
+		slot = (slot + 1) & (EntrySlots-1);
+	}
+	if (EntryTable[slot] == NULL) EntriesUsed++;
+	EntryTable[slot] = entptr;
+}
+
+
+/***********************************************************************************************
+ * INIClass::Grow_Sections -- Rebuild the section hash table with more room.                   *
+ *                                                                                             *
+ *    The table is sized so that it is no more than a quarter full of live sections. Slots     *
+ *    left behind by removed sections are dropped in the process.                              *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+void INIClass::Grow_Sections(void)
+{
+	INISection ** oldtable = SectionTable;
+	int oldslots = SectionSlots;
+
+	int live = 0;
+	for (int index = 0; index < oldslots; index++) {
+		if (oldtable[index] != NULL && oldtable[index] != (INISection *)REMOVED_SLOT) live++;
+	}
+
+	SectionSlots = 64;
+	while ((live+1)*4 > SectionSlots) {
+		SectionSlots *= 2;
+	}
+	SectionTable = new INISection * [SectionSlots];
+	memset(SectionTable, 0, SectionSlots * sizeof(SectionTable[0]));
+	SectionsUsed = live;
+
+	for (int index = 0; index < oldslots; index++) {
+		INISection * secptr = oldtable[index];
+		if (secptr != NULL && secptr != (INISection *)REMOVED_SLOT) {
+			unsigned slot = Hash_Slot(secptr->ID, NULL) & (SectionSlots-1);
+			while (SectionTable[slot] != NULL) {
+				slot = (slot + 1) & (SectionSlots-1);
+			}
+			SectionTable[slot] = secptr;
+		}
+	}
+	delete [] oldtable;
+}
+
+
+/***********************************************************************************************
+ * INIClass::Grow_Entries -- Rebuild the entry hash table with more room.                      *
+ *                                                                                             *
+ *    The table is sized so that it is no more than a quarter full of live entries. Slots      *
+ *    left behind by removed entries are dropped in the process.                               *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+void INIClass::Grow_Entries(void)
+{
+	INIEntry ** oldtable = EntryTable;
+	int oldslots = EntrySlots;
+
+	int live = 0;
+	for (int index = 0; index < oldslots; index++) {
+		if (oldtable[index] != NULL && oldtable[index] != (INIEntry *)REMOVED_SLOT) live++;
+	}
+
+	EntrySlots = 256;
+	while ((live+1)*4 > EntrySlots) {
+		EntrySlots *= 2;
+	}
+	EntryTable = new INIEntry * [EntrySlots];
+	memset(EntryTable, 0, EntrySlots * sizeof(EntryTable[0]));
+	EntriesUsed = live;
+
+	for (int index = 0; index < oldslots; index++) {
+		INIEntry * entptr = oldtable[index];
+		if (entptr != NULL && entptr != (INIEntry *)REMOVED_SLOT) {
+			unsigned slot = Hash_Slot(entptr->ID, entptr->Owner) & (EntrySlots-1);
+			while (EntryTable[slot] != NULL) {
+				slot = (slot + 1) & (EntrySlots-1);
+			}
+			EntryTable[slot] = entptr;
+		}
+	}
+	delete [] oldtable;
+}
+
+
 /***********************************************************************************************
  * INIClass::Put_PKey -- Stores the key to the INI database.                                   *
  *                                                                                             *
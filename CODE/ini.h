@@ -54,7 +54,7 @@
 */
 class INIClass {
 	public:
-		INIClass(void) {}
+		INIClass(void) : Arena(0), SectionTable(0), SectionSlots(0), SectionsUsed(0), EntryTable(0), EntrySlots(0), EntriesUsed(0) {}
 		~INIClass(void);
 
 		/*
@@ -115,17 +115,23 @@ class INIClass {
 	protected:
 		enum {MAX_LINE_LENGTH=128};
 
+		struct INISection;
+
 		/*
 		**	The value entries for the INI file are stored as objects of this type.
 		**	The entry identifier and value string are combined into this object.
+		**	The strings point into the database's arena, usually straight into the
+		**	text of the file it was loaded from.
 		*/
 		struct INIEntry : Node<INIEntry> {
-			INIEntry(char * entry = 0, char * value = 0) : Entry(entry), Value(value) {}
-			~INIEntry(void) {free(Entry);Entry = 0;free(Value);Value = 0;}
-			int Index_ID(void) const {return(CRCEngine()(Entry, strlen(Entry)));};
+			INIEntry(char * entry, char * value, INISection * owner) : Entry(entry), Value(value), Owner(owner), ID(CRCEngine()(entry, strlen(entry))), Room(strlen(value)+1) {}
+			int Index_ID(void) const {return(ID);};
 
 			char * Entry;
 			char * Value;
+			INISection * Owner;
+			int ID;
+			int Room;			// Bytes the value string has room for.
 		};
 
 		/*
@@ -133,14 +139,13 @@ class INIClass {
 		**	subordinate to this section are attached.
 		*/
 		struct INISection : Node<INISection> {
-			INISection(char * section) : Section(section) {}
-			~INISection(void) {free(Section);Section = 0;EntryList.Delete();}
-			INIEntry * Find_Entry(char const * entry) const;
-			int Index_ID(void) const {return(CRCEngine()(Section, strlen(Section)));};
+			INISection(char * section) : Section(section), ID(CRCEngine()(section, strlen(section))), Count(0) {}
+			int Index_ID(void) const {return(ID);};
 
 			char * Section;
 			List<INIEntry> EntryList;
-			IndexClass<INIEntry *>EntryIndex;
+			int ID;
+			int Count;
 		};
 
 		/*
@@ -148,14 +153,56 @@ class INIClass {
 		*/
 		INISection * Find_Section(char const * section) const;
 		INIEntry * Find_Entry(char const * section, char const * entry) const;
+		INIEntry * Find_Entry(INISection const * secptr, char const * entry) const;
 		static void Strip_Comments(char * buffer);
 
+		/*
+		**	Sections and entries are created, indexed and removed with these.
+		*/
+		INISection * Add_Section(char const * section);
+		void Link_Section(INISection * secptr);
+		INIEntry * Add_Entry(INISection * secptr, char * entry, char * value);
+		void Remove_Section(INISection * secptr);
+		void Remove_Entry(INIEntry * entptr);
+		void Index_Section(INISection * secptr);
+		void Index_Entry(INIEntry * entptr);
+		void Grow_Sections(void);
+		void Grow_Entries(void);
+
+		/*
+		**	All the sections, entries and their text are allocated from this arena. None
+		**	of it is released until the whole database is cleared, but an entry's value
+		**	is written over in place when a new value fits.
+		*/
+		struct ArenaBlock {
+			ArenaBlock * Next;
+			int Size;
+			int Used;
+		};
+		enum {ARENA_BLOCK_SIZE=16*1024};
+		ArenaBlock * Arena;
+		void * Allocate(int size);
+		char * Duplicate(char const * string);
+
 		/*
 		**	This is the list of all sections within this INI file.
 		*/
 		List<INISection> SectionList;
 
-		IndexClass<INISection *> SectionIndex;
+		/*
+		**	Open addressed hash tables of the sections (by name) and of the entries (by
+		**	section and name). The sizes are powers of 2, and the used counts include
+		**	slots left behind by removals.
+		*/
+		INISection ** SectionTable;
+		int SectionSlots;
+		int SectionsUsed;
+		INIEntry ** EntryTable;
+		int EntrySlots;
+		int EntriesUsed;
+
+		INIClass(INIClass const & rvalue);
+		INIClass & operator = (INIClass const & rvalue);
 };
 
 
@@ -192,6 +192,7 @@ static void Load_Prolog_Page(void)
  *   10/07/1992 JLB : Created.                                                                 *
  *=============================================================================================*/
 #include	"sha.h"
+#include	<thread>
 //#include    <locale.h>
 bool Init_Game(int , char * [])
 {
@@ -396,6 +397,11 @@ bool Init_Game(int , char * [])
 	*/
 	Options.Load_Settings();
 
+	/*
+	**	Start publishing the runtime metrics if a file has been named for them.
+	*/
+	Metrics.Start(Options.MetricsFile, Options.MetricsInterval);
+
 	return(true);
 }
 
@@ -588,6 +594,21 @@ bool Select_Game(bool fade)
 				Session.Play = false;
 		}
 
+		/*
+		**	If asked to recover from a crash, put the game back to the last checkpoint
+		**	and skip the menu loop.
+		*/
+		if (RecoverCheckpoint && process) {
+			RecoverCheckpoint = false;
+			if (Load_Checkpoint(false) == CHECKPOINT_LOADED) {
+				process = false;
+				gameloaded = true;
+				Theme.Fade_Out();
+			} else {
+				WWMessageBox().Process(TXT_ERROR_LOADING_GAME);
+			}
+		}
+
 #ifndef FIXIT_VERSION_3
 #if defined(WIN32) && !defined(INTERNET_OFF) // Denzil 5/1/98 - Internet play
 		/*
@@ -1658,6 +1679,7 @@ static void Play_Intro(bool sequenced)
  *                                                                                             *
  * HISTORY:                                                                                    *
  *   12/20/1994 JLB : Created.                                                                 *
+ *   10/19/2026 AGT : Loads the movie frames ahead when there is a spare core.                 *
  *=============================================================================================*/
 #ifdef WIN32
 #ifdef MOVIE640
@@ -1697,6 +1719,13 @@ void Anim_Init(void)
 		AnimControl.OptionFlags |= VQAOPTF_SLOWPAL;
 	}
 #ifdef PORTABLE
+	/*
+	**	If there is a core to spare, load the frames on a thread of their own, so that a slow
+	**	read from the CD or disk does not hold up drawing the frames already loaded.
+	*/
+	if (std::thread::hardware_concurrency() > 1) {
+		AnimControl.OptionFlags |= VQAOPTF_PRELOAD;
+	}
 	AnimControl.AudioDeviceID = Get_Audio_Device();
 	AnimControl.AudioCallback = Get_Audio_Callback_Ptr();
 	AnimControl.AudioSpec = Get_Audio_Spec();
@@ -1774,8 +1803,11 @@ bool Parse_Command_Line(int argc, char * argv[])
 
 	for (int index = 1; index < argc; index++) {
 		char * string;		// Pointer to argument.
+		char typed[_MAX_PATH];	// Argument as typed, for the ones that name files.
 		long code = 0;
 
+		strncpy(typed, argv[index], sizeof(typed)-1);
+		typed[sizeof(typed)-1] = '\0';
 		string = strupr(argv[index]);
 
 		/*
@@ -1995,6 +2027,66 @@ bool Parse_Command_Line(int argc, char * argv[])
 
 #endif
 
+		/*
+		**	Start the profiler right away. What it records is written out when the game
+		**	exits, or when the profiler hotkey stops it.
+		*/
+		if (stricmp(string, "-PROFILE") == 0) {
+			Profiler.Start();
+			continue;
+		}
+
+		/*
+		**	Resume a single player game that crashed from its last checkpoint.
+		*/
+		if (stricmp(string, "-RECOVER") == 0) {
+			RecoverCheckpoint = true;
+			continue;
+		}
+
+		/*
+		**	Play back a recorded game as a regression benchmark, checking it against its
+		**	golden CRC trace. "-REGRESS:NAME" plays NAME.BIN; "-REGRESS" plays RECORD.BIN. The
+		**	name keeps the case it was typed in, since it may be a path.
+		*/
+		if (strnicmp(string, "-REGRESS", strlen("-REGRESS")) == 0) {
+			string = typed + strlen("-REGRESS");
+			if (!Regression.Start((*string == ':') ? string+1 : "RECORD")) {
+				puts("Recording not found.");
+				return(false);
+			}
+			continue;
+		}
+
+		/*
+		**	Run the self tests and benchmarks instead of the game: "-SELFTEST" runs them all and
+		**	"-SELFTEST:NAME" runs just the one named. "-SELFTEST:NAME=FILE" gives the test a file,
+		**	so the name keeps the case it was typed in.
+		*/
+		if (strnicmp(string, "-SELFTEST", strlen("-SELFTEST")) == 0) {
+			string = typed + strlen("-SELFTEST");
+			SelfTestName = (*string == ':') ? strdup(string+1) : "";
+			continue;
+		}
+
+		/*
+		**	Have the regression run check seeking: "-SEEKCHECK:FRAME" seeks back to FRAME a
+		**	minute after reaching it, and checks the frames played again.
+		*/
+		if (strnicmp(string, "-SEEKCHECK:", strlen("-SEEKCHECK:")) == 0) {
+			Regression.SeekFrame = max(atol(string + strlen("-SEEKCHECK:")), 0L);
+			continue;
+		}
+
+		/*
+		**	Have the regression run make its golden CRC trace, in place of any there was,
+		**	rather than check against it. Without this, a recording with no trace fails.
+		*/
+		if (stricmp(string, "-GOLDEN") == 0) {
+			Regression.IsGolden = true;
+			continue;
+		}
+
 #ifdef CHEAT_KEYS
 		/*
 		**	Specify the random number seed (for debugging)
@@ -2690,6 +2782,7 @@ static void Init_Color_Remaps(void)
  *                                                                                             *
  * HISTORY:                                                                                    *
  *   06/03/1996 JLB : Created.                                                                 *
+ *   10/19/2026 AGT : The game object heaps may grow.                                          *
  *=============================================================================================*/
 static void Init_Heaps(void)
 {
@@ -2715,6 +2808,24 @@ static void Init_Heaps(void)
 	TriggerTypes.Set_Heap(Rule.TrigTypeMax);
 //	Weapons.Set_Heap(Rule.WeaponMax);
 
+	/*
+	**	The game object heaps can grow when they fill up, rather than refuse to create any more
+	**	objects. Each grows by as many objects as it started with.
+	*/
+	if (Rule.IsHeapGrowable) {
+		Vessels.Set_Growth_Step(Rule.VesselMax);
+		Units.Set_Growth_Step(Rule.UnitMax);
+		Factories.Set_Growth_Step(Rule.FactoryMax);
+		Terrains.Set_Growth_Step(Rule.TerrainMax);
+		Infantry.Set_Growth_Step(Rule.InfantryMax);
+		Bullets.Set_Growth_Step(Rule.BulletMax);
+		Buildings.Set_Growth_Step(Rule.BuildingMax);
+		Anims.Set_Growth_Step(Rule.AnimMax);
+		Aircraft.Set_Growth_Step(Rule.AircraftMax);
+		Triggers.Set_Growth_Step(Rule.TriggerMax);
+		Teams.Set_Growth_Step(Rule.TeamMax);
+	}
+
 	/*
 	**	Speech holding tank buffer. Since speech does not mix, it can be placed
 	**	into a custom holding tank only as large as the largest speech file to
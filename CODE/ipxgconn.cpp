@@ -304,6 +304,7 @@ int IPXGlobalConnClass::Receive_Packet (void * buf, int buflen,
 				if (packet->Header.PacketID==entry_data->Header.PacketID &&
 					entry_data->Header.Code == PACKET_DATA_ACK) {
 					send_entry->IsACK = 1;
+					send_entry->AckTime = PacketTime;
 					break;
 				}
 			}
@@ -59,6 +59,8 @@
  *   IPXManagerClass::Set_Bridge -- prepares to cross a bridge             *
  *   IPXManagerClass::Set_Socket -- sets socket ID for all connections		*
  *   IPXManagerClass::Response_Time -- Returns largest Avg Response Time   *
+ *   IPXManagerClass::Percentile_Response_Time -- largest percentile time  *
+ *   IPXManagerClass::Response_Jitter -- Returns largest response jitter   *
  *   IPXManagerClass::Global_Response_Time -- Returns Avg Response Time    *
  *   IPXManagerClass::Reset_Response_Time -- Reset response time 				*
  *   IPXManagerClass::Oldest_Send -- gets ptr to oldest send buf           *
@@ -1008,6 +1010,7 @@ int IPXManagerClass::Service(void)
 					/*
 					** Put the packet in the Global Queue
 					*/
+					GlobalChannel->Set_Packet_Time (PacketTransport->Packet_Time());
 					if (!GlobalChannel->Receive_Packet (packet, packetlen, &address))
 						ReceiveOverflows++;
 				} else {
@@ -1020,6 +1023,7 @@ int IPXManagerClass::Service(void)
 						for (i = 0; i < NumConnections; i++) {
 							if (Connection[i]->Address == address) {
 								found_address = true;
+								Connection[i]->Set_Packet_Time (PacketTransport->Packet_Time());
 								if (!Connection[i]->Receive_Packet (packet, packetlen))
 									ReceiveOverflows++;
 								break;
@@ -1544,6 +1548,72 @@ unsigned long IPXManagerClass::Response_Time(void)
 }	/* end of Response_Time */
 
 
+/***************************************************************************
+ * IPXManagerClass::Percentile_Response_Time -- largest percentile time    *
+ *                                                                         *
+ * INPUT:                                                                  *
+ *		percent		percentile to find (1-100)											*
+ *                                                                         *
+ * OUTPUT:                                                                 *
+ *		largest response time percentile of all connections						*
+ *                                                                         *
+ * WARNINGS:                                                               *
+ *		none.																						*
+ *                                                                         *
+ * HISTORY:                                                                *
+ *   10/19/2026 AGT : Created.                                             *
+ *=========================================================================*/
+unsigned long IPXManagerClass::Percentile_Response_Time(int percent)
+{
+	unsigned long resp;
+	unsigned long maxresp = 0;
+	int i;
+
+	for (i = 0; i < NumConnections; i++) {
+		resp = Connection[i]->Queue->Percentile_Response_Time(percent);
+		if (resp > maxresp) {
+			maxresp = resp;
+		}
+	}
+
+	return(maxresp);
+
+}	/* end of Percentile_Response_Time */
+
+
+/***************************************************************************
+ * IPXManagerClass::Response_Jitter -- Returns largest response jitter     *
+ *                                                                         *
+ * INPUT:                                                                  *
+ *		none.																						*
+ *                                                                         *
+ * OUTPUT:                                                                 *
+ *		largest response time jitter of all connections								*
+ *                                                                         *
+ * WARNINGS:                                                               *
+ *		none.																						*
+ *                                                                         *
+ * HISTORY:                                                                *
+ *   10/19/2026 AGT : Created.                                             *
+ *=========================================================================*/
+unsigned long IPXManagerClass::Response_Jitter(void)
+{
+	unsigned long jitter;
+	unsigned long maxjitter = 0;
+	int i;
+
+	for (i = 0; i < NumConnections; i++) {
+		jitter = Connection[i]->Queue->Response_Jitter();
+		if (jitter > maxjitter) {
+			maxjitter = jitter;
+		}
+	}
+
+	return(maxjitter);
+
+}	/* end of Response_Jitter */
+
+
 /***************************************************************************
  * IPXManagerClass::Global_Response_Time -- Returns Avg Response Time      *
  *                                                                         *
@@ -230,6 +230,8 @@ class IPXManagerClass : public ConnManClass
 		reset the response time for all queues.
 		.....................................................................*/
 		virtual unsigned long Response_Time(void);
+		virtual unsigned long Percentile_Response_Time(int percent);
+		virtual unsigned long Response_Jitter(void);
 		unsigned long Global_Response_Time(void);
 		virtual void Reset_Response_Time(void);
 
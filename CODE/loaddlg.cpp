@@ -486,7 +486,7 @@ int LoadOptionsClass::Process(void)
 				game_num = Files[game_idx]->Num;
 				if (WWMessageBox().Process(TXT_DELETE_FILE_QUERY, TXT_YES, TXT_NO)==0) {
 					sprintf(fname, "SAVEGAME.%03d", game_num);
-					unlink(fname);
+					RawFileClass(fname).Delete();
 					Clear_List(&listbtn);
 					Fill_List(&listbtn);
 					if (listbtn.Count() == 0) {
@@ -201,6 +201,7 @@ int LZOPipe::Put(void const * source, int slen)
 			if (Counter == BlockSize) {
 				unsigned int len = sizeof (Buffer2);
 				char *dictionary = new char [16*1024 * sizeof(void *)];
+				memset(dictionary, 0, 16*1024 * sizeof(void *));
 				lzo1x_1_compress ((unsigned char*)Buffer, BlockSize, (unsigned char*)Buffer2, &len, dictionary);
 				delete [] dictionary;
 				BlockHeader.CompCount = (unsigned short)len;
@@ -218,6 +219,7 @@ int LZOPipe::Put(void const * source, int slen)
 		while (slen >= BlockSize) {
 			unsigned int len = sizeof (Buffer2);
 			char *dictionary = new char [16*1024 * sizeof(void *)];
+			memset(dictionary, 0, 16*1024 * sizeof(void *));
 			lzo1x_1_compress ((unsigned char*)source, BlockSize, (unsigned char*)Buffer2, &len, dictionary);
 			delete [] dictionary;
 			source = ((char *)source) + BlockSize;
@@ -305,6 +307,7 @@ int LZOPipe::Flush(void)
 			*/
 			unsigned int len = sizeof (Buffer2);
 			char *dictionary = new char [16*1024 * sizeof(void *)];
+			memset(dictionary, 0, 16*1024 * sizeof(void *));
 			lzo1x_1_compress ((unsigned char*)Buffer, Counter, (unsigned char *)Buffer2, &len, dictionary);
 			delete [] dictionary;
 			BlockHeader.CompCount = (unsigned short)len;
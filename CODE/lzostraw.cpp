@@ -170,7 +170,8 @@ int LZOStraw::Get(void * destbuf, int slen)
 		} else {
 			BlockHeader.UncompCount = (unsigned short)Straw::Get(Buffer, BlockSize);
 			if (BlockHeader.UncompCount == 0) break;
-			char *dictionary = new char [64*1024];
+			char *dictionary = new char [16*1024 * sizeof(void *)];
+			memset(dictionary, 0, 16*1024 * sizeof(void *));
 			unsigned int length = sizeof (Buffer2) - sizeof (BlockHeader);
 			lzo1x_1_compress ((unsigned char*)Buffer, BlockHeader.UncompCount, (unsigned char*)(&Buffer2[sizeof(BlockHeader)]), &length, dictionary);
 			BlockHeader.CompCount = (unsigned short)length;
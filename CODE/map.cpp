@@ -82,6 +82,14 @@ int const MapClass::RadiusOffset[] = {
 
 int const MapClass::RadiusCount[11] = {1,9,21,37,61,89,121,161,205,253,309};
 
+/*
+**	The lepton distance from the center of the scan to each cell in the radius offset list.
+**	Cells that wrap around the map edge are skipped by the scans, so this is the same for
+**	every cell that is scanned, and it is worked out just once rather than for every cell
+**	of every sight scan.
+*/
+int MapClass::RadiusDistance[sizeof(RadiusOffset)/sizeof(RadiusOffset[0])];
+
 
 CellClass * BlubCell;
 
@@ -101,6 +109,7 @@ CellClass * BlubCell;
  * HISTORY:                                                                                    *
  *   05/31/1994 JLB : Created.                                                                 *
  *   12/01/1994 BR : Added CellTriggers initialization                                         *
+ *   10/19/2026 AGT : Measures the distance to each radius offset.                             *
  *=============================================================================================*/
 void MapClass::One_Time(void)
 {
@@ -114,6 +123,18 @@ void MapClass::One_Time(void)
 	**	Allocate the cell array.
 	*/
 	Alloc_Cells();
+
+	/*
+	**	Measure the distance to each cell in the radius offset list from a cell in the middle
+	**	of the map, where none of the offsets can wrap around the map edge.
+	*/
+	int const count = sizeof(RadiusOffset)/sizeof(RadiusOffset[0]);
+	CELL center = XY_Cell(MAP_CELL_W/2, MAP_CELL_H/2);
+	COORDINATE coords[count];
+	for (int index = 0; index < count; index++) {
+		coords[index] = Cell_Coord(center + RadiusOffset[index]);
+	}
+	Distance_List(Cell_Coord(center), coords, RadiusDistance, count);
 }
 
 
@@ -287,6 +308,7 @@ void MapClass::Sight_From(CELL cell, int sightrange, HouseClass * house, bool in
 {
 	int xx;				// Center cell X coordinate (bounds checking).
 	int const * ptr;	// Offset pointer.
+	int const * dist;	// Offset distance pointer.
 	int count;			// Counter for number of offsets to process.
 
 	/*
@@ -306,9 +328,11 @@ void MapClass::Sight_From(CELL cell, int sightrange, HouseClass * house, bool in
 	*/
 	count = RadiusCount[sightrange];
 	ptr = &RadiusOffset[0];
+	dist = &RadiusDistance[0];
 	if (incremental) {
 		if (sightrange > 2) {
 			ptr += RadiusCount[sightrange-3];
+			dist += RadiusCount[sightrange-3];
 			count -= RadiusCount[sightrange-3];
 		}
 	}
@@ -319,8 +343,10 @@ void MapClass::Sight_From(CELL cell, int sightrange, HouseClass * house, bool in
 	while (count--) {
 		CELL	newcell;			// New cell with offset.
 		int	xdiff;			// New cell's X coordinate distance from center.
+		int	distance;		// New cell's lepton distance from center.
 
 		newcell = cell + *ptr++;
+		distance = *dist++;
 
 		/*
 		**	Determine if the map edge has been wrapped. If so,
@@ -330,7 +356,7 @@ void MapClass::Sight_From(CELL cell, int sightrange, HouseClass * house, bool in
 		xdiff = Cell_X(newcell) - xx;
 		xdiff = ABS(xdiff);
 		if (xdiff > sightrange) continue;
-		if (Distance(Cell_Coord(newcell), Cell_Coord(cell)) > (sightrange * CELL_LEPTON_W)) continue;
+		if (distance > (sightrange * CELL_LEPTON_W)) continue;
 
 		/*
 		**	Map the cell. For incremental scans, then update
@@ -367,6 +393,7 @@ void MapClass::Shroud_From(CELL cell, int sightrange)
 {
 	int xx;				// Center cell X coordinate (bounds checking).
 	int const * ptr;	// Offset pointer.
+	int const * dist;	// Offset distance pointer.
 	int count;			// Counter for number of offsets to process.
 
 	/*
@@ -386,6 +413,7 @@ void MapClass::Shroud_From(CELL cell, int sightrange)
 	*/
 	count = RadiusCount[sightrange];
 	ptr = &RadiusOffset[0];
+	dist = &RadiusDistance[0];
 
 	/*
 	**	Process all offsets required for the desired scan.
@@ -393,8 +421,10 @@ void MapClass::Shroud_From(CELL cell, int sightrange)
 	while (count--) {
 		CELL	newcell;			// New cell with offset.
 		int	xdiff;			// New cell's X coordinate distance from center.
+		int	distance;		// New cell's lepton distance from center.
 
 		newcell = cell + *ptr++;
+		distance = *dist++;
 
 		/*
 		**	Determine if the map edge has been wrapped. If so,
@@ -404,7 +434,7 @@ void MapClass::Shroud_From(CELL cell, int sightrange)
 		xdiff = Cell_X(newcell) - xx;
 		xdiff = ABS(xdiff);
 		if (xdiff > sightrange) continue;
-		if (Distance(Cell_Coord(newcell), Cell_Coord(cell)) > (sightrange * CELL_LEPTON_W)) continue;
+		if (distance > (sightrange * CELL_LEPTON_W)) continue;
 
 		/*
 		**	Shroud the cell.
@@ -438,6 +468,7 @@ void MapClass::Jam_From(CELL cell, int jamrange, HouseClass * house)
 {
 	int xx;				// Center cell X coordinate (bounds checking).
 	int const * ptr;	// Offset pointer.
+	int const * dist;	// Offset distance pointer.
 	int count;			// Counter for number of offsets to process.
 
 	/*
@@ -456,6 +487,7 @@ void MapClass::Jam_From(CELL cell, int jamrange, HouseClass * house)
 	*/
 	count = RadiusCount[jamrange];
 	ptr = &RadiusOffset[0];
+	dist = &RadiusDistance[0];
 
 	/*
 	**	Process all offsets required for the desired scan.
@@ -463,8 +495,10 @@ void MapClass::Jam_From(CELL cell, int jamrange, HouseClass * house)
 	while (count--) {
 		CELL	newcell;			// New cell with offset.
 		int	xdiff;			// New cell's X coordinate distance from center.
+		int	distance;		// New cell's lepton distance from center.
 
 		newcell = cell + *ptr++;
+		distance = *dist++;
 
 		/*
 		**	Determine if the map edge has been wrapped. If so,
@@ -474,7 +508,7 @@ void MapClass::Jam_From(CELL cell, int jamrange, HouseClass * house)
 		xdiff = Cell_X(newcell) - xx;
 		xdiff = ABS(xdiff);
 		if (xdiff > jamrange) continue;
-		if (Distance(Cell_Coord(newcell), Cell_Coord(cell)) > (jamrange * CELL_LEPTON_W)) continue;
+		if (distance > (jamrange * CELL_LEPTON_W)) continue;
 
 		/*
 		**	Jam the cell. For incremental scans, then update
@@ -575,6 +609,7 @@ void MapClass::UnJam_From(CELL cell, int jamrange, HouseClass * house)
 {
 	int xx;				// Center cell X coordinate (bounds checking).
 	int const * ptr;	// Offset pointer.
+	int const * dist;	// Offset distance pointer.
 	int count;			// Counter for number of offsets to process.
 
 	/*
@@ -593,6 +628,7 @@ void MapClass::UnJam_From(CELL cell, int jamrange, HouseClass * house)
 	*/
 	count = RadiusCount[jamrange];
 	ptr = &RadiusOffset[0];
+	dist = &RadiusDistance[0];
 
 	/*
 	**	Process all offsets required for the desired scan.
@@ -600,8 +636,10 @@ void MapClass::UnJam_From(CELL cell, int jamrange, HouseClass * house)
 	while (count--) {
 		CELL	newcell;			// New cell with offset.
 		int	xdiff;			// New cell's X coordinate distance from center.
+		int	distance;		// New cell's lepton distance from center.
 
 		newcell = cell + *ptr++;
+		distance = *dist++;
 
 		/*
 		**	Determine if the map edge has been wrapped. If so,
@@ -611,7 +649,7 @@ void MapClass::UnJam_From(CELL cell, int jamrange, HouseClass * house)
 		xdiff = Cell_X(newcell) - xx;
 		xdiff = ABS(xdiff);
 		if (xdiff > jamrange) continue;
-		if (Distance(Cell_Coord(newcell), Cell_Coord(cell)) > (jamrange * CELL_LEPTON_W)) continue;
+		if (distance > (jamrange * CELL_LEPTON_W)) continue;
 
 		/*
 		**	Jam the cell. For incremental scans, then update
@@ -145,6 +145,7 @@ class MapClass: public GScreenClass
 
 		static int const RadiusCount[11];
 		static int const RadiusOffset[];
+		static int RadiusDistance[];
 
 		/*
 		**	This specifies the information for the various crates in the game.
@@ -0,0 +1,383 @@
+/*
+**	Command & Conquer Red Alert(tm)
+**	Copyright 2025 Electronic Arts Inc.
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/***********************************************************************************************
+ *                                                                                             *
+ *                 Project Name : Command & Conquer                                            *
+ *                                                                                             *
+ *                    File Name : METRICS.CPP                                                  *
+ *                                                                                             *
+ *                   Start Date : 10/19/26                                                     *
+ *                                                                                             *
+ *                  Last Update : October 19, 2026                                             *
+ *                                                                                             *
+ *---------------------------------------------------------------------------------------------*
+ * Functions:                                                                                  *
+ *   MetricsClass::Frame -- Records the end of a game frame.                                   *
+ *   MetricsClass::MetricsClass -- Constructor for the metrics registry.                       *
+ *   MetricsClass::Now -- Fetches the current time in seconds.                                 *
+ *   MetricsClass::Observe -- Records a sample in a histogram.                                 *
+ *   MetricsClass::Publish -- Writes the registry to the metrics file.                         *
+ *   MetricsClass::Sample -- Updates the gauges that are read from the game state.             *
+ *   MetricsClass::Start -- Starts publishing the registry to a file.                          *
+ *   MetricsClass::Stop -- Stops publishing the registry.                                      *
+ *   MetricsClass::Write -- Writes the registry in the Prometheus text format.                 *
+ * - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+#include	"function.h"
+#include	<chrono>
+
+
+/*
+**	The name, description and kind of each metric, in MetricType order.
+*/
+static struct MetricInfoType {
+	char const * Name;
+	char const * Help;
+	bool IsCounter;
+} const MetricInfo[METRIC_COUNT] = {
+	{"redalert_frames_total", "Game frames processed.", true},
+	{"redalert_spare_ticks_total", "Timer ticks spent waiting for the next frame.", true},
+	{"redalert_findpath_calls_total", "Find path calls.", true},
+	{"redalert_target_scans_total", "Target scans.", true},
+	{"redalert_cells_drawn_total", "Map cells drawn.", true},
+	{"redalert_sidebar_redraws_total", "Sidebar redraws.", true},
+	{"redalert_frames_per_second", "Frame rate over the last publish interval.", false},
+	{"redalert_network_response_seconds", "Average network response time.", false},
+	{"redalert_units", "Vehicles in play.", false},
+	{"redalert_infantry", "Infantry in play.", false},
+	{"redalert_buildings", "Buildings in play.", false},
+	{"redalert_aircraft", "Aircraft in play.", false},
+	{"redalert_vessels", "Vessels in play.", false},
+	{"redalert_bullets", "Bullets in flight.", false},
+	{"redalert_anims", "Animations in play.", false},
+	{"redalert_terrains", "Terrain objects on the map.", false},
+	{"redalert_teams", "Teams in play.", false},
+	{"redalert_triggers", "Triggers in play.", false},
+	{"redalert_factories", "Factories in play.", false}
+};
+
+/*
+**	The name, description and bucket upper bounds (in seconds) of each histogram, in
+**	HistogramType order.
+*/
+static struct HistogramInfoType {
+	char const * Name;
+	char const * Help;
+	int BucketCount;
+	double Bound[MetricsClass::BUCKET_MAX];
+} const HistogramInfo[HISTOGRAM_COUNT] = {
+	{"redalert_frame_seconds", "Time from one game frame to the next.",
+		11, {0.005, 0.01, 0.0167, 0.025, 0.0333, 0.05, 0.0667, 0.1, 0.25, 0.5, 1.0}},
+	{"redalert_findpath_seconds", "Time taken by each find path call.",
+		10, {0.00001, 0.000025, 0.00005, 0.0001, 0.00025, 0.0005, 0.001, 0.0025, 0.005, 0.01}},
+	{"redalert_network_rtt_seconds", "Time for a network packet to be acknowledged.",
+		11, {0.0167, 0.0333, 0.05, 0.075, 0.1, 0.15, 0.2, 0.3, 0.5, 1.0, 2.0}}
+};
+
+
+/***********************************************************************************************
+ * MetricsClass::MetricsClass -- Constructor for the metrics registry.                         *
+ *                                                                                             *
+ *    Every metric starts at zero, and the registry is not published until it is started.      *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+MetricsClass::MetricsClass(void) :
+	IsActive(false),
+	Interval(0),
+	LastFrame(0),
+	LastPublish(0),
+	LastFrames(0)
+{
+	memset(Values, '\0', sizeof(Values));
+	memset(Histograms, '\0', sizeof(Histograms));
+	Filename[0] = '\0';
+}
+
+
+/***********************************************************************************************
+ * MetricsClass::Start -- Starts publishing the registry to a file.                            *
+ *                                                                                             *
+ *    From now on the registry is written to the file every so many seconds. Each time, it is  *
+ *    written to a temporary file first and then renamed, so that a reader never sees a file   *
+ *    that is only partly written.                                                             *
+ *                                                                                             *
+ * INPUT:   filename -- The name of the file to publish to.                                    *
+ *                                                                                             *
+ *          interval -- The number of seconds between writes.                                  *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+void MetricsClass::Start(char const * filename, int interval)
+{
+	if (filename == NULL || *filename == '\0') return;
+
+	strncpy(Filename, filename, sizeof(Filename)-1);
+	Filename[sizeof(Filename)-1] = '\0';
+	Interval = max(interval, 1);
+
+	LastFrame = Now();
+	LastPublish = LastFrame;
+	LastFrames = Values[METRIC_FRAMES];
+	IsActive = true;
+}
+
+
+/***********************************************************************************************
+ * MetricsClass::Stop -- Stops publishing the registry.                                        *
+ *                                                                                             *
+ *    The registry is written one last time, so that the file holds the final values.          *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+void MetricsClass::Stop(void)
+{
+	if (IsActive) {
+		Publish();
+		IsActive = false;
+	}
+}
+
+
+/***********************************************************************************************
+ * MetricsClass::Observe -- Records a sample in a histogram.                                   *
+ *                                                                                             *
+ * INPUT:   histogram   -- The histogram to record the sample in.                              *
+ *                                                                                             *
+ *          value       -- The value of the sample, in seconds.                                *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+void MetricsClass::Observe(HistogramType histogram, double value)
+{
+	HistogramInfoType const & info = HistogramInfo[histogram];
+	HistogramDataType & data = Histograms[histogram];
+
+	int bucket = 0;
+	while (bucket < info.BucketCount && value > info.Bound[bucket]) {
+		bucket++;
+	}
+	data.Bucket[bucket]++;
+	data.Count++;
+	data.Sum += value;
+}
+
+
+/***********************************************************************************************
+ * MetricsClass::Frame -- Records the end of a game frame.                                     *
+ *                                                                                             *
+ *    This is called once per pass through the main loop. It counts the frame and, when the    *
+ *    registry is being published, records the frame time and writes the file out whenever     *
+ *    the publish interval has passed.                                                         *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+void MetricsClass::Frame(void)
+{
+	Add(METRIC_FRAMES);
+
+	if (IsActive) {
+		double now = Now();
+		Observe(HISTOGRAM_FRAME_TIME, now - LastFrame);
+		LastFrame = now;
+
+		if (now - LastPublish >= Interval) {
+			Publish();
+		}
+	}
+}
+
+
+/***********************************************************************************************
+ * MetricsClass::Sample -- Updates the gauges that are read from the game state.               *
+ *                                                                                             *
+ *    The object counts are taken straight from the object heaps, and the frame rate is        *
+ *    worked out from the frames processed since the registry was last published.              *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+void MetricsClass::Sample(void)
+{
+	double now = Now();
+	if (now > LastPublish) {
+		Set(METRIC_FRAMES_PER_SECOND, (Values[METRIC_FRAMES] - LastFrames) / (now - LastPublish));
+	}
+	LastPublish = now;
+	LastFrames = Values[METRIC_FRAMES];
+
+	Set(METRIC_UNITS, Units.Count());
+	Set(METRIC_INFANTRY, Infantry.Count());
+	Set(METRIC_BUILDINGS, Buildings.Count());
+	Set(METRIC_AIRCRAFT, Aircraft.Count());
+	Set(METRIC_VESSELS, Vessels.Count());
+	Set(METRIC_BULLETS, Bullets.Count());
+	Set(METRIC_ANIMS, Anims.Count());
+	Set(METRIC_TERRAINS, Terrains.Count());
+	Set(METRIC_TEAMS, Teams.Count());
+	Set(METRIC_TRIGGERS, Triggers.Count());
+	Set(METRIC_FACTORIES, Factories.Count());
+}
+
+
+/***********************************************************************************************
+ * MetricsClass::Publish -- Writes the registry to the metrics file.                           *
+ *                                                                                             *
+ *    The gauges are brought up to date and the whole registry is written to a temporary file, *
+ *    which then replaces the metrics file.                                                    *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  bool; Was the metrics file written?                                                *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+bool MetricsClass::Publish(void)
+{
+	if (Filename[0] == '\0') return(false);
+
+	Sample();
+
+	char tempname[sizeof(Filename)+4];
+	sprintf(tempname, "%s.tmp", Filename);
+
+	RawFileClass file(tempname);
+	int total;
+	{
+		FilePipe pipe(file);
+		total = Write(pipe);
+		total += pipe.End();
+	}
+	file.Close();
+	if (total <= 0) return(false);
+
+	return(file.Rename(Filename));
+}
+
+
+/***********************************************************************************************
+ * MetricsClass::Write -- Writes the registry in the Prometheus text format.                   *
+ *                                                                                             *
+ *    Each counter and gauge is written with its description and type, followed by each        *
+ *    histogram as its running total of samples for every bucket, plus the sum and count.      *
+ *                                                                                             *
+ * INPUT:   pipe  -- Reference to the pipe to write the registry to.                           *
+ *                                                                                             *
+ * OUTPUT:  Returns with the number of bytes written to the pipe.                              *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+int MetricsClass::Write(Pipe & pipe) const
+{
+	char buffer[256];
+	int total = 0;
+
+	for (int metric = METRIC_FIRST; metric < METRIC_COUNT; metric++) {
+		MetricInfoType const & info = MetricInfo[metric];
+		sprintf(buffer, "# HELP %s %s\n# TYPE %s %s\n%s %.15g\n",
+			info.Name, info.Help,
+			info.Name, info.IsCounter ? "counter" : "gauge",
+			info.Name, Values[metric]);
+		total += pipe.Put(buffer, strlen(buffer));
+	}
+
+	for (int histogram = HISTOGRAM_FIRST; histogram < HISTOGRAM_COUNT; histogram++) {
+		HistogramInfoType const & info = HistogramInfo[histogram];
+		HistogramDataType const & data = Histograms[histogram];
+
+		sprintf(buffer, "# HELP %s %s\n# TYPE %s histogram\n", info.Name, info.Help, info.Name);
+		total += pipe.Put(buffer, strlen(buffer));
+
+		unsigned long count = 0;
+		for (int bucket = 0; bucket < info.BucketCount; bucket++) {
+			count += data.Bucket[bucket];
+			sprintf(buffer, "%s_bucket{le=\"%g\"} %lu\n", info.Name, info.Bound[bucket], count);
+			total += pipe.Put(buffer, strlen(buffer));
+		}
+		sprintf(buffer, "%s_bucket{le=\"+Inf\"} %lu\n%s_sum %.15g\n%s_count %lu\n",
+			info.Name, data.Count,
+			info.Name, data.Sum,
+			info.Name, data.Count);
+		total += pipe.Put(buffer, strlen(buffer));
+	}
+
+	return(total);
+}
+
+
+/***********************************************************************************************
+ * MetricsClass::Now -- Fetches the current time in seconds.                                   *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  Returns with the time from a steady clock that is not affected by the system       *
+ *          clock being changed.                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+double MetricsClass::Now(void)
+{
+	return(std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
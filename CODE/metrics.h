@@ -0,0 +1,103 @@
+/*
+**	Command & Conquer Red Alert(tm)
+**	Copyright 2025 Electronic Arts Inc.
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/***********************************************************************************************
+ *                                                                                             *
+ *                 Project Name : Command & Conquer                                            *
+ *                                                                                             *
+ *                    File Name : METRICS.H                                                    *
+ *                                                                                             *
+ *                   Start Date : 10/19/26                                                     *
+ *                                                                                             *
+ *                  Last Update : October 19, 2026                                             *
+ *                                                                                             *
+ *---------------------------------------------------------------------------------------------*
+ * Functions:                                                                                  *
+ * - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+#ifndef METRICS_H
+#define METRICS_H
+
+
+/*
+**	This is the registry of runtime metrics. The game subsystems add to its counters, set its
+**	gauges and record samples in its histograms. When a metrics file is configured, the whole
+**	registry is written to it in the Prometheus text exposition format at a regular interval,
+**	so that a monitoring agent can scrape a running game host without disturbing it.
+*/
+class MetricsClass
+{
+	public:
+		MetricsClass(void);
+
+		void Start(char const * filename, int interval);
+		void Stop(void);
+
+		void Add(MetricType metric, double value=1) {Values[metric] += value;}
+		void Set(MetricType metric, double value) {Values[metric] = value;}
+		void Observe(HistogramType histogram, double value);
+
+		void Frame(void);
+		bool Publish(void);
+		int Write(Pipe & pipe) const;
+
+		static double Now(void);
+
+		/*
+		**	Is the registry being published? The hooks that need to time something check
+		**	this first, so that nothing is timed when no one is looking.
+		*/
+		bool IsActive;
+
+		enum MetricsEnums {
+			BUCKET_MAX=12				// Most buckets that any histogram has.
+		};
+
+	private:
+		/*
+		**	The samples recorded in one histogram. Each bucket counts only the samples that
+		**	fell into it; they are totalled up when written out.
+		*/
+		struct HistogramDataType {
+			unsigned long Bucket[BUCKET_MAX+1];
+			unsigned long Count;
+			double Sum;
+		};
+
+		void Sample(void);
+
+		double Values[METRIC_COUNT];
+		HistogramDataType Histograms[HISTOGRAM_COUNT];
+
+		/*
+		**	The file the registry is published to, and how often it is written.
+		*/
+		char Filename[256];
+		double Interval;
+
+		/*
+		**	Time of the last frame and of the last publish, and the frame count at the last
+		**	publish, used to work out the frame time and frame rate.
+		*/
+		double LastFrame;
+		double LastPublish;
+		double LastFrames;
+};
+
+
+#endif
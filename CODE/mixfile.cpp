@@ -36,13 +36,18 @@
  *                                                                                             *
  *---------------------------------------------------------------------------------------------*
  * Functions:                                                                                  *
+ *   MixFileClass::Build_Directory -- Builds the hash table of all embedded files.             *
  *   MixFileClass::Cache -- Caches the named mixfile into RAM.                                 *
  *   MixFileClass::Cache -- Loads this particular mixfile's data into RAM.                     *
  *   MixFileClass::Finder -- Finds the mixfile object that matches the name specified.         *
  *   MixFileClass::Free -- Uncaches a cached mixfile.                                          *
+ *   MixFileClass::Lookup -- Finds an embedded file by CRC in the directory.                   *
+ *   MixFileClass::Map -- Maps the mixfile data into memory.                                   *
  *   MixFileClass::MixFileClass -- Constructor for mixfile object.                             *
  *   MixFileClass::Offset -- Searches in mixfile for matching file and returns offset if found.*
  *   MixFileClass::Retrieve -- Retrieves a pointer to the specified data file.                 *
+ *   MixFileClass::Unmap -- Releases the mapped mixfile data.                                  *
+ *   MixFileClass::Verify_Digest -- Checks mapped data against the attached digest.            *
  *   MixFileClass::~MixFileClass -- Destructor for the mixfile object.                         *
  * - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
 
@@ -55,6 +60,10 @@
 #include	"cdfile.h"
 extern MFCD temp;
 
+#ifdef PORTABLE
+#include	"file.h"
+#endif
+
 
 //template<class T> int Compare(T const *obj1, T const *obj2) {
 //	if (*obj1 < *obj2) return(-1);
@@ -70,6 +79,18 @@ extern MFCD temp;
 template<class T>
 List<MixFileClass<T> > MixFileClass<T>::List;
 
+/*
+**	The hash table of embedded files for all registered mixfiles.
+*/
+template<class T>
+typename MixFileClass<T>::DirectoryEntry * MixFileClass<T>::Directory = NULL;
+
+template<class T>
+int MixFileClass<T>::DirectorySize = 0;
+
+template<class T>
+bool MixFileClass<T>::IsDirectoryValid = false;
+
 
 /***********************************************************************************************
  * MixFileClass::Free -- Uncaches a cached mixfile.                                            *
@@ -124,6 +145,7 @@ MixFileClass<T>::~MixFileClass(void)
 	if (Filename) {
 		free((char *)Filename);
 	}
+	Unmap();
 	if (Data != NULL && IsAllocated) {
 		delete [] Data;
 		IsAllocated = false;
@@ -139,6 +161,7 @@ MixFileClass<T>::~MixFileClass(void)
 	**	Unlink this mixfile object from the chain.
 	*/
 	this->Unlink();
+	IsDirectoryValid = false;
 }
 
 
@@ -164,12 +187,18 @@ MixFileClass<T>::MixFileClass(char const * filename, PKey const * key) :
 	IsDigest(false),
 	IsEncrypted(false),
 	IsAllocated(false),
+	IsMapped(false),
+	IsVerified(false),
 	Filename(0),
 	Count(0),
 	DataSize(0),
 	DataStart(0),
 	HeaderBuffer(0),
-	Data(0)
+	Data(0),
+	Mapping(0),
+	MappingOffset(0),
+	MappingSize(0),
+	Parent(0)
 {
 	/*
 	**	Check to see if the file is available. If it isn't, then
@@ -245,10 +274,143 @@ MixFileClass<T>::MixFileClass(char const * filename, PKey const * key) :
 	DataStart = file.Seek(0, SEEK_CUR) + file.BiasStart;
 //	DataStart = file.Seek(0, SEEK_CUR);
 
+	/*
+	**	Map the data into memory if possible so that embedded files can be accessed
+	**	directly rather than through the file system.
+	*/
+	Map(file);
+
 	/*
 	**	Attach to list of mixfiles.
 	*/
 	List.Add_Tail(this);
+	IsDirectoryValid = false;
+}
+
+
+/***********************************************************************************************
+ * MixFileClass::Map -- Maps the mixfile data into memory.                                     *
+ *                                                                                             *
+ *    A mixfile on disk has its data section (and digest) mapped privately. A mixfile that     *
+ *    is itself embedded in a mapped mixfile just uses its part of the parent's mapping.       *
+ *    Either way the mixfile then behaves as if it were cached, without reading it all in.     *
+ *                                                                                             *
+ * INPUT:   file  -- The open file the mixfile header was read from.                           *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   If the data can't be mapped, the mixfile is left uncached.                      *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+template<class T>
+void MixFileClass<T>::Map(T & file)
+{
+#ifdef PORTABLE
+	long length = DataSize + (IsDigest ? 20 : 0);
+
+	/*
+	**	A file handle means the mixfile is being read from disk; map its data section.
+	**	The mapping is private, so the data can be modified just like a cached copy.
+	*/
+	if (file.Get_File_Handle() != NULL_HANDLE) {
+		Mapping = IO_Map_File(file.Get_File_Handle(), DataStart, length);
+		if (Mapping != NULL) {
+			MappingOffset = DataStart;
+			MappingSize = length;
+			Data = (void *)Mapping;
+			IsMapped = true;
+		}
+		return;
+	}
+
+	/*
+	**	Otherwise the mixfile is being read from memory. If that memory belongs to a mapped
+	**	parent mixfile, it will stay valid as long as the parent does.
+	*/
+	void * pointer = NULL;
+	MixFileClass<T> * parent = NULL;
+	long size = 0;
+	if (Offset(file.File_Name(), &pointer, &parent, NULL, &size) && pointer != NULL &&
+			parent->IsMapped && size >= DataStart + length) {
+		Data = (char *)pointer + DataStart;
+		Parent = parent;
+		IsMapped = true;
+	}
+#endif
+}
+
+
+/***********************************************************************************************
+ * MixFileClass::Unmap -- Releases the mapped mixfile data.                                    *
+ *                                                                                             *
+ *    Any mixfiles that use part of this mixfile's mapping are unmapped too, so they go back   *
+ *    to reading from disk.                                                                    *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+template<class T>
+void MixFileClass<T>::Unmap(void)
+{
+	if (!IsMapped) return;
+
+#ifdef PORTABLE
+	if (Mapping != NULL) {
+		IO_Unmap_File(Mapping, MappingOffset, MappingSize);
+	}
+#endif
+	Mapping = NULL;
+	Parent = NULL;
+	Data = NULL;
+	IsMapped = false;
+	IsVerified = false;
+
+	MixFileClass<T> * ptr = List.First();
+	while (ptr->Is_Valid()) {
+		if (ptr->Parent == this) {
+			ptr->Unmap();
+		}
+		ptr = ptr->Next();
+	}
+}
+
+
+/***********************************************************************************************
+ * MixFileClass::Verify_Digest -- Checks mapped data against the attached digest.              *
+ *                                                                                             *
+ *    This is the mapped equivalent of the digest check done when a mixfile is cached. It is   *
+ *    only done once for each mapping. As with a mixfile that is not cached, the data of a     *
+ *    mapped mixfile is not checked when it is just read.                                      *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  bool; Does the data match the digest (or is there no digest)?                      *
+ *                                                                                             *
+ * WARNINGS:   This touches every page of the mixfile data.                                    *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+template<class T>
+bool MixFileClass<T>::Verify_Digest(void)
+{
+	if (!IsDigest || IsVerified) return(true);
+
+	char digest[20];
+	SHAEngine sha;
+	sha.Hash(Data, DataSize);
+	sha.Result(digest);
+
+	IsVerified = (memcmp(digest, (char *)Data + DataSize, sizeof(digest)) == 0);
+	return(IsVerified);
 }
 
 
@@ -370,6 +532,16 @@ bool MixFileClass<T>::Cache(char const * filename, Buffer const * buffer)
 template<class T>
 bool MixFileClass<T>::Cache(Buffer const * buffer)
 {
+	/*
+	**	A mapped mixfile is already accessible; it just needs its digest checked. If that
+	**	fails, drop the mapping so that the data is treated as uncached.
+	*/
+	if (IsMapped) {
+		if (Verify_Digest()) return(true);
+		Unmap();
+		return(false);
+	}
+
 	/*
 	**	If the mixfile is already cached, then no action needs to be performed.
 	*/
@@ -472,6 +644,11 @@ bool MixFileClass<T>::Cache(Buffer const * buffer)
 template<class T>
 void MixFileClass<T>::Free(void)
 {
+	/*
+	**	Mapped data doesn't take up any RAM that could be released.
+	*/
+	if (IsMapped) return;
+
 	if (Data != NULL && IsAllocated) {
 		delete [] Data;
 	}
@@ -480,14 +657,6 @@ void MixFileClass<T>::Free(void)
 }
 
 
-int compfunc(void const * ptr1, void const * ptr2)
-{
-	if (*(int32_t const *)ptr1 < *(int32_t const *)ptr2) return(-1);
-	if (*(int32_t const *)ptr1 > *(int32_t const *)ptr2) return(1);
-	return(0);
-}
-
-
 /***********************************************************************************************
  * MixFileClass::Offset -- Determines the offset of the requested file from the mixfile system.*
  *                                                                                             *
@@ -529,51 +698,135 @@ assert(filename != NULL);//BG
 	}
 
 	/*
-	**	Create the key block that will be used to binary search for the file.
+	**	Calculate the CRC of the filename. Mixfiles identify embedded files by the CRC of
+	**	the upper case filename.
 	*/
-	char *upperFilename = strupr(strdup(filename));
-	long crc = Calculate_CRC(upperFilename, strlen(filename));
-	free(upperFilename);
-	SubBlock key;
-	key.CRC = crc;
+	char upper[_MAX_PATH];
+	strncpy(upper, filename, sizeof(upper));
+	upper[sizeof(upper)-1] = '\0';
+	strupr(upper);
+	long crc = Calculate_CRC(upper, strlen(upper));
+
+	/*
+	**	Find the file in the directory of all registered mixfiles. If it is found, then
+	**	extract the appropriate information and store it in the locations provided.
+	*/
+	SubBlock * block = Lookup(crc, &ptr);
+	if (block != NULL) {
+
+		if (mixfile != NULL) *mixfile = ptr;
+		if (size != NULL) *size = block->Size;
+		if (realptr != NULL) *realptr = NULL;
+		if (offset != NULL) *offset = block->Offset;
+		if (realptr != NULL && ptr->Data != NULL) {
+			*realptr = (char *)ptr->Data + block->Offset;
+		}
+		if (ptr->Data == NULL && offset != NULL) {
+			*offset += ptr->DataStart;
+		}
+		return(true);
+	}
 
 	/*
-	**	Sweep through all registered mixfiles, trying to find the file in question.
+	**	None of the mixfiles contain the file. Return with the non success flag.
 	*/
+	return(false);
+}
+
+
+/***********************************************************************************************
+ * MixFileClass::Build_Directory -- Builds the hash table of all embedded files.               *
+ *                                                                                             *
+ *    The mixfiles are added in list order and a file already present is not replaced, so a    *
+ *    lookup finds the same mixfile that searching the list in order would.                    *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+template<class T>
+void MixFileClass<T>::Build_Directory(void)
+{
+	/*
+	**	Size the table so that it is never more than half full.
+	*/
+	int count = 0;
+	MixFileClass<T> * ptr = List.First();
+	while (ptr->Is_Valid()) {
+		count += ptr->Count;
+		ptr = ptr->Next();
+	}
+
+	int size = 16;
+	while (size < count * 2) {
+		size <<= 1;
+	}
+
+	if (size != DirectorySize) {
+		delete [] Directory;
+		Directory = new DirectoryEntry [size];
+		DirectorySize = size;
+	}
+	memset(Directory, 0, size * sizeof(DirectoryEntry));
+
 	ptr = List.First();
 	while (ptr->Is_Valid()) {
-		SubBlock * block;
+		for (int index = 0; ptr->HeaderBuffer != NULL && index < ptr->Count; index++) {
+			SubBlock * block = &ptr->HeaderBuffer[index];
+			unsigned slot = Hash_CRC(block->CRC) & (DirectorySize-1);
 
-		/*
-		**	Binary search for the file in this mixfile. If it is found, then extract the
-		**	appropriate information and store it in the locations provided and then return.
-		*/
-		block = (SubBlock *)bsearch(&key, ptr->HeaderBuffer, ptr->Count, sizeof(SubBlock), compfunc);
-		if (block != NULL) {
-			if (mixfile != NULL) *mixfile = ptr;
-			if (size != NULL) *size = block->Size;
-			if (realptr != NULL) *realptr = NULL;
-			if (offset != NULL) *offset = block->Offset;
-			if (realptr != NULL && ptr->Data != NULL) {
-				*realptr = (char *)ptr->Data + block->Offset;
+			while (Directory[slot].Mixfile != NULL && Directory[slot].Block->CRC != block->CRC) {
+				slot = (slot + 1) & (DirectorySize-1);
 			}
-			if (ptr->Data == NULL && offset != NULL) {
-				*offset += ptr->DataStart;
+
+			if (Directory[slot].Mixfile == NULL) {
+				Directory[slot].Mixfile = ptr;
+				Directory[slot].Block = block;
 			}
-			return(true);
 		}
-
-		/*
-		**	Advance to next mixfile.
-		*/
 		ptr = ptr->Next();
 	}
 
-	/*
-	**	All the mixfiles have been examined but no match was found. Return with the non success flag.
-	*/
-assert(1);//BG
-	return(false);
+	IsDirectoryValid = true;
+}
+
+
+/***********************************************************************************************
+ * MixFileClass::Lookup -- Finds an embedded file by CRC in the directory.                     *
+ *                                                                                             *
+ * INPUT:   crc      -- The CRC of the upper case filename.                                    *
+ *                                                                                             *
+ *          mixfile  -- The mixfile that holds the file is stored here.                        *
+ *                                                                                             *
+ * OUTPUT:  Returns with a pointer to the file's header entry, or NULL if not found.           *
+ *                                                                                             *
+ * WARNINGS:   The directory is rebuilt if mixfiles were added or removed since the last       *
+ *             lookup.                                                                         *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+template<class T>
+typename MixFileClass<T>::SubBlock * MixFileClass<T>::Lookup(int32_t crc, MixFileClass ** mixfile)
+{
+	if (!IsDirectoryValid) {
+		Build_Directory();
+	}
+
+	unsigned slot = Hash_CRC(crc) & (DirectorySize-1);
+	while (Directory[slot].Mixfile != NULL) {
+		if (Directory[slot].Block->CRC == crc) {
+			*mixfile = Directory[slot].Mixfile;
+			return(Directory[slot].Block);
+		}
+		slot = (slot + 1) & (DirectorySize-1);
+	}
+	return(NULL);
 }
 
 template class MixFileClass<CCFileClass>;
\ No newline at end of file
@@ -57,6 +57,15 @@ class MixFileClass : public Node<MixFileClass<T> >
 	private:
 		static MixFileClass * Finder(char const * filename);
 		long Offset(long crc, long * size = 0) const;
+		void Map(T & file);
+		void Unmap(void);
+		bool Verify_Digest(void);
+		static void Build_Directory(void);
+		static SubBlock * Lookup(int32_t crc, MixFileClass ** mixfile);
+		static unsigned Hash_CRC(int32_t crc) {
+			unsigned hash = (unsigned)crc * 0x9E3779B1U;
+			return(hash ^ (hash >> 16));
+		}
 
 		/*
 		**	If this mixfile has an attached message digest, then this flag
@@ -78,6 +87,19 @@ class MixFileClass : public Node<MixFileClass<T> >
 		*/
 		unsigned IsAllocated:1;
 
+		/*
+		**	If the data is a private view mapped from the mixfile on disk (or borrowed
+		**	from a mapped parent mixfile), then this flag is true. Mapped data is never
+		**	freed by Free(); the operating system pages it in and out as needed.
+		*/
+		unsigned IsMapped:1;
+
+		/*
+		**	If the attached message digest has been checked against the data, then this
+		**	flag will be true.
+		*/
+		unsigned IsVerified:1;
+
 		/*
 		**	This is the initial file header. It tells how many files are embedded
 		**	within this mixfile and the total size of all embedded files.
@@ -116,7 +138,30 @@ class MixFileClass : public Node<MixFileClass<T> >
 		*/
 		void * Data;						// Pointer to raw data.
 
+		/*
+		**	Details of the mapping made for this mixfile. Mapping is NULL if the data
+		**	isn't mapped or was borrowed from the parent mixfile.
+		*/
+		void const * Mapping;
+		long MappingOffset;
+		long MappingSize;
+		MixFileClass * Parent;
+
 		static List<MixFileClass> List;
+
+		/*
+		**	This is a hash table of every embedded file in all registered mixfiles, keyed
+		**	by CRC. When more than one mixfile holds a file with the same CRC, the entry
+		**	is for the mixfile that was registered first, just as a search of the list
+		**	would find. It is rebuilt on the next search after the list changes.
+		*/
+		struct DirectoryEntry {
+			MixFileClass * Mixfile;		// NULL for an empty slot.
+			SubBlock * Block;
+		};
+		static DirectoryEntry * Directory;
+		static int DirectorySize;			// Always a power of 2.
+		static bool IsDirectoryValid;
 };
 
 #endif
@@ -57,6 +57,8 @@
  *   XMP_Is_Small_Prime -- Determine if MP number is a small prime.                            *
  *   XMP_Mod_Mult -- Perform a multiply - modulus operation.                                   *
  *   XMP_Mod_Mult_Clear -- Remove temporary values from memory.                                *
+ *   XMP_Mont_Exponent_Mod -- Modular exponentiation using Montgomery multiplication.          *
+ *   XMP_Mont_Mult -- Montgomery multiply of two numbers.                                      *
  *   XMP_Move -- Assign one MP number to another.                                              *
  *   XMP_Neg -- Negate the specified MP number.                                                *
  *   XMP_Not -- Perform bitwise NOT operation on MP number.                                    *
@@ -2075,6 +2077,304 @@ unsigned short mp_quo_digit(unsigned short * dividend)
 }
 
 
+/*
+**	Montgomery multiplication works on the numbers in limbs as wide as the processor can
+**	multiply in one step. When the compiler offers a 128 bit integer, the limbs are 64 bits
+**	wide; otherwise they are the same 32 bit digits used everywhere else.
+*/
+#if defined(__SIZEOF_INT128__)
+typedef uint64_t mlimb;
+typedef unsigned __int128 mwide;
+#define	MLIMB_BITS				64
+#else
+typedef uint32_t mlimb;
+typedef uint64_t mwide;
+#define	MLIMB_BITS				32
+#endif
+#define	DIGITS_PER_LIMB		(MLIMB_BITS/UNITSIZE)
+#define	MAX_LIMB_PRECISION	(MAX_UNIT_PRECISION/DIGITS_PER_LIMB)
+
+/*
+**	Largest window of exponent bits handled at once. The table of odd powers used by the
+**	window holds 2^(MAX_WINDOW_BITS-1) numbers.
+*/
+#define	MAX_WINDOW_BITS		6
+
+/*
+**	The last modulus raised to a power, and R*R mod n for it.
+*/
+static int _mont_limbs = 0;
+static mlimb _mont_modulus[MAX_LIMB_PRECISION];
+static mlimb _mont_rr[MAX_LIMB_PRECISION];
+
+
+/***********************************************************************************************
+ * XMP_Mont_Mult -- Montgomery multiply of two numbers.                                        *
+ *                                                                                             *
+ *    This computes (a * b / R) mod n, where R is 2 raised to the number of bits in the limbs  *
+ *    of the modulus. The multiply and the reduction are interleaved a limb at a time, so no   *
+ *    division is ever needed.                                                                 *
+ *                                                                                             *
+ * INPUT:   prod        -- Pointer to the buffer that will hold the result. It may be the same *
+ *                         as either multiplicand.                                             *
+ *                                                                                             *
+ *          a           -- Pointer to the first number. It must be less than the modulus.      *
+ *                                                                                             *
+ *          b           -- Pointer to the second number. It must be less than the modulus.     *
+ *                                                                                             *
+ *          modulus     -- Pointer to the (odd) modulus.                                       *
+ *                                                                                             *
+ *          inverse     -- The negative inverse of the lowest limb of the modulus.             *
+ *                                                                                             *
+ *          limbs       -- The number of limbs in the numbers.                                 *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+static void XMP_Mont_Mult(mlimb * prod, mlimb const * a, mlimb const * b, mlimb const * modulus, mlimb inverse, int limbs)
+{
+	mlimb t[MAX_LIMB_PRECISION+2];
+	memset(t, 0, (limbs+2) * sizeof(mlimb));
+
+	for (int i = 0; i < limbs; i++) {
+
+		/*
+		**	Accumulate the next limb of the product.
+		*/
+		mwide carry = 0;
+		for (int j = 0; j < limbs; j++) {
+			mwide sum = (mwide)a[j] * b[i] + t[j] + carry;
+			t[j] = (mlimb)sum;
+			carry = sum >> MLIMB_BITS;
+		}
+		mwide sum = (mwide)t[limbs] + carry;
+		t[limbs] = (mlimb)sum;
+		t[limbs+1] = (mlimb)(sum >> MLIMB_BITS);
+
+		/*
+		**	Add the multiple of the modulus that clears the lowest limb, then drop
+		**	that limb.
+		*/
+		mlimb m = t[0] * inverse;
+		carry = ((mwide)m * modulus[0] + t[0]) >> MLIMB_BITS;
+		for (int j = 1; j < limbs; j++) {
+			sum = (mwide)m * modulus[j] + t[j] + carry;
+			t[j-1] = (mlimb)sum;
+			carry = sum >> MLIMB_BITS;
+		}
+		sum = (mwide)t[limbs] + carry;
+		t[limbs-1] = (mlimb)sum;
+		t[limbs] = t[limbs+1] + (mlimb)(sum >> MLIMB_BITS);
+	}
+
+	/*
+	**	The result is less than twice the modulus. Subtract the modulus once if needed.
+	*/
+	bool reduce = (t[limbs] != 0);
+	if (!reduce) {
+		reduce = true;
+		for (int j = limbs-1; j >= 0; j--) {
+			if (t[j] != modulus[j]) {
+				reduce = (t[j] > modulus[j]);
+				break;
+			}
+		}
+	}
+	if (reduce) {
+		mlimb borrow = 0;
+		for (int j = 0; j < limbs; j++) {
+			mlimb diff = t[j] - modulus[j];
+			mlimb borrow_out = (t[j] < modulus[j]) || (diff < borrow);
+			t[j] = diff - borrow;
+			borrow = borrow_out;
+		}
+	}
+
+	memmove(prod, t, limbs * sizeof(mlimb));
+	memset(t, 0, sizeof(t));
+}
+
+
+/***********************************************************************************************
+ * XMP_Mont_Exponent_Mod -- Modular exponentiation using Montgomery multiplication.            *
+ *                                                                                             *
+ *    This computes (expin ** exponent) mod modulus for an odd modulus. The numbers are        *
+ *    converted into limbs in Montgomery form, then the exponent is scanned from the top in    *
+ *    windows of several bits. Each window takes one multiply by a precomputed odd power of    *
+ *    the base, instead of one multiply for each set bit.                                      *
+ *                                                                                             *
+ * INPUT:   expout      -- Pointer to the buffer that will hold the result.                    *
+ *                                                                                             *
+ *          expin       -- Pointer to the base. It must be less than the modulus.              *
+ *                                                                                             *
+ *          exponent_ptr-- Pointer to the exponent. It must not be zero.                       *
+ *                                                                                             *
+ *          modulus     -- Pointer to the modulus. It must be odd.                             *
+ *                                                                                             *
+ *          precision   -- The precision of the numbers (significant digits of the modulus).   *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+static void XMP_Mont_Exponent_Mod(digit * expout, const digit * expin, const digit * exponent_ptr, const digit * modulus, int precision)
+{
+	int limbs = (precision + DIGITS_PER_LIMB - 1) / DIGITS_PER_LIMB;
+
+	/*
+	**	Lift the modulus and the base into limbs.
+	*/
+	mlimb mod[MAX_LIMB_PRECISION];
+	mlimb base[MAX_LIMB_PRECISION];
+	memset(mod, 0, limbs * sizeof(mlimb));
+	memset(base, 0, limbs * sizeof(mlimb));
+	for (int index = 0; index < precision; index++) {
+		int shift = (index % DIGITS_PER_LIMB) * UNITSIZE;
+		mod[index / DIGITS_PER_LIMB] |= (mlimb)modulus[index] << shift;
+		base[index / DIGITS_PER_LIMB] |= (mlimb)expin[index] << shift;
+	}
+
+	/*
+	**	The negative inverse of the lowest limb of the modulus. Each step of Newton's
+	**	iteration doubles the number of correct low bits.
+	*/
+	mlimb inverse = 1;
+	for (int bits = 1; bits < MLIMB_BITS; bits *= 2) {
+		inverse *= 2 - mod[0] * inverse;
+	}
+	inverse = 0 - inverse;
+
+	/*
+	**	Find R*R mod n (used to bring numbers into Montgomery form) by doubling one
+	**	up to it with a subtract whenever it passes the modulus. The same modulus
+	**	is used over and over (such as the public key for each mixfile), so the
+	**	last one is remembered. The modulus is public, so there is no harm in that.
+	*/
+	mlimb rr[MAX_LIMB_PRECISION];
+	if (limbs == _mont_limbs && memcmp(mod, _mont_modulus, limbs * sizeof(mlimb)) == 0) {
+		memmove(rr, _mont_rr, limbs * sizeof(mlimb));
+	} else {
+		memset(rr, 0, limbs * sizeof(mlimb));
+		rr[0] = 1;
+		for (int bit = 0; bit < 2 * limbs * MLIMB_BITS; bit++) {
+			mlimb top = rr[limbs-1] >> (MLIMB_BITS-1);
+			for (int j = limbs-1; j > 0; j--) {
+				rr[j] = (rr[j] << 1) | (rr[j-1] >> (MLIMB_BITS-1));
+			}
+			rr[0] <<= 1;
+
+			bool reduce = (top != 0);
+			if (!reduce) {
+				reduce = true;
+				for (int j = limbs-1; j >= 0; j--) {
+					if (rr[j] != mod[j]) {
+						reduce = (rr[j] > mod[j]);
+						break;
+					}
+				}
+			}
+			if (reduce) {
+				mlimb borrow = 0;
+				for (int j = 0; j < limbs; j++) {
+					mlimb diff = rr[j] - mod[j];
+					mlimb borrow_out = (rr[j] < mod[j]) || (diff < borrow);
+					rr[j] = diff - borrow;
+					borrow = borrow_out;
+				}
+			}
+		}
+
+		_mont_limbs = limbs;
+		memmove(_mont_modulus, mod, limbs * sizeof(mlimb));
+		memmove(_mont_rr, rr, limbs * sizeof(mlimb));
+	}
+
+	/*
+	**	Pick the window size from the length of the exponent. Bigger windows save
+	**	multiplies, but cost more to set up.
+	*/
+	int total_bit_count = XMP_Count_Bits(exponent_ptr, precision);
+	int window = 1;
+	if (total_bit_count > 671) window = 6;
+	else if (total_bit_count > 239) window = 5;
+	else if (total_bit_count > 79) window = 4;
+	else if (total_bit_count > 23) window = 3;
+
+	/*
+	**	Build the table of odd powers of the base: base, base^3, base^5, ...
+	*/
+	mlimb table[1 << (MAX_WINDOW_BITS-1)][MAX_LIMB_PRECISION];
+	mlimb square[MAX_LIMB_PRECISION];
+	XMP_Mont_Mult(table[0], base, rr, mod, inverse, limbs);
+	XMP_Mont_Mult(square, table[0], table[0], mod, inverse, limbs);
+	for (int index = 1; index < (1 << (window-1)); index++) {
+		XMP_Mont_Mult(table[index], table[index-1], square, mod, inverse, limbs);
+	}
+
+	/*
+	**	Scan the exponent from the top. Runs of zero bits are just squares. Otherwise
+	**	the longest window (ending in a set bit) is taken, squared in, and multiplied
+	**	by its odd power from the table.
+	*/
+	mlimb accum[MAX_LIMB_PRECISION];
+	bool first = true;
+	int bit = total_bit_count - 1;
+	while (bit >= 0) {
+		if (!XMP_Test_Bit(exponent_ptr, bit)) {
+			XMP_Mont_Mult(accum, accum, accum, mod, inverse, limbs);
+			bit--;
+			continue;
+		}
+
+		int low = bit - window + 1;
+		if (low < 0) low = 0;
+		while (!XMP_Test_Bit(exponent_ptr, low)) low++;
+
+		int value = 0;
+		for (int index = bit; index >= low; index--) {
+			value = (value << 1) | (XMP_Test_Bit(exponent_ptr, index) ? 1 : 0);
+		}
+
+		if (first) {
+			memmove(accum, table[value >> 1], limbs * sizeof(mlimb));
+			first = false;
+		} else {
+			for (int index = bit; index >= low; index--) {
+				XMP_Mont_Mult(accum, accum, accum, mod, inverse, limbs);
+			}
+			XMP_Mont_Mult(accum, accum, table[value >> 1], mod, inverse, limbs);
+		}
+		bit = low - 1;
+	}
+
+	/*
+	**	Bring the result out of Montgomery form and store it back into digits.
+	*/
+	memset(square, 0, limbs * sizeof(mlimb));
+	square[0] = 1;
+	XMP_Mont_Mult(accum, accum, square, mod, inverse, limbs);
+	for (int index = 0; index < precision; index++) {
+		expout[index] = (digit)(accum[index / DIGITS_PER_LIMB] >> ((index % DIGITS_PER_LIMB) * UNITSIZE));
+	}
+
+	/*
+	**	Burn the intermediate values so that no sensitive data is left in memory.
+	*/
+	memset(base, 0, sizeof(base));
+	memset(rr, 0, sizeof(rr));
+	memset(table, 0, sizeof(table));
+	memset(square, 0, sizeof(square));
+	memset(accum, 0, sizeof(accum));
+}
+
+
 /*
 ** Russian peasant combined exponentiation/modulo algorithm.
 ** Calls modmult instead of mult.
@@ -2108,6 +2408,15 @@ int xmp_exponent_mod(digit * expout, const digit * expin, const digit * exponent
 	/* set smallest optimum precision for this modulus */
 	int limited_precision = XMP_Significance(modulus, precision);
 
+	/*
+	**	An odd modulus (as every RSA modulus and prime candidate is) can use Montgomery
+	**	multiplication, which is much faster than the reciprocal method below.
+	*/
+	if (*modulus & 1) {
+		XMP_Mont_Exponent_Mod(expout, expin, exponent_ptr, modulus, limited_precision);
+		return 0;
+	}
+
 	if (XMP_Prepare_Modulus(modulus, limited_precision)) {
 		return -5;		/* unstageable modulus (STEWART algorithm) */
 	}
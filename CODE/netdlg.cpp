@@ -5042,7 +5042,7 @@ static int Net_New_Dialog(void)
 		//	- Divide global channel's response time by 8 (2 to convert to 1-way
 		//	  value, 4 more to convert from ticks to frames)
 		//.....................................................................
-		if (Session.CommProtocol == COMM_PROTOCOL_MULTI_E_COMP) {
+		if (Session.CommProtocol >= COMM_PROTOCOL_MULTI_E_COMP) {
 			Session.MaxAhead = max( ((((Ipx.Global_Response_Time() / 8) +
 				(Session.FrameSendRate - 1)) / Session.FrameSendRate) *
 				Session.FrameSendRate), (Session.FrameSendRate * 2) );
@@ -6687,7 +6687,7 @@ static int Net_Fake_New_Dialog(void)
 		//	- Divide global channel's response time by 8 (2 to convert to 1-way
 		//	  value, 4 more to convert from ticks to frames)
 		//.....................................................................
-		if (Session.CommProtocol == COMM_PROTOCOL_MULTI_E_COMP) {
+		if (Session.CommProtocol >= COMM_PROTOCOL_MULTI_E_COMP) {
 			Session.MaxAhead = MAX( ((((Ipx.Global_Response_Time() / 8) +
 				(Session.FrameSendRate - 1)) / Session.FrameSendRate) *
 				Session.FrameSendRate), (Session.FrameSendRate * 2) );
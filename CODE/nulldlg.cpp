@@ -4460,7 +4460,7 @@ oh_dear_its_a_label:
 		// a packet
 		//
 		if (!skirmish) {
-			if (Session.CommProtocol == COMM_PROTOCOL_MULTI_E_COMP) {
+			if (Session.CommProtocol >= COMM_PROTOCOL_MULTI_E_COMP) {
 				Session.MaxAhead = max( ((((SendPacket.ScenarioInfo.ResponseTime / 8) +
 					(Session.FrameSendRate - 1)) / Session.FrameSendRate) *
 					Session.FrameSendRate), (Session.FrameSendRate * 2)
@@ -6084,7 +6084,7 @@ int Com_Show_Scenario_Dialog(void)
 						// calculated one way delay for a packet and overall delay
 						// to execute a packet
 						//
-						if (Session.CommProtocol == COMM_PROTOCOL_MULTI_E_COMP) {
+						if (Session.CommProtocol >= COMM_PROTOCOL_MULTI_E_COMP) {
 							Session.MaxAhead = max( ((((ReceivePacket.ScenarioInfo.ResponseTime / 8) +
 								(Session.FrameSendRate - 1)) / Session.FrameSendRate) *
 								Session.FrameSendRate), (Session.FrameSendRate * 2) );
@@ -42,6 +42,8 @@
  *   NullModemClass::Num_Send -- Returns # of unACK'd send entries			*
  *   NullModemClass::Num_Receive -- Returns # entries in the receive queue *
  *   NullModemClass::Response_Time -- Returns Queue's avg response time    *
+ *   NullModemClass::Percentile_Response_Time -- response time percentile  *
+ *   NullModemClass::Response_Jitter -- Returns Queue's response jitter    *
  *   NullModemClass::Reset_Response_Time -- Resets response time computatio*
  *   NullModemClass::Oldest_Send -- Returns ptr to oldest unACK'd send buf *
  *   NullModemClass::Detect_Modem -- Detects and initializes the modem     *
@@ -1245,6 +1247,56 @@ unsigned long NullModemClass::Response_Time(void)
 }	/* end of Response_Time */
 
 
+/***************************************************************************
+ * NullModemClass::Percentile_Response_Time -- response time percentile    *
+ *                                                                         *
+ * INPUT:                                                                  *
+ *		percent		percentile to find (1-100)											*
+ *                                                                         *
+ * OUTPUT:                                                                 *
+ *		Queue's response time percentile													*
+ *                                                                         *
+ * WARNINGS:                                                               *
+ *		none.																						*
+ *                                                                         *
+ * HISTORY:                                                                *
+ *   10/19/2026 AGT : Created.                                             *
+ *=========================================================================*/
+unsigned long NullModemClass::Percentile_Response_Time(int percent)
+{
+	if (Connection)
+		return( Connection->Queue->Percentile_Response_Time(percent) );
+	else
+		return (0);
+
+}	/* end of Percentile_Response_Time */
+
+
+/***************************************************************************
+ * NullModemClass::Response_Jitter -- Returns Queue's response jitter      *
+ *                                                                         *
+ * INPUT:                                                                  *
+ *		none.																						*
+ *                                                                         *
+ * OUTPUT:                                                                 *
+ *		Queue's response time jitter														*
+ *                                                                         *
+ * WARNINGS:                                                               *
+ *		none.																						*
+ *                                                                         *
+ * HISTORY:                                                                *
+ *   10/19/2026 AGT : Created.                                             *
+ *=========================================================================*/
+unsigned long NullModemClass::Response_Jitter(void)
+{
+	if (Connection)
+		return( Connection->Queue->Response_Jitter() );
+	else
+		return (0);
+
+}	/* end of Response_Jitter */
+
+
 /***************************************************************************
  * NullModemClass::Reset_Response_Time -- Resets response time computation *
  *                                                                         *
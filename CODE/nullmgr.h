@@ -136,6 +136,8 @@ class NullModemClass : public ConnManClass
 		int Num_Send(void);
 		int Num_Receive(void);
 		virtual unsigned long Response_Time(void);
+		virtual unsigned long Percentile_Response_Time(int percent);
+		virtual unsigned long Response_Jitter(void);
 		virtual void Reset_Response_Time(void);
 		void * Oldest_Send(void);
 		virtual void Configure_Debug(int index, int type_offset, int type_size,
@@ -108,6 +108,10 @@ OptionsClass::OptionsClass(void) :
 	IsScoreRepeat(false),
 	IsScoreShuffle(false),
 	IsPaletteScroll(true),
+	CheckpointInterval(0),
+	IsNetworkThread(false),
+	LatencyPercentile(95),
+	MetricsInterval(10),
 
 	KeyForceMove1(KN_LALT),
 	KeyForceMove2(KN_RALT),
@@ -157,8 +161,10 @@ OptionsClass::OptionsClass(void) :
 	KeyTeam7(KN_7),
 	KeyTeam8(KN_8),
 	KeyTeam9(KN_9),
-	KeyTeam10(KN_0)
+	KeyTeam10(KN_0),
+	KeyProfile(KN_NONE)
 {
+	MetricsFile[0] = '\0';
 }
 
 
@@ -593,6 +599,11 @@ void OptionsClass::Load_Settings(void)
 	Set_Shuffle(ini.Get_Bool(OPTIONS, "IsScoreShuffle", IsScoreShuffle));
 	SlowPalette = ini.Get_Bool(OPTIONS, "SlowPalette", SlowPalette);
 	IsPaletteScroll = ini.Get_Bool(OPTIONS, "PaletteScroll", IsPaletteScroll);
+	CheckpointInterval = ini.Get_Int(OPTIONS, "CheckpointInterval", CheckpointInterval);
+	IsNetworkThread = ini.Get_Bool(OPTIONS, "NetworkThread", IsNetworkThread);
+	LatencyPercentile = Bound(ini.Get_Int(OPTIONS, "LatencyPercentile", LatencyPercentile), 0, 100);
+	ini.Get_String(OPTIONS, "MetricsFile", "", MetricsFile, sizeof(MetricsFile));
+	MetricsInterval = ini.Get_Int(OPTIONS, "MetricsInterval", MetricsInterval);
 
 	KeyForceMove1 = (KeyNumType)ini.Get_Int(HotkeyName, "KeyForceMove1", KeyForceMove1);
 	KeyForceMove2 = (KeyNumType)ini.Get_Int(HotkeyName, "KeyForceMove2", KeyForceMove2);
@@ -643,6 +654,7 @@ void OptionsClass::Load_Settings(void)
 	KeyTeam8 =  (KeyNumType)ini.Get_Int(HotkeyName, "KeyTeam8", KeyTeam8);
 	KeyTeam9 =  (KeyNumType)ini.Get_Int(HotkeyName, "KeyTeam9", KeyTeam9);
 	KeyTeam10 =  (KeyNumType)ini.Get_Int(HotkeyName, "KeyTeam10", KeyTeam10);
+	KeyProfile =  (KeyNumType)ini.Get_Int(HotkeyName, "KeyProfile", KeyProfile);
 
 
 #ifdef WIN32
@@ -695,6 +707,7 @@ void OptionsClass::Load_Settings(void)
 	KeyTeam8 = (KeyNumType)(KeyTeam8 & ~WWKEY_VK_BIT);
 	KeyTeam9 = (KeyNumType)(KeyTeam9 & ~WWKEY_VK_BIT);
 	KeyTeam10 = (KeyNumType)(KeyTeam10 & ~WWKEY_VK_BIT);
+	KeyProfile = (KeyNumType)(KeyProfile & ~WWKEY_VK_BIT);
 #endif
 }
 
@@ -804,6 +817,7 @@ void OptionsClass::Save_Settings (void)
 	ini.Put_Int(HotkeyName, "KeyTeam8", KeyTeam8);
 	ini.Put_Int(HotkeyName, "KeyTeam9", KeyTeam9);
 	ini.Put_Int(HotkeyName, "KeyTeam10", KeyTeam10);
+	ini.Put_Int(HotkeyName, "KeyProfile", KeyProfile);
 
 	/*
 	**	Write the INI data out to a file.
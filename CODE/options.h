@@ -95,6 +95,31 @@ class OptionsClass {
 		unsigned IsScoreShuffle:1;	// Score list should shuffle?
 		unsigned IsPaletteScroll:1;// Allow palette scrolling?
 
+		/*
+		**	Seconds between crash recovery checkpoints (zero disables them). This is only
+		**	read from the INI file; there is no option screen control for it.
+		*/
+		int CheckpointInterval;
+
+		/*
+		**	Read UDP packets on a separate network thread so they are timestamped as they
+		**	arrive. This is only read from the INI file.
+		*/
+		unsigned IsNetworkThread:1;
+
+		/*
+		**	Percentile of measured connection response times that MaxAhead is chosen to
+		**	cover (zero uses the average response time instead). Only read from the INI file.
+		*/
+		int LatencyPercentile;
+
+		/*
+		**	File that the runtime metrics are published to (empty disables them), and the
+		**	seconds between writes. These are only read from the INI file.
+		*/
+		char MetricsFile[_MAX_PATH];
+		int MetricsInterval;
+
 		/*
 		**	These are the hotkeys used for keyboard control.
 		*/
@@ -147,6 +172,7 @@ class OptionsClass {
 		KeyNumType KeyTeam8;
 		KeyNumType KeyTeam9;
 		KeyNumType KeyTeam10;
+		KeyNumType KeyProfile;
 
 		void Adjust_Palette(PaletteClass const & oldpal, PaletteClass & newpal, fixed brightness, fixed color, fixed tint, fixed contrast) const;
 	protected:
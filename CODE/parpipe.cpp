@@ -0,0 +1,400 @@
+/*
+**	Command & Conquer Red Alert(tm)
+**	Copyright 2025 Electronic Arts Inc.
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/***********************************************************************************************
+ *                                                                                             *
+ *                 Project Name : Command & Conquer                                            *
+ *                                                                                             *
+ *                    File Name : PARPIPE.CPP                                                  *
+ *                                                                                             *
+ *                   Start Date : 10/19/26                                                     *
+ *                                                                                             *
+ *                  Last Update : October 19, 2026                                             *
+ *                                                                                             *
+ *---------------------------------------------------------------------------------------------*
+ * Functions:                                                                                  *
+ *   ParallelPipe::Commit -- Accumulate the data written to the reserved space.                *
+ *   ParallelPipe::Flush -- Flushes any partially accumulated block.                           *
+ *   ParallelPipe::ParallelPipe -- Constructor for the parallel block processor pipe.          *
+ *   ParallelPipe::Process_Blocks -- Process the accumulated blocks and pass them on.          *
+ *   ParallelPipe::Put -- Send some data through the parallel block processor pipe.            *
+ *   ParallelPipe::Reserve -- Fetch space in the block being accumulated.                      *
+ *   ParallelPipe::~ParallelPipe -- Destructor for the parallel block pipe.                    *
+ * - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+#include	"parpipe.h"
+#include	<string.h>
+#include	<assert.h>
+
+
+/***********************************************************************************************
+ * ParallelPipe::ParallelPipe -- Constructor for the parallel block processor pipe.            *
+ *                                                                                             *
+ *    This will allocate the buffers for all the blocks that may be in flight at once.         *
+ *                                                                                             *
+ * INPUT:   codec    -- The compressor to use.                                                 *
+ *                                                                                             *
+ *          control  -- Should compression or decompression be performed?                      *
+ *                                                                                             *
+ *          blocksize-- The size of the data blocks to process.                                *
+ *                                                                                             *
+ *          inflight -- The number of blocks to process at once. Pass 0 to use twice the       *
+ *                      number of threads that work on the blocks.                             *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+ParallelPipe::ParallelPipe(BlockCodecType codec, CompControl control, int blocksize, int inflight) :
+		Codec(codec),
+		Control(control),
+		BlockSize(blocksize),
+		Slots(NULL),
+		Jobs(NULL),
+		SlotCount(inflight),
+		InputSize(0),
+		OutputSize(0),
+		Filled(0),
+		Counter(0),
+		HeaderCount(0)
+{
+	if (SlotCount < 1) {
+		SlotCount = BlockWorkClass::Thread_Count() * 2;
+	}
+
+	InputSize = BlockWorkClass::Compress_Bound(BlockSize);
+	OutputSize = BlockWorkClass::Compress_Bound(BlockSize);
+
+	Slots = new SlotType[SlotCount];
+	Jobs = new BlockJobType[SlotCount];
+	for (int index = 0; index < SlotCount; index++) {
+		Slots[index].Input = new char[InputSize];
+		Slots[index].Output = new char[OutputSize];
+	}
+}
+
+
+/***********************************************************************************************
+ * ParallelPipe::~ParallelPipe -- Destructor for the parallel block pipe.                      *
+ *                                                                                             *
+ *    This will free the block buffers.                                                        *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+ParallelPipe::~ParallelPipe(void)
+{
+	if (Slots != NULL) {
+		for (int index = 0; index < SlotCount; index++) {
+			delete [] Slots[index].Input;
+			delete [] Slots[index].Output;
+		}
+	}
+	delete [] Slots;
+	Slots = NULL;
+
+	delete [] Jobs;
+	Jobs = NULL;
+}
+
+
+/***********************************************************************************************
+ * ParallelPipe::Process_Blocks -- Process the accumulated blocks and pass them on.            *
+ *                                                                                             *
+ *    All the whole blocks accumulated are compressed (or decompressed) at the same time.      *
+ *    Then they are sent on down the pipe, in the order they came in.                          *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  Returns with the actual number of bytes output at the far distant final link in    *
+ *          the pipe chain.                                                                    *
+ *                                                                                             *
+ * WARNINGS:   A compressed block that is too big for the buffers is corrupt. It is dropped.   *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+int ParallelPipe::Process_Blocks(void)
+{
+	int total = 0;
+	int count = 0;
+
+	for (int index = 0; index < Filled; index++) {
+		SlotType & slot = Slots[index];
+
+		if (Control == DECOMPRESS && (slot.Header.CompCount > InputSize || slot.Header.UncompCount > OutputSize)) {
+			continue;
+		}
+
+		BlockJobType & job = Jobs[count++];
+		job.Codec = Codec;
+		job.IsCompress = (Control == COMPRESS);
+		job.Source = slot.Input;
+		job.SourceLength = (Control == COMPRESS) ? slot.Header.UncompCount : slot.Header.CompCount;
+		job.Dest = slot.Output;
+		job.DestLength = (Control == COMPRESS) ? OutputSize : slot.Header.UncompCount;
+		job.Result = 0;
+	}
+
+	BlockWorkClass::Process(Jobs, count);
+
+	for (int index = 0; index < count; index++) {
+		BlockJobType & job = Jobs[index];
+
+		if (Control == COMPRESS) {
+			BlockHeaderType header;
+			header.CompCount = (unsigned short)job.Result;
+			header.UncompCount = (unsigned short)job.SourceLength;
+			total += Pipe::Put(&header, sizeof(header));
+			total += Pipe::Put(job.Dest, job.Result);
+		} else {
+			total += Pipe::Put(job.Dest, job.DestLength);
+		}
+	}
+
+	Filled = 0;
+	return(total);
+}
+
+
+/***********************************************************************************************
+ * ParallelPipe::Put -- Send some data through the parallel block processor pipe.              *
+ *                                                                                             *
+ *    This routine will take the data requested and sort it into blocks. Once the blocks in    *
+ *    flight are all full, they are processed together and flushed to the next pipe segment.   *
+ *                                                                                             *
+ * INPUT:   source   -- Pointer to the data to be fed to this processor.                       *
+ *                                                                                             *
+ *          length   -- The number of bytes received.                                          *
+ *                                                                                             *
+ * OUTPUT:  Returns with the actual number of bytes output at the far distant final link in    *
+ *          the pipe chain.                                                                    *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+int ParallelPipe::Put(void const * source, int slen)
+{
+	if (source == NULL || slen < 1) {
+		return(Pipe::Put(source, slen));
+	}
+
+	assert(Slots != NULL);
+
+	int total = 0;
+
+	if (Control == DECOMPRESS) {
+
+		while (slen > 0) {
+			SlotType & slot = Slots[Filled];
+
+			/*
+			**	First accumulate the block header. Only then is it known how much data
+			**	makes up the block.
+			*/
+			if (HeaderCount < (int)sizeof(BlockHeaderType)) {
+				int len = (slen < (int)(sizeof(BlockHeaderType)-HeaderCount)) ? slen : (int)(sizeof(BlockHeaderType)-HeaderCount);
+				memmove(((char *)&slot.Header) + HeaderCount, source, len);
+				source = ((char *)source) + len;
+				slen -= len;
+				HeaderCount += len;
+				if (HeaderCount < (int)sizeof(BlockHeaderType)) break;
+			}
+
+			/*
+			**	Fill the block with compressed data. Data beyond what the buffer can hold
+			**	only comes from a corrupt block, which won't be decompressed anyway.
+			*/
+			int len = (slen < (slot.Header.CompCount-Counter)) ? slen : (slot.Header.CompCount-Counter);
+			if (Counter < InputSize) {
+				memmove(&slot.Input[Counter], source, (len < InputSize-Counter) ? len : InputSize-Counter);
+			}
+			source = ((char *)source) + len;
+			slen -= len;
+			Counter += len;
+
+			if (Counter == slot.Header.CompCount) {
+				Counter = 0;
+				HeaderCount = 0;
+				if (++Filled == SlotCount) {
+					total += Process_Blocks();
+				}
+			}
+		}
+
+	} else {
+
+		while (slen > 0) {
+			SlotType & slot = Slots[Filled];
+
+			int tocopy = (slen < (BlockSize-Counter)) ? slen : (BlockSize-Counter);
+			memmove(&slot.Input[Counter], source, tocopy);
+			source = ((char *)source) + tocopy;
+			slen -= tocopy;
+			Counter += tocopy;
+
+			if (Counter == BlockSize) {
+				slot.Header.UncompCount = (unsigned short)BlockSize;
+				Counter = 0;
+				if (++Filled == SlotCount) {
+					total += Process_Blocks();
+				}
+			}
+		}
+	}
+
+	return(total);
+}
+
+
+/***********************************************************************************************
+ * ParallelPipe::Reserve -- Fetch space in the block being accumulated.                        *
+ *                                                                                             *
+ *    When compressing, the data may be written straight into the block being accumulated      *
+ *    rather than being copied there by Put. The space is never more than what is left of      *
+ *    that block.                                                                              *
+ *                                                                                             *
+ * INPUT:   buffer   -- Reference to the pointer that will be set to the start of the space.   *
+ *                                                                                             *
+ *          slen     -- The number of bytes of space requested.                                *
+ *                                                                                             *
+ * OUTPUT:  Returns with the number of bytes that may be written. This is always zero when     *
+ *          decompressing, since the blocks are not in step with the data put.                 *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+int ParallelPipe::Reserve(void * & buffer, int slen)
+{
+	assert(Slots != NULL);
+
+	buffer = NULL;
+	if (Control != COMPRESS || slen < 1) {
+		return(0);
+	}
+
+	buffer = &Slots[Filled].Input[Counter];
+	return((slen < (BlockSize-Counter)) ? slen : (BlockSize-Counter));
+}
+
+
+/***********************************************************************************************
+ * ParallelPipe::Commit -- Accumulate the data written to the reserved space.                  *
+ *                                                                                             *
+ *    The data is already in the block, so this just advances past it. When that fills the     *
+ *    block, it is handled the same as if it had been filled by Put.                           *
+ *                                                                                             *
+ * INPUT:   slen     -- The number of bytes written to the reserved space.                     *
+ *                                                                                             *
+ * OUTPUT:  Returns with the actual number of bytes output at the far distant final link in    *
+ *          the pipe chain.                                                                    *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+int ParallelPipe::Commit(int slen)
+{
+	assert(Slots != NULL);
+
+	if (Control != COMPRESS || slen < 1) {
+		return(0);
+	}
+
+	int total = 0;
+
+	Counter += (slen < (BlockSize-Counter)) ? slen : (BlockSize-Counter);
+	if (Counter == BlockSize) {
+		Slots[Filled].Header.UncompCount = (unsigned short)BlockSize;
+		Counter = 0;
+		if (++Filled == SlotCount) {
+			total += Process_Blocks();
+		}
+	}
+
+	return(total);
+}
+
+/***********************************************************************************************
+ * ParallelPipe::Flush -- Flushes any partially accumulated block.                             *
+ *                                                                                             *
+ *    All the blocks still in flight are processed and sent on. When compressing, a partial    *
+ *    block is a normal occurrence and is compressed as a short block. When decompressing, a   *
+ *    partial block means the data source was truncated, so it is passed on as it is, the      *
+ *    same as LZOPipe and LCWPipe do.                                                          *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  Returns with the actual number of data bytes output to the distant final link in   *
+ *          the pipe chain.                                                                    *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+int ParallelPipe::Flush(void)
+{
+	assert(Slots != NULL);
+
+	int total = 0;
+
+	if (Control == COMPRESS && Counter > 0) {
+		Slots[Filled].Header.UncompCount = (unsigned short)Counter;
+		Filled++;
+		Counter = 0;
+	}
+
+	/*
+	**	When decompressing, any partial block is in the slot after the whole ones.
+	*/
+	int partial = Filled;
+	if (Filled > 0) {
+		total += Process_Blocks();
+	}
+
+	if (Control == DECOMPRESS) {
+		SlotType & slot = Slots[partial];
+
+		if (HeaderCount > 0 && HeaderCount < (int)sizeof(BlockHeaderType)) {
+			total += Pipe::Put(&slot.Header, HeaderCount);
+		} else if (Counter > 0) {
+			total += Pipe::Put(&slot.Header, sizeof(slot.Header));
+			total += Pipe::Put(slot.Input, (Counter < InputSize) ? Counter : InputSize);
+		}
+		Counter = 0;
+		HeaderCount = 0;
+	}
+
+	total += Pipe::Flush();
+	return(total);
+}
@@ -0,0 +1,118 @@
+/*
+**	Command & Conquer Red Alert(tm)
+**	Copyright 2025 Electronic Arts Inc.
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/***********************************************************************************************
+ *                                                                                             *
+ *                 Project Name : Command & Conquer                                            *
+ *                                                                                             *
+ *                    File Name : PARPIPE.H                                                    *
+ *                                                                                             *
+ *                   Start Date : 10/19/26                                                     *
+ *                                                                                             *
+ *                  Last Update : October 19, 2026                                             *
+ *                                                                                             *
+ *---------------------------------------------------------------------------------------------*
+ * Functions:                                                                                  *
+ * - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+#ifndef PARPIPE_H
+#define PARPIPE_H
+
+#include	"pipe.h"
+#include	"blkwork.h"
+
+
+/*
+**	Performs LZO or LCW compression/decompression on the data stream that is piped through
+**	this class, the same as LZOPipe or LCWPipe do. The blocks are independent of each other,
+**	so a number of them are collected and then processed at the same time by the block
+**	workers. They are passed on down the pipe in their original order, so the output is
+**	exactly the same as the single block pipes produce.
+*/
+class ParallelPipe : public Pipe
+{
+	public:
+		typedef enum CompControl {
+			COMPRESS,
+			DECOMPRESS
+		} CompControl;
+
+		ParallelPipe(BlockCodecType codec, CompControl control, int blocksize=1024*8, int inflight=0);
+		virtual ~ParallelPipe(void);
+
+		virtual int Flush(void);
+		virtual int Put(void const * source, int slen);
+		virtual int Reserve(void * & buffer, int slen);
+		virtual int Commit(int slen);
+
+	private:
+		int Process_Blocks(void);
+
+		/*
+		**	The compressor used and whether it is compressing or decompressing.
+		*/
+		BlockCodecType Codec;
+		CompControl Control;
+
+		/*
+		**	The working block size. Data will be compressed in chunks of this size.
+		*/
+		int BlockSize;
+
+		/*
+		**	Each block has a header of this format.
+		*/
+		struct BlockHeaderType {
+			unsigned short CompCount;		// Size of data block (compressed).
+			unsigned short UncompCount;	// Bytes of uncompressed data it represents.
+		};
+
+		/*
+		**	Each block being accumulated or processed. The input is the raw data when
+		**	compressing, or the compressed data when decompressing.
+		*/
+		struct SlotType {
+			BlockHeaderType Header;
+			char * Input;
+			char * Output;
+		};
+
+		/*
+		**	The blocks in flight, and the work orders for them. Memory use is limited to
+		**	this many blocks, no matter how much data is put through the pipe.
+		*/
+		SlotType * Slots;
+		BlockJobType * Jobs;
+		int SlotCount;
+		int InputSize;
+		int OutputSize;
+
+		/*
+		**	The number of whole blocks accumulated, and the bytes accumulated into the block
+		**	that follows them. When decompressing, HeaderCount tracks the bytes of its header.
+		*/
+		int Filled;
+		int Counter;
+		int HeaderCount;
+
+		ParallelPipe(ParallelPipe & rvalue);
+		ParallelPipe & operator = (ParallelPipe const & pipe);
+};
+
+
+#endif
@@ -0,0 +1,383 @@
+/*
+**	Command & Conquer Red Alert(tm)
+**	Copyright 2025 Electronic Arts Inc.
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/***********************************************************************************************
+ *                                                                                             *
+ *                 Project Name : Command & Conquer                                            *
+ *                                                                                             *
+ *                    File Name : PARSTRAW.CPP                                                 *
+ *                                                                                             *
+ *                   Start Date : 10/19/26                                                     *
+ *                                                                                             *
+ *                  Last Update : October 19, 2026                                             *
+ *                                                                                             *
+ *---------------------------------------------------------------------------------------------*
+ * Functions:                                                                                  *
+ *   ParallelStraw::Consume -- Remove processed data that was looked at through Peek.          *
+ *   ParallelStraw::Fill_Blocks -- Draw a batch of blocks from the source and process them.    *
+ *   ParallelStraw::Get -- Fetch data through the parallel block processor.                    *
+ *   ParallelStraw::ParallelStraw -- Constructor for the parallel block straw.                 *
+ *   ParallelStraw::Peek -- Look at the processed data without copying it.                     *
+ *   ParallelStraw::~ParallelStraw -- Destructor for the parallel block straw.                 *
+ * - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+#include	"parstraw.h"
+#include	<string.h>
+#include	<assert.h>
+
+
+/***********************************************************************************************
+ * ParallelStraw::ParallelStraw -- Constructor for the parallel block straw.                   *
+ *                                                                                             *
+ *    This will allocate the buffers for all the blocks that may be in flight at once.         *
+ *                                                                                             *
+ * INPUT:   codec    -- The compressor to use.                                                 *
+ *                                                                                             *
+ *          control  -- Should compression or decompression be performed?                      *
+ *                                                                                             *
+ *          blocksize-- The size of the data blocks to process.                                *
+ *                                                                                             *
+ *          inflight -- The number of blocks to process at once. Pass 0 to use twice the       *
+ *                      number of threads that work on the blocks.                             *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+ParallelStraw::ParallelStraw(BlockCodecType codec, CompControl control, int blocksize, int inflight) :
+		Codec(codec),
+		Control(control),
+		BlockSize(blocksize),
+		Slots(NULL),
+		Jobs(NULL),
+		SlotCount(inflight),
+		InputSize(0),
+		OutputSize(0),
+		Ready(0),
+		Current(0),
+		Counter(0)
+{
+	if (SlotCount < 1) {
+		SlotCount = BlockWorkClass::Thread_Count() * 2;
+	}
+
+	InputSize = BlockWorkClass::Compress_Bound(BlockSize);
+	OutputSize = BlockWorkClass::Compress_Bound(BlockSize);
+
+	Slots = new SlotType[SlotCount];
+	Jobs = new BlockJobType[SlotCount];
+	for (int index = 0; index < SlotCount; index++) {
+		Slots[index].Input = new char[InputSize];
+		Slots[index].Output = new char[sizeof(BlockHeaderType) + OutputSize];
+		Slots[index].Length = 0;
+	}
+}
+
+
+/***********************************************************************************************
+ * ParallelStraw::~ParallelStraw -- Destructor for the parallel block straw.                   *
+ *                                                                                             *
+ *    This will free the block buffers.                                                        *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+ParallelStraw::~ParallelStraw(void)
+{
+	if (Slots != NULL) {
+		for (int index = 0; index < SlotCount; index++) {
+			delete [] Slots[index].Input;
+			delete [] Slots[index].Output;
+		}
+	}
+	delete [] Slots;
+	Slots = NULL;
+
+	delete [] Jobs;
+	Jobs = NULL;
+}
+
+
+/***********************************************************************************************
+ * ParallelStraw::Fill_Blocks -- Draw a batch of blocks from the source and process them.      *
+ *                                                                                             *
+ *    Blocks are drawn from the source until all the slots are full or the source runs dry.    *
+ *    Then they are all compressed (or decompressed) at the same time. When the source can     *
+ *    offer a view of its data (see Straw::Peek), the blocks are worked on in place there.     *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  Returns with the number of blocks that are ready to be handed out.                 *
+ *                                                                                             *
+ * WARNINGS:   A block that is too big for the buffers is corrupt. It and the rest of the      *
+ *             data are treated as missing.                                                    *
+ *                                                                                             *
+ *             When the source offers a view of its data, it must not also be drawn from with  *
+ *             Get by anyone else.                                                             *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+int ParallelStraw::Fill_Blocks(void)
+{
+	int count = 0;
+
+	/*
+	**	If the source can show its data in place, the blocks are processed right where they
+	**	sit in it rather than being copied into the slots first.
+	*/
+	void const * view = NULL;
+	int viewlen = 0;
+	int consumed = 0;
+	if (ChainTo != NULL) {
+		viewlen = ChainTo->Peek(view, SlotCount * (int)(sizeof(BlockHeaderType) + InputSize));
+	}
+
+	while (count < SlotCount) {
+		SlotType & slot = Slots[count];
+		char const * source = slot.Input;
+		char const * block = ((char const *)view) + consumed;
+		int remaining = viewlen - consumed;
+		int blocklen = 0;
+
+		/*
+		**	See if the whole of the next block is in the view.
+		*/
+		if (remaining > 0) {
+			if (Control == DECOMPRESS) {
+				if (remaining >= (int)sizeof(slot.Header)) {
+					memmove(&slot.Header, block, sizeof(slot.Header));
+					if (slot.Header.CompCount > InputSize || slot.Header.UncompCount > OutputSize) break;
+
+					if (remaining >= (int)sizeof(slot.Header) + slot.Header.CompCount) {
+						blocklen = sizeof(slot.Header) + slot.Header.CompCount;
+						source = block + sizeof(slot.Header);
+					}
+				}
+			} else if (remaining >= BlockSize) {
+				slot.Header.UncompCount = (unsigned short)BlockSize;
+				blocklen = BlockSize;
+				source = block;
+			}
+		}
+
+		if (blocklen > 0) {
+			consumed += blocklen;
+		} else {
+
+			/*
+			**	A block that runs off the end of the view is left for the next batch. If it
+			**	is the first one, the view is dropped and the blocks are copied in from the
+			**	source instead.
+			*/
+			if (viewlen > 0 && count > 0) break;
+			viewlen = 0;
+
+			if (Control == DECOMPRESS) {
+				int incount = Straw::Get(&slot.Header, sizeof(slot.Header));
+				if (incount != sizeof(slot.Header)) break;
+				if (slot.Header.CompCount > InputSize || slot.Header.UncompCount > OutputSize) break;
+
+				incount = Straw::Get(slot.Input, slot.Header.CompCount);
+				if (incount != slot.Header.CompCount) break;
+			} else {
+				slot.Header.UncompCount = (unsigned short)Straw::Get(slot.Input, BlockSize);
+				if (slot.Header.UncompCount == 0) break;
+			}
+		}
+
+		BlockJobType & job = Jobs[count++];
+		job.Codec = Codec;
+		job.IsCompress = (Control == COMPRESS);
+		job.Source = source;
+		if (Control == COMPRESS) {
+			job.SourceLength = slot.Header.UncompCount;
+			job.Dest = slot.Output + sizeof(BlockHeaderType);
+			job.DestLength = OutputSize;
+		} else {
+			job.SourceLength = slot.Header.CompCount;
+			job.Dest = slot.Output;
+			job.DestLength = slot.Header.UncompCount;
+		}
+		job.Result = 0;
+	}
+
+	BlockWorkClass::Process(Jobs, count);
+
+	for (int index = 0; index < count; index++) {
+		SlotType & slot = Slots[index];
+
+		if (Control == COMPRESS) {
+			slot.Header.CompCount = (unsigned short)Jobs[index].Result;
+			memmove(slot.Output, &slot.Header, sizeof(slot.Header));
+			slot.Length = slot.Header.CompCount + sizeof(slot.Header);
+		} else {
+			slot.Length = slot.Header.UncompCount;
+		}
+	}
+
+	/*
+	**	The blocks taken from the view are done with, so they can now be removed from the
+	**	source.
+	*/
+	if (consumed > 0) {
+		ChainTo->Consume(consumed);
+	}
+
+	return(count);
+}
+
+
+/***********************************************************************************************
+ * ParallelStraw::Get -- Fetch data through the parallel block processor.                      *
+ *                                                                                             *
+ *    The processed blocks are handed out in order. When they have all been handed out, the    *
+ *    next batch is drawn from the source.                                                     *
+ *                                                                                             *
+ * INPUT:   destbuf  -- Pointer to the buffer to hold the data.                                *
+ *                                                                                             *
+ *          slen     -- The number of bytes requested.                                         *
+ *                                                                                             *
+ * OUTPUT:  Returns with the number of bytes stored into the buffer.                           *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+int ParallelStraw::Get(void * destbuf, int slen)
+{
+	assert(Slots != NULL);
+
+	int total = 0;
+
+	/*
+	**	Verify parameters for legality.
+	*/
+	if (destbuf == NULL || slen < 1) {
+		return(0);
+	}
+
+	while (slen > 0) {
+
+		/*
+		**	Copy as much data is requested and available into the desired
+		**	destination buffer.
+		*/
+		if (Counter) {
+			SlotType & slot = Slots[Current];
+			int len = (slen < Counter) ? slen : Counter;
+			memmove(destbuf, &slot.Output[slot.Length-Counter], len);
+			destbuf = ((char *)destbuf) + len;
+			slen -= len;
+			Counter -= len;
+			total += len;
+		}
+		if (slen == 0) break;
+
+		/*
+		**	Move on to the next block, drawing another batch when these are used up.
+		*/
+		if (++Current >= Ready) {
+			Ready = Fill_Blocks();
+			Current = 0;
+			if (Ready == 0) break;
+		}
+		Counter = Slots[Current].Length;
+	}
+
+	return(total);
+}
+
+
+/***********************************************************************************************
+ * ParallelStraw::Peek -- Look at the processed data without copying it.                       *
+ *                                                                                             *
+ *    The view is of the block being handed out, so it is never longer than what is left of    *
+ *    that block. When it is used up, the next block is moved on to as with Get.               *
+ *                                                                                             *
+ * INPUT:   buffer   -- Reference to the pointer that will be set to the start of the data.    *
+ *                                                                                             *
+ *          slen     -- The number of bytes requested.                                         *
+ *                                                                                             *
+ * OUTPUT:  Returns with the number of bytes that may be looked at. Zero means that there is   *
+ *          no more data.                                                                      *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+int ParallelStraw::Peek(void const * & buffer, int slen)
+{
+	assert(Slots != NULL);
+
+	buffer = NULL;
+	if (slen < 1) {
+		return(0);
+	}
+
+	while (Counter == 0) {
+		if (++Current >= Ready) {
+			Ready = Fill_Blocks();
+			Current = 0;
+			if (Ready == 0) return(0);
+		}
+		Counter = Slots[Current].Length;
+	}
+
+	SlotType & slot = Slots[Current];
+	buffer = &slot.Output[slot.Length-Counter];
+	return((slen < Counter) ? slen : Counter);
+}
+
+
+/***********************************************************************************************
+ * ParallelStraw::Consume -- Remove processed data that was looked at through Peek.            *
+ *                                                                                             *
+ *    This advances through the block being handed out, just as if the data had been           *
+ *    fetched with Get.                                                                        *
+ *                                                                                             *
+ * INPUT:   slen     -- The number of bytes to remove.                                         *
+ *                                                                                             *
+ * OUTPUT:  Returns with the number of bytes removed.                                          *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+int ParallelStraw::Consume(int slen)
+{
+	if (slen < 1) {
+		return(0);
+	}
+
+	int len = (slen < Counter) ? slen : Counter;
+	Counter -= len;
+	return(len);
+}
@@ -0,0 +1,117 @@
+/*
+**	Command & Conquer Red Alert(tm)
+**	Copyright 2025 Electronic Arts Inc.
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/***********************************************************************************************
+ *                                                                                             *
+ *                 Project Name : Command & Conquer                                            *
+ *                                                                                             *
+ *                    File Name : PARSTRAW.H                                                   *
+ *                                                                                             *
+ *                   Start Date : 10/19/26                                                     *
+ *                                                                                             *
+ *                  Last Update : October 19, 2026                                             *
+ *                                                                                             *
+ *---------------------------------------------------------------------------------------------*
+ * Functions:                                                                                  *
+ * - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+#ifndef PARSTRAW_H
+#define PARSTRAW_H
+
+#include	"straw.h"
+#include	"blkwork.h"
+
+
+/*
+**	Performs LZO or LCW compression/decompression on the data stream that is drawn through
+**	this class, the same as LZOStraw or LCWStraw do. A number of blocks are drawn from the
+**	source and processed at the same time by the block workers. They are handed out in
+**	their original order, so the output is exactly the same as the single block straws give.
+*/
+class ParallelStraw : public Straw
+{
+	public:
+		typedef enum CompControl {
+			COMPRESS,
+			DECOMPRESS
+		} CompControl;
+
+		ParallelStraw(BlockCodecType codec, CompControl control, int blocksize=1024*8, int inflight=0);
+		virtual ~ParallelStraw(void);
+
+		virtual int Get(void * source, int slen);
+		virtual int Peek(void const * & buffer, int slen);
+		virtual int Consume(int slen);
+
+	private:
+		int Fill_Blocks(void);
+
+		/*
+		**	The compressor used and whether it is compressing or decompressing.
+		*/
+		BlockCodecType Codec;
+		CompControl Control;
+
+		/*
+		**	The working block size. Data will be compressed in chunks of this size.
+		*/
+		int BlockSize;
+
+		/*
+		**	Each block has a header of this format.
+		*/
+		struct BlockHeaderType {
+			unsigned short CompCount;		// Size of data block (compressed).
+			unsigned short UncompCount;	// Bytes of uncompressed data it represents.
+		};
+
+		/*
+		**	Each block being processed. When compressing, the output starts with the block
+		**	header so that the whole block can be handed out from one place.
+		*/
+		struct SlotType {
+			BlockHeaderType Header;
+			char * Input;
+			char * Output;
+			int Length;
+		};
+
+		/*
+		**	The blocks in flight, and the work orders for them. Memory use is limited to
+		**	this many blocks, no matter how much data is drawn through the straw.
+		*/
+		SlotType * Slots;
+		BlockJobType * Jobs;
+		int SlotCount;
+		int InputSize;
+		int OutputSize;
+
+		/*
+		**	The number of blocks processed and ready, the one being handed out, and the
+		**	bytes of it that are left.
+		*/
+		int Ready;
+		int Current;
+		int Counter;
+
+		ParallelStraw(ParallelStraw & rvalue);
+		ParallelStraw & operator = (ParallelStraw const & pipe);
+};
+
+
+#endif
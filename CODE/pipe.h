@@ -61,6 +61,16 @@ class Pipe
 		void Put_To(Pipe & pipe) {Put_To(&pipe);}
 		virtual int Put(void const * source, int slen);
 
+		/*
+		**	A pipe segment that gathers the data in a buffer of its own can let it be written
+		**	there directly. Reserve returns how many bytes of space (up to the number asked
+		**	for) may be written to, and Commit then sends that many of them on as if they
+		**	had been Put. A segment that has no space to offer returns zero from Reserve, in
+		**	which case Put must be used.
+		*/
+		virtual int Reserve(void * & buffer, int slen) {buffer = NULL; return(0);}
+		virtual int Commit(int) {return(0);}
+
 		/*
 		**	Pointer to the next pipe segment in the chain.
 		*/
@@ -0,0 +1,122 @@
+/*
+**	Command & Conquer Red Alert(tm)
+**	Copyright 2025 Electronic Arts Inc.
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/***************************************************************************
+ *                                                                         *
+ *                 Project Name : Command & Conquer                        *
+ *                                                                         *
+ *                    File Name : PKTRING.H                                *
+ *                                                                         *
+ *                   Start Date : October 19, 2026                         *
+ *                                                                         *
+ *                  Last Update : October 19, 2026                         *
+ *                                                                         *
+ *-------------------------------------------------------------------------*
+ *                                                                         *
+ * This is a fixed-size ring of received packets, passed from a network		*
+ * I/O thread (the only producer) to the main thread (the only consumer).	*
+ * Neither side takes a lock; each only writes its own index, and the		*
+ * acquire/release ordering on the indices publishes the slot contents.	*
+ *                                                                         *
+ * The producer fills slots in place with Producer_Slot() & publishes		*
+ * them with Commit(); the consumer reads Consumer_Slot() & frees it with	*
+ * Release().  Each packet carries the time it arrived, so queue latency	*
+ * in the main loop doesn't show up in measured response times.				*
+ *                                                                         *
+ * - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+#ifndef PKTRING_H
+#define PKTRING_H
+
+#include	<atomic>
+
+/*
+********************************** Defines **********************************
+*/
+/*---------------------------------------------------------------------------
+This is one ring entry
+---------------------------------------------------------------------------*/
+typedef struct {
+	unsigned long Time;					// ConnectionClass::Time() on arrival
+	int BufferLen;							// size of packet; 0 = discard
+	unsigned char Address[64];			// address the packet came from
+	unsigned char Buffer[1024];		// the data packet
+} RingPacketType;
+
+/*
+***************************** Class Declaration *****************************
+*/
+class PacketRingClass
+{
+	public:
+		enum PacketRingEnum {
+			RING_SIZE = 256					// must be a power of 2
+		};
+
+		PacketRingClass(void) : Head(0), Tail(0) {}
+
+		/*
+		........................... Producer routines ..........................
+		*/
+		int Free(void) const {
+			return (RING_SIZE - (int)(Head.load(std::memory_order_relaxed) -
+				Tail.load(std::memory_order_acquire)));
+		}
+		RingPacketType & Producer_Slot(int index) {
+			return (Slots[(Head.load(std::memory_order_relaxed) + index) & (RING_SIZE - 1)]);
+		}
+		void Commit(int count) {
+			Head.store(Head.load(std::memory_order_relaxed) + count, std::memory_order_release);
+		}
+
+		/*
+		........................... Consumer routines ..........................
+		*/
+		int Count(void) const {
+			return ((int)(Head.load(std::memory_order_acquire) -
+				Tail.load(std::memory_order_relaxed)));
+		}
+		RingPacketType & Consumer_Slot(void) {
+			return (Slots[Tail.load(std::memory_order_relaxed) & (RING_SIZE - 1)]);
+		}
+		void Release(void) {
+			Tail.store(Tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+		}
+
+		/*
+		.......... Empties the ring; only when the producer is stopped ..........
+		*/
+		void Clear(void) {Tail.store(Head.load());}
+
+	private:
+		/*
+		..... Free-running indices; Head is written by the producer only, ......
+		.................... Tail by the consumer only. .......................
+		*/
+		std::atomic<unsigned> Head;
+		std::atomic<unsigned> Tail;
+
+		RingPacketType Slots[RING_SIZE];
+
+		PacketRingClass(PacketRingClass const & rvalue);
+		PacketRingClass & operator = (PacketRingClass const & rvalue);
+};
+
+#endif
+
+/**************************** end of pktring.h *****************************/
@@ -0,0 +1,469 @@
+/*
+**	Command & Conquer Red Alert(tm)
+**	Copyright 2025 Electronic Arts Inc.
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/***********************************************************************************************
+ *                                                                                             *
+ *                 Project Name : Command & Conquer                                            *
+ *                                                                                             *
+ *                    File Name : PROFILER.CPP                                                 *
+ *                                                                                             *
+ *                   Start Date : 10/19/26                                                     *
+ *                                                                                             *
+ *                  Last Update : October 19, 2026                                             *
+ *                                                                                             *
+ *---------------------------------------------------------------------------------------------*
+ * Functions:                                                                                  *
+ *   ProfilerClass::Begin -- Marks the start of a benchmarked scope.                           *
+ *   ProfilerClass::Dump -- Writes the recording out as a Chrome trace file.                   *
+ *   ProfilerClass::End -- Marks the end of a benchmarked scope and records it.                *
+ *   ProfilerClass::Frame -- Marks the end of a game frame.                                    *
+ *   ProfilerClass::Name -- Fetches the name of a benchmark scope.                             *
+ *   ProfilerClass::Now -- Fetches the current time in nanoseconds.                            *
+ *   ProfilerClass::ProfilerClass -- Constructor for the profiler.                             *
+ *   ProfilerClass::Start -- Begins a new recording.                                           *
+ *   ProfilerClass::Stop -- Stops recording.                                                   *
+ *   ProfilerClass::Thread_Number -- Fetches the profiler number of the calling thread.        *
+ *   ProfilerClass::~ProfilerClass -- Destructor for the profiler.                             *
+ * - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+#include	"function.h"
+#include	<chrono>
+
+
+/*
+**	Deepest nesting of scopes that is recorded. Scopes nested deeper than this are not
+**	recorded, but their enclosing scopes still are.
+*/
+#define	PROFILE_DEPTH_MAX		32
+
+/*
+**	The scopes that each thread has begun and not yet ended.
+*/
+struct ScopeStackType {
+	unsigned Session;
+	int Depth;
+	long long Start[PROFILE_DEPTH_MAX];
+	unsigned char Bench[PROFILE_DEPTH_MAX];
+};
+static thread_local ScopeStackType ScopeStack;
+
+
+/***********************************************************************************************
+ * ProfilerClass::ProfilerClass -- Constructor for the profiler.                               *
+ *                                                                                             *
+ *    The profiler starts out idle. No memory is allocated until recording is started.         *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+ProfilerClass::ProfilerClass(void) :
+	IsActive(false),
+	Events(NULL),
+	EventNext(0),
+	Frames(NULL),
+	FrameNext(0),
+	Origin(0),
+	Session(0),
+	LastPathCount(0),
+	LastCellCount(0),
+	LastTargetScan(0),
+	LastSidebarRedraws(0)
+{
+	for (int bench = BENCH_FIRST; bench < BENCH_COUNT; bench++) {
+		TotalTime[bench] = 0;
+		TotalCalls[bench] = 0;
+	}
+}
+
+
+/***********************************************************************************************
+ * ProfilerClass::~ProfilerClass -- Destructor for the profiler.                               *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+ProfilerClass::~ProfilerClass(void)
+{
+	IsActive = false;
+	delete [] Events;
+	Events = NULL;
+	delete [] Frames;
+	Frames = NULL;
+}
+
+
+/***********************************************************************************************
+ * ProfilerClass::Start -- Begins a new recording.                                             *
+ *                                                                                             *
+ *    Anything recorded before is discarded and the profiler starts recording every scope      *
+ *    and frame from this point on.                                                            *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+void ProfilerClass::Start(void)
+{
+	if (Events == NULL) {
+		Events = new EventType [EVENT_MAX];
+	}
+	if (Frames == NULL) {
+		Frames = new FrameType [FRAME_MAX];
+	}
+	if (Events == NULL || Frames == NULL) return;
+
+	EventNext = 0;
+	FrameNext = 0;
+	Origin = Now();
+	Session++;
+
+	LastPathCount = PathCount;
+	LastCellCount = CellCount;
+	LastTargetScan = TargetScan;
+	LastSidebarRedraws = SidebarRedraws;
+
+	for (int bench = BENCH_FIRST; bench < BENCH_COUNT; bench++) {
+		TotalTime[bench] = 0;
+		TotalCalls[bench] = 0;
+	}
+
+	IsActive = true;
+}
+
+
+/***********************************************************************************************
+ * ProfilerClass::Stop -- Stops recording.                                                     *
+ *                                                                                             *
+ *    The recording is kept so that it can still be dumped.                                    *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+void ProfilerClass::Stop(void)
+{
+	IsActive = false;
+}
+
+
+/***********************************************************************************************
+ * ProfilerClass::Begin -- Marks the start of a benchmarked scope.                             *
+ *                                                                                             *
+ *    This is called by the BStart macro. The start time is pushed on the calling thread's     *
+ *    scope stack, so scopes may be nested inside one another.                                 *
+ *                                                                                             *
+ * INPUT:   bench -- The benchmark scope that is starting.                                     *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+void ProfilerClass::Begin(BenchType bench)
+{
+	ScopeStackType & stack = ScopeStack;
+	if (stack.Session != Session) {
+		stack.Session = Session;
+		stack.Depth = 0;
+	}
+
+	if (stack.Depth < PROFILE_DEPTH_MAX) {
+		stack.Bench[stack.Depth] = (unsigned char)bench;
+		stack.Start[stack.Depth] = Now() - Origin;
+	}
+	stack.Depth++;
+}
+
+
+/***********************************************************************************************
+ * ProfilerClass::End -- Marks the end of a benchmarked scope and records it.                  *
+ *                                                                                             *
+ *    This is called by the BEnd macro. The matching scope is popped off the calling thread's  *
+ *    scope stack and stored in the event ring buffer. Any scopes begun inside it that were    *
+ *    never ended are discarded. An end with no matching start, such as for a scope that was   *
+ *    already open when recording started, is ignored.                                         *
+ *                                                                                             *
+ * INPUT:   bench -- The benchmark scope that has finished.                                    *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+void ProfilerClass::End(BenchType bench)
+{
+	ScopeStackType & stack = ScopeStack;
+	if (stack.Session != Session || stack.Depth == 0) return;
+
+	/*
+	**	Scopes too deep to be tracked are only counted.
+	*/
+	if (stack.Depth > PROFILE_DEPTH_MAX) {
+		stack.Depth--;
+		return;
+	}
+
+	int depth = stack.Depth - 1;
+	while (depth >= 0 && stack.Bench[depth] != bench) {
+		depth--;
+	}
+	if (depth < 0) return;
+	stack.Depth = depth;
+
+	unsigned sequence = EventNext.fetch_add(1, std::memory_order_relaxed);
+	EventType & event = Events[sequence & (EVENT_MAX-1)];
+	event.Start = stack.Start[depth];
+	event.Duration = (Now() - Origin) - stack.Start[depth];
+	event.Bench = (unsigned char)bench;
+	event.Depth = (unsigned char)depth;
+	event.Thread = (unsigned short)Thread_Number();
+
+	TotalTime[bench].fetch_add(event.Duration, std::memory_order_relaxed);
+	TotalCalls[bench].fetch_add(1, std::memory_order_relaxed);
+}
+
+
+/***********************************************************************************************
+ * ProfilerClass::Frame -- Marks the end of a game frame.                                      *
+ *                                                                                             *
+ *    This records the end of the frame in the frame ring buffer, along with how much the      *
+ *    path finding, target scan, cell draw and sidebar redraw counters went up during it.      *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   Only call this from the main thread while recording.                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+void ProfilerClass::Frame(void)
+{
+	if (!IsActive) return;
+
+	FrameType & frame = Frames[FrameNext % FRAME_MAX];
+	frame.Time = Now() - Origin;
+	frame.FirstEvent = EventNext;
+
+	/*
+	**	The debug display clears these counters whenever it shows them. When a counter has
+	**	gone down, it must have been cleared during this frame.
+	*/
+	frame.PathCount = (PathCount >= LastPathCount) ? PathCount - LastPathCount : PathCount;
+	frame.CellCount = (CellCount >= LastCellCount) ? CellCount - LastCellCount : CellCount;
+	frame.TargetScan = (TargetScan >= LastTargetScan) ? TargetScan - LastTargetScan : TargetScan;
+	frame.SidebarRedraws = (SidebarRedraws >= LastSidebarRedraws) ? SidebarRedraws - LastSidebarRedraws : SidebarRedraws;
+	LastPathCount = PathCount;
+	LastCellCount = CellCount;
+	LastTargetScan = TargetScan;
+	LastSidebarRedraws = SidebarRedraws;
+
+	FrameNext++;
+}
+
+
+/***********************************************************************************************
+ * ProfilerClass::Dump -- Writes the recording out as a Chrome trace file.                     *
+ *                                                                                             *
+ *    The scopes and per frame counters still held in the ring buffers are written in the      *
+ *    JSON trace event format that chrome://tracing and the Perfetto UI load. Recording may    *
+ *    carry on while this is done.                                                             *
+ *                                                                                             *
+ * INPUT:   filename -- The name of the file to write the trace to.                            *
+ *                                                                                             *
+ * OUTPUT:  bool; Was the trace written?                                                       *
+ *                                                                                             *
+ * WARNINGS:   Events recorded by other threads while the dump is in progress may be missed.   *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+bool ProfilerClass::Dump(char const * filename)
+{
+	if (Events == NULL || Frames == NULL || filename == NULL) return(false);
+
+	/*
+	**	Work out which of the frames and events are still held. Events from before the
+	**	oldest frame held are left out, so that every event written has its frame counters.
+	*/
+	unsigned framelast = FrameNext;
+	unsigned framefirst = (framelast > FRAME_MAX) ? framelast - FRAME_MAX : 0;
+	unsigned eventlast = EventNext;
+	unsigned eventfirst = (eventlast > EVENT_MAX) ? eventlast - EVENT_MAX : 0;
+	if (framefirst > 0 && Frames[framefirst % FRAME_MAX].FirstEvent > eventfirst) {
+		eventfirst = Frames[framefirst % FRAME_MAX].FirstEvent;
+		framefirst++;
+	}
+
+	RawFileClass file(filename);
+	FilePipe pipe(file);
+	char buffer[256];
+	int total = 0;
+	bool first = true;
+
+	total += pipe.Put("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n", strlen("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n"));
+
+	for (unsigned index = eventfirst; index < eventlast; index++) {
+		EventType const & event = Events[index & (EVENT_MAX-1)];
+		sprintf(buffer, "%s{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%lld.%03d,\"dur\":%lld.%03d,\"args\":{\"depth\":%d}}",
+			first ? "" : ",\n",
+			Name((BenchType)event.Bench),
+			event.Thread,
+			event.Start / 1000, (int)(event.Start % 1000),
+			event.Duration / 1000, (int)(event.Duration % 1000),
+			event.Depth);
+		total += pipe.Put(buffer, strlen(buffer));
+		first = false;
+	}
+
+	for (unsigned index = framefirst; index < framelast; index++) {
+		FrameType const & frame = Frames[index % FRAME_MAX];
+		sprintf(buffer, "%s{\"name\":\"Counters\",\"ph\":\"C\",\"pid\":1,\"ts\":%lld.%03d,\"args\":{\"PathCount\":%ld,\"CellCount\":%ld,\"TargetScan\":%ld,\"SidebarRedraws\":%ld}}",
+			first ? "" : ",\n",
+			frame.Time / 1000, (int)(frame.Time % 1000),
+			frame.PathCount, frame.CellCount, frame.TargetScan, frame.SidebarRedraws);
+		total += pipe.Put(buffer, strlen(buffer));
+		first = false;
+	}
+
+	total += pipe.Put("\n]}\n", strlen("\n]}\n"));
+	total += pipe.End();
+	file.Close();
+
+	return(total > 0);
+}
+
+
+/***********************************************************************************************
+ * ProfilerClass::Name -- Fetches the name of a benchmark scope.                               *
+ *                                                                                             *
+ * INPUT:   bench -- The benchmark scope to fetch the name of.                                 *
+ *                                                                                             *
+ * OUTPUT:  Returns with the name that the scope is shown under in the trace.                  *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+char const * ProfilerClass::Name(BenchType bench)
+{
+	static char const * const _names[BENCH_COUNT] = {
+		"GameFrame",
+		"FindPath",
+		"GreatestThreat",
+		"AI",
+		"Cell",
+		"Sidebar",
+		"Radar",
+		"Tactical",
+		"PerCellProcess",
+		"EvalObject",
+		"EvalCell",
+		"EvalWall",
+		"Power",
+		"Tabs",
+		"Shroud",
+		"Anims",
+		"Objects",
+		"Palette",
+		"GScreenRender",
+		"BlitDisplay",
+		"Mission",
+		"Rules",
+		"Scenario"
+	};
+
+	if ((unsigned)bench < BENCH_COUNT) {
+		return(_names[bench]);
+	}
+	return("Unknown");
+}
+
+
+/***********************************************************************************************
+ * ProfilerClass::Now -- Fetches the current time in nanoseconds.                              *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  Returns with the time from a steady clock that is not affected by the system       *
+ *          clock being changed.                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+long long ProfilerClass::Now(void)
+{
+	return(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+
+/***********************************************************************************************
+ * ProfilerClass::Thread_Number -- Fetches the profiler number of the calling thread.          *
+ *                                                                                             *
+ *    Each thread that records a scope is given a small number, in the order that they first   *
+ *    record one. This is the thread ID shown in the trace.                                    *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  Returns with the number of the calling thread.                                     *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+int ProfilerClass::Thread_Number(void)
+{
+	static std::atomic<int> _next(1);
+	static thread_local int _number = 0;
+
+	if (_number == 0) {
+		_number = _next.fetch_add(1);
+	}
+	return(_number);
+}
@@ -0,0 +1,137 @@
+/*
+**	Command & Conquer Red Alert(tm)
+**	Copyright 2025 Electronic Arts Inc.
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/***********************************************************************************************
+ *                                                                                             *
+ *                 Project Name : Command & Conquer                                            *
+ *                                                                                             *
+ *                    File Name : PROFILER.H                                                   *
+ *                                                                                             *
+ *                   Start Date : 10/19/26                                                     *
+ *                                                                                             *
+ *                  Last Update : October 19, 2026                                             *
+ *                                                                                             *
+ *---------------------------------------------------------------------------------------------*
+ * Functions:                                                                                  *
+ * - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include	<atomic>
+
+
+/*
+**	This records every BStart/BEnd scope as a timed event, along with the thread it ran on and
+**	how deeply it was nested. The events are kept in a ring buffer that holds the last several
+**	hundred game frames, together with the performance counters for each of those frames. The
+**	recording can be written out as a Chrome/Perfetto trace file at any time. When recording
+**	is off, the only cost to a benchmarked scope is the test of IsActive.
+*/
+class ProfilerClass
+{
+	public:
+		ProfilerClass(void);
+		~ProfilerClass(void);
+
+		void Start(void);
+		void Stop(void);
+		bool Dump(char const * filename);
+
+		void Begin(BenchType bench);
+		void End(BenchType bench);
+		void Frame(void);
+
+		static char const * Name(BenchType bench);
+
+		long long Total_Time(BenchType bench) const {return(TotalTime[bench]);}
+		unsigned long Total_Calls(BenchType bench) const {return(TotalCalls[bench]);}
+
+		/*
+		**	Is the profiler currently recording? This is tested by the BStart and BEnd
+		**	macros before any other work is done. Scopes can run on other threads, so it
+		**	is atomic; Start sets it only once the buffers are ready for them.
+		*/
+		std::atomic<bool> IsActive;
+
+	private:
+		enum ProfilerEnums {
+			EVENT_MAX=1<<17,			// Events held; must be a power of two.
+			FRAME_MAX=512				// Frames held.
+		};
+
+		/*
+		**	One finished scope.
+		*/
+		struct EventType {
+			long long Start;			// Nanoseconds since recording began.
+			long long Duration;		// Nanoseconds the scope took.
+			unsigned char Bench;		// BenchType of the scope.
+			unsigned char Depth;		// Number of scopes it was nested in.
+			unsigned short Thread;	// Profiler thread number.
+		};
+
+		/*
+		**	The state of the game at the end of one frame.
+		*/
+		struct FrameType {
+			long long Time;			// Nanoseconds since recording began.
+			unsigned FirstEvent;		// Sequence number of the first event recorded after it.
+			long PathCount;			// Counters accumulated during the frame.
+			long CellCount;
+			long TargetScan;
+			long SidebarRedraws;
+		};
+
+		static long long Now(void);
+		static int Thread_Number(void);
+
+		EventType * Events;
+		std::atomic<unsigned> EventNext;
+
+		FrameType * Frames;
+		unsigned FrameNext;
+
+		/*
+		**	Clock value that recording started at, and a count of how many times it has been
+		**	started, so that scopes left open from a previous recording can be discarded.
+		*/
+		long long Origin;
+		unsigned Session;
+
+		/*
+		**	Counter values at the end of the previous frame.
+		*/
+		long LastPathCount;
+		long LastCellCount;
+		long LastTargetScan;
+		long LastSidebarRedraws;
+
+		/*
+		**	Nanoseconds spent in each kind of scope, and how many of them ended, since the
+		**	recording started. Unlike the ring buffers, these cover the whole recording.
+		*/
+		std::atomic<long long> TotalTime[BENCH_COUNT];
+		std::atomic<unsigned long> TotalCalls[BENCH_COUNT];
+
+		ProfilerClass(ProfilerClass const & rvalue);
+		ProfilerClass & operator = (ProfilerClass const & rvalue);
+};
+
+
+#endif
@@ -44,6 +44,8 @@
  * Main Multiplayer Queue Logic:															*
  *   Wait_For_Players -- Waits for other systems to come on-line           *
  *   Generate_Timing_Event -- computes & queues a RESPONSE_TIME event      *
+ *   Measure_Response_Time -- gets the response time to plan MaxAhead for  *
+ *   Smooth_Max_Ahead -- limits how fast MaxAhead may decrease             *
  *   Process_Send_Period -- timing for sending packets every 'n' frames    *
  *   Send_Packets -- sends out events from the OutList                     *
  *   Send_FrameSync -- Sends a FRAMESYNC packet                            *
@@ -58,9 +60,12 @@
  *   Build_Send_Packet -- Builds a big packet from a bunch of little ones.	*
  *   Add_Uncompressed_Events -- adds uncompressed events to a packet       *
  *   Add_Compressed_Events -- adds compressed events to a packet        	*
+ *   Add_Varint_Events -- adds varint/delta encoded events to a packet     *
  *   Breakup_Receive_Packet -- Splits a big packet into little ones.			*
  *   Extract_Uncompressed_Events -- extracts events from a packet				*
  *   Extract_Compressed_Events -- extracts events from a packet            *
+ *   Extract_Varint_Events -- extracts varint/delta encoded events         *
+ *   Measure_Packets -- sizes played back events in each packet format     *
  *                                                                         *
  * DoList Management:																		*
  *   Execute_DoList -- Executes commands from the DoList                   *
@@ -155,6 +160,8 @@ static RetcodeType Wait_For_Players(int first_time, ConnManClass *net,
 	int my_sent, long *their_frame,  unsigned short *their_sent,
 	unsigned short *their_recv);
 static void Generate_Timing_Event(ConnManClass *net, int my_sent);
+static unsigned long Measure_Response_Time(ConnManClass *net);
+static unsigned long Smooth_Max_Ahead(unsigned long maxahead);
 static void Generate_Real_Timing_Event(ConnManClass *net, int my_sent);
 static void Generate_Process_Time_Event(ConnManClass *net);
 static int Process_Send_Period(ConnManClass *net);	//, int init);
@@ -183,9 +190,13 @@ int Add_Uncompressed_Events(void *buf, int bufsize, int frame_delay, int size,
 	int cap);
 int Add_Compressed_Events(void *buf, int bufsize, int frame_delay, int size,
 	int cap);
+int Add_Varint_Events(void *buf, int bufsize, int frame_delay, int size,
+	int cap);
 static int Breakup_Receive_Packet(void *buf, int bufsize );
 int Extract_Uncompressed_Events(void *buf, int bufsize);
 int Extract_Compressed_Events(void *buf, int bufsize);
+int Extract_Varint_Events(void *buf, int bufsize);
+static void Measure_Packets(int first, int count);
 
 //...........................................................................
 // DoList management:
@@ -725,7 +736,7 @@ static void Queue_AI_Multiplayer(void)
 		//.....................................................................
 		// Initialize the frame timers
 		//.....................................................................
-		if (Session.CommProtocol == COMM_PROTOCOL_MULTI_E_COMP) {
+		if (Session.CommProtocol >= COMM_PROTOCOL_MULTI_E_COMP) {
 			Process_Send_Period(net);//, 1);
 		}
 
@@ -749,7 +760,7 @@ static void Queue_AI_Multiplayer(void)
 		// If we're the net "master", compute our desired frame rate & new
 		// 'MaxAhead' value.
 		//
-		if (Session.CommProtocol == COMM_PROTOCOL_MULTI_E_COMP) {
+		if (Session.CommProtocol >= COMM_PROTOCOL_MULTI_E_COMP) {
 
 			//
 			// All systems will transmit their required process time.
@@ -773,7 +784,7 @@ static void Queue_AI_Multiplayer(void)
 	//------------------------------------------------------------------------
 	// Only process every 'FrameSendRate' frames
 	//------------------------------------------------------------------------
-	if (Session.CommProtocol == COMM_PROTOCOL_MULTI_E_COMP) {
+	if (Session.CommProtocol >= COMM_PROTOCOL_MULTI_E_COMP) {
 		if (!Process_Send_Period(net)) {	//, 0)) {
 			if (IsMono) {
 				MonoClass::Disable();
@@ -1063,7 +1074,7 @@ static RetcodeType Wait_For_Players(int first_time, ConnManClass *net,
 //	Scen.RandomNumber.Count1,
 //	Scen.RandomNumber.Count2,
 //	Scen.RandomNumber.Seed);
-						Save_Game(-1, (char *)Text_String(TXT_MULTIPLAYER_GAME));
+						Save_Emergency_Game(Text_String(TXT_MULTIPLAYER_GAME));
 //printf("After Save: Count1:%d, Count2:%d, Seed:%d\n",
 //	Scen.RandomNumber.Count1,
 //	Scen.RandomNumber.Count2,
@@ -1149,7 +1160,7 @@ static RetcodeType Wait_For_Players(int first_time, ConnManClass *net,
 	//	Scen.RandomNumber.Count1,
 	//	Scen.RandomNumber.Count2,
 	//	Scen.RandomNumber.Seed);
-							Save_Game (-1, (char *)Text_String(TXT_MULTIPLAYER_GAME));
+							Save_Emergency_Game(Text_String(TXT_MULTIPLAYER_GAME));
 	//printf("After Save: Count1:%d, Count2:%d, Seed:%d\n",
 	//	Scen.RandomNumber.Count1,
 	//	Scen.RandomNumber.Count2,
@@ -1268,6 +1279,83 @@ static RetcodeType Wait_For_Players(int first_time, ConnManClass *net,
 }	// end of Wait_For_Players
 
 
+/***************************************************************************
+ * Measure_Response_Time -- gets the response time to plan MaxAhead for    *
+ *                                                                         *
+ * Averages hide the occasional slow packet, & each one that's late		*
+ * stalls the game; so MaxAhead is planned from a high percentile of the	*
+ * recent response times, plus the current jitter to cover a link that's	*
+ * getting worse.  The measurements are kept in Session so they can be		*
+ * reported.																					*
+ *                                                                         *
+ * INPUT:                                                                  *
+ *		net			ptr to connection manager											*
+ *                                                                         *
+ * OUTPUT:                                                                 *
+ *		round-trip response time, in ticks												*
+ *                                                                         *
+ * WARNINGS:                                                               *
+ *		none.																						*
+ *                                                                         *
+ * HISTORY:                                                                *
+ *   10/19/2026 AGT : Created.                                             *
+ *=========================================================================*/
+static unsigned long Measure_Response_Time(ConnManClass *net)
+{
+	Session.LatencyAverage = net->Response_Time();
+
+	if (Options.LatencyPercentile == 0) {
+		Session.LatencyPercentile = Session.LatencyAverage;
+		Session.LatencyJitter = 0;
+		return (Session.LatencyAverage);
+	}
+
+	Session.LatencyPercentile = net->Percentile_Response_Time(Options.LatencyPercentile);
+	Session.LatencyJitter = net->Response_Jitter();
+
+	//------------------------------------------------------------------------
+	// No samples yet; fall back on the average.
+	//------------------------------------------------------------------------
+	if (Session.LatencyPercentile == 0) {
+		return (Session.LatencyAverage);
+	}
+
+	return (Session.LatencyPercentile + Session.LatencyJitter);
+
+}	// end of Measure_Response_Time
+
+
+/***************************************************************************
+ * Smooth_Max_Ahead -- limits how fast MaxAhead may decrease               *
+ *                                                                         *
+ * A larger MaxAhead is used at once, to avoid stalls; a smaller one is		*
+ * approached one FrameSendRate step at a time, so one good measurement		*
+ * doesn't leave no margin for the next bad one.									*
+ *                                                                         *
+ * INPUT:                                                                  *
+ *		maxahead		MaxAhead value just computed										*
+ *                                                                         *
+ * OUTPUT:                                                                 *
+ *		MaxAhead value to use																*
+ *                                                                         *
+ * WARNINGS:                                                               *
+ *		none.																						*
+ *                                                                         *
+ * HISTORY:                                                                *
+ *   10/19/2026 AGT : Created.                                             *
+ *=========================================================================*/
+static unsigned long Smooth_Max_Ahead(unsigned long maxahead)
+{
+	if (Options.LatencyPercentile == 0 ||
+		maxahead + Session.FrameSendRate >= Session.MaxAhead) {
+		return (maxahead);
+	}
+
+	return (Session.MaxAhead - Session.FrameSendRate);
+
+}	// end of Smooth_Max_Ahead
+
+
 /***************************************************************************
  * Generate_Timing_Event -- computes & queues a RESPONSE_TIME event        *
  *                                                                         *
@@ -1309,7 +1397,7 @@ static void Generate_Timing_Event(ConnManClass *net, int my_sent)
 	// To convert to one-way packet time, divide by 2; to convert to game
 	// frames, divide again by 4, assuming a game rate of 15 fps.
 	//------------------------------------------------------------------------
-	resp_time = net->Response_Time();
+	resp_time = Measure_Response_Time(net);
 
 	//------------------------------------------------------------------------
 	//	Adjust my connection retry timing; only do this if I've sent out more
@@ -1329,10 +1417,10 @@ static void Generate_Timing_Event(ConnManClass *net, int my_sent)
 			// For multi-frame compressed events, the MaxAhead must be an even
 			// multiple of the FrameSendRate.
 			//..................................................................
-			if (Session.CommProtocol == COMM_PROTOCOL_MULTI_E_COMP) {
-				ev.Data.FrameInfo.Delay = max( ((((resp_time / 8) +
+			if (Session.CommProtocol >= COMM_PROTOCOL_MULTI_E_COMP) {
+				ev.Data.FrameInfo.Delay = Smooth_Max_Ahead(max( ((((resp_time / 8) +
 					(Session.FrameSendRate - 1)) / Session.FrameSendRate) *
-					Session.FrameSendRate), (Session.FrameSendRate * 2) );
+					Session.FrameSendRate), (Session.FrameSendRate * 2) ));
 			}
 			//..................................................................
 			// For sending packets every frame, just use the 1-way connection
@@ -1433,7 +1521,7 @@ static void Generate_Real_Timing_Event(ConnManClass *net, int my_sent)
 	// To convert to one-way packet time, divide by 2; to convert to game
 	// frames, ....uh....
 	//
-	resp_time = net->Response_Time();
+	resp_time = Measure_Response_Time(net);
 
 	//
 	// Compute our new 'MaxAhead' value, based upon the response time of our
@@ -1454,6 +1542,7 @@ static void Generate_Real_Timing_Event(ConnManClass *net, int my_sent)
 	//
 	maxahead = ((maxahead + Session.FrameSendRate - 1) / Session.FrameSendRate) * Session.FrameSendRate;
 	maxahead = MAX (maxahead, Session.FrameSendRate * 3);
+	maxahead = Smooth_Max_Ahead(maxahead);
 
 	ev.Type = EventClass::TIMING;
 	ev.Data.Timing.DesiredFrameRate = Session.DesiredFrameRate;
@@ -1743,7 +1832,7 @@ static void Send_FrameSync(ConnManClass *net, int cmd_count)
 	//------------------------------------------------------------------------
 	memset (&packet, 0, sizeof(EventClass));
 	packet.Type = EventClass::FRAMESYNC;
-	if (Session.CommProtocol == COMM_PROTOCOL_MULTI_E_COMP) {
+	if (Session.CommProtocol >= COMM_PROTOCOL_MULTI_E_COMP) {
 		packet.Frame = ((Frame + Session.MaxAhead + (Session.FrameSendRate - 1)) /
 			 Session.FrameSendRate) * Session.FrameSendRate;
 	}
@@ -2404,7 +2493,7 @@ static int Build_Send_Packet(void *buf, int bufsize, int frame_delay,
 	//........................................................................
 	// Set the frame to execute this event on; this is protocol-specific
 	//........................................................................
-	if (Session.CommProtocol == COMM_PROTOCOL_MULTI_E_COMP) {
+	if (Session.CommProtocol >= COMM_PROTOCOL_MULTI_E_COMP) {
 		finfo->Frame = ((Frame + frame_delay + (Session.FrameSendRate - 1)) /
 			 Session.FrameSendRate) * Session.FrameSendRate;
 	}
@@ -2456,6 +2545,15 @@ static int Build_Send_Packet(void *buf, int bufsize, int frame_delay,
 			size = Add_Compressed_Events(buf, bufsize, frame_delay, size, cap);
 			break;
 
+		//.....................................................................
+		// COMM_PROTOCOL_MULTI_V_COMP:
+		//   Like COMM_PROTOCOL_MULTI_E_COMP, but events are grouped into
+		//   runs of the same type & their fields are delta/varint encoded.
+		//.....................................................................
+		case (COMM_PROTOCOL_MULTI_V_COMP):
+			size = Add_Varint_Events(buf, bufsize, frame_delay, size, cap);
+			break;
+
 		//.....................................................................
 		// Default: We have no idea what to do, so do nothing.
 		//.....................................................................
@@ -2745,7 +2843,7 @@ int Add_Compressed_Events(void *buf, int bufsize, int frame_delay,
 		//.....................................................................
 		// Set the event's frame delay (this is protocol-dependent)
 		//.....................................................................
-		if (Session.CommProtocol == COMM_PROTOCOL_MULTI_E_COMP) {
+		if (Session.CommProtocol >= COMM_PROTOCOL_MULTI_E_COMP) {
 			OutList.First().Frame = ((Frame + frame_delay +
 				(Session.FrameSendRate - 1)) / Session.FrameSendRate) *
 				Session.FrameSendRate;
@@ -2880,6 +2978,267 @@ int Add_Compressed_Events(void *buf, int bufsize, int frame_delay,
 }	// end of Add_Compressed_Events
 
 
+//...........................................................................
+// Varint/delta event encoding (COMM_PROTOCOL_MULTI_V_COMP).
+//
+// After the FRAMEINFO header, the packet holds runs of events of the same
+// type.  Each run is stored as:
+//   EventType (1 byte)
+//   Run count (1 byte)
+//   Event #1 .. Event #n
+// Each event's data is split into 32-bit words; every word is stored as the
+// zigzag-encoded difference from the same word of the previous event in the
+// run, written as a varint.  Repeated missions, targets & cells thus cost a
+// single byte per field.  ADDPLAYER events are followed by their raw data.
+//...........................................................................
+#define	VARINT_MAX_WORDS	((sizeof(((EventClass *)0)->Data) + 3) / 4)
+#define	VARINT_MAX_BYTES	(VARINT_MAX_WORDS * 5)
+
+
+/***************************************************************************
+ * Event_Payload -- returns ptr to the data an event transmits             *
+ *                                                                         *
+ * INPUT:                                                                  *
+ *		event		event to examine																*
+ *                                                                         *
+ * OUTPUT:                                                                 *
+ *		ptr to the first byte of the event's transmitted data						*
+ *                                                                         *
+ * WARNINGS:                                                               *
+ *		none.																						*
+ *                                                                         *
+ * HISTORY:                                                                *
+ *   10/19/2026 AGT : Created.                                             *
+ *=========================================================================*/
+static void * Event_Payload(EventClass & event)
+{
+	switch (event.Type) {
+		case (EventClass::RESPONSE_TIME):
+			return (&event.Data.FrameInfo.Delay);
+
+		case (EventClass::ADDPLAYER):
+			return (&event.Data.Variable.Size);
+
+		default:
+			return (&event.Data);
+	}
+}
+
+
+/***************************************************************************
+ * Encode_Varint_Payload -- delta/varint encodes an event's data           *
+ *                                                                         *
+ * INPUT:                                                                  *
+ *		dest			buffer to store encoded data in (VARINT_MAX_BYTES)			*
+ *		data			event data to encode													*
+ *		datasize		# bytes of event data												*
+ *		prev			words of the previous event in the run; updated with		*
+ *						this event's words													*
+ *                                                                         *
+ * OUTPUT:                                                                 *
+ *		# bytes stored in 'dest'															*
+ *                                                                         *
+ * WARNINGS:                                                               *
+ *		none.																						*
+ *                                                                         *
+ * HISTORY:                                                                *
+ *   10/19/2026 AGT : Created.                                             *
+ *=========================================================================*/
+static int Encode_Varint_Payload(unsigned char *dest, void const *data,
+	int datasize, uint32_t *prev)
+{
+	int len = 0;
+
+	for (int offset = 0; offset < datasize; offset += sizeof(uint32_t)) {
+		uint32_t word = 0;
+		int wordsize = min((int)sizeof(word), datasize - offset);
+		memcpy(&word, ((char const *)data) + offset, wordsize);
+
+		//.....................................................................
+		// Zigzag the difference so small negative deltas stay small.
+		//.....................................................................
+		int32_t delta = (int32_t)(word - *prev);
+		uint32_t value = ((uint32_t)delta << 1) ^ (uint32_t)(delta >> 31);
+		*prev++ = word;
+
+		while (value >= 0x80) {
+			dest[len++] = (unsigned char)(value | 0x80);
+			value >>= 7;
+		}
+		dest[len++] = (unsigned char)value;
+	}
+
+	return (len);
+}
+
+
+/***************************************************************************
+ * Decode_Varint_Payload -- decodes an event's delta/varint data           *
+ *                                                                         *
+ * INPUT:                                                                  *
+ *		src			encoded data															*
+ *		srclen		# bytes available in 'src'											*
+ *		data			event data to fill in												*
+ *		datasize		# bytes of event data												*
+ *		prev			words of the previous event in the run; updated with		*
+ *						this event's words													*
+ *                                                                         *
+ * OUTPUT:                                                                 *
+ *		# bytes consumed from 'src', -1 if the data is truncated or corrupt	*
+ *                                                                         *
+ * WARNINGS:                                                               *
+ *		none.																						*
+ *                                                                         *
+ * HISTORY:                                                                *
+ *   10/19/2026 AGT : Created.                                             *
+ *=========================================================================*/
+static int Decode_Varint_Payload(unsigned char const *src, int srclen,
+	void *data, int datasize, uint32_t *prev)
+{
+	int len = 0;
+
+	for (int offset = 0; offset < datasize; offset += sizeof(uint32_t)) {
+		uint32_t value = 0;
+		int shift = 0;
+		for (;;) {
+			if (len >= srclen || shift > 28) {
+				return (-1);
+			}
+			unsigned char byte = src[len++];
+			value |= (uint32_t)(byte & 0x7F) << shift;
+			if ((byte & 0x80) == 0) break;
+			shift += 7;
+		}
+
+		int32_t delta = (int32_t)(value >> 1) ^ -(int32_t)(value & 1);
+		uint32_t word = *prev + (uint32_t)delta;
+		*prev++ = word;
+
+		int wordsize = min((int)sizeof(word), datasize - offset);
+		memcpy(((char *)data) + offset, &word, wordsize);
+	}
+
+	return (len);
+}
+
+
+/***************************************************************************
+ * Add_Varint_Events -- adds varint/delta encoded events to a packet       *
+ *                                                                         *
+ * INPUT:                                                                  *
+ *		buf				buffer to store packet in										*
+ *		bufsize			max size of buffer												*
+ *		frame_delay		desired frame delay to attach to all outgoing packets	*
+ *		size				current packet size												*
+ *		cap				max # events to process											*
+ *                                                                         *
+ * OUTPUT:                                                                 *
+ *		new size value																			*
+ *                                                                         *
+ * WARNINGS:                                                               *
+ *		This routine MUST check to be sure it doesn't overflow the buffer.	*
+ *                                                                         *
+ * HISTORY:                                                                *
+ *   10/19/2026 AGT : Created.                                             *
+ *=========================================================================*/
+int Add_Varint_Events(void *buf, int bufsize, int frame_delay,
+	int size, int cap)
+{
+	int num = 0;								// # of events processed
+	unsigned char *packet = (unsigned char *)buf;
+	unsigned char *countptr = NULL;		// ptr to rep count of current run
+	EventClass::EventType runtype = EventClass::EMPTY;
+	uint32_t prev[VARINT_MAX_WORDS];		// words of previous event in run
+	uint32_t next[VARINT_MAX_WORDS];		// words of the event being added
+	unsigned char encoded[VARINT_MAX_BYTES];
+
+	//------------------------------------------------------------------------
+	// Loop until there are no more events, we've processed our max # of
+	// events, or the buffer is full.
+	//------------------------------------------------------------------------
+	while (OutList.Count && (num < cap)) {
+
+		Keyboard->Check();
+
+		EventClass & event = OutList.First();
+		EventClass::EventType eventtype = event.Type;
+		int datasize = EventClass::EventLength[ eventtype ];
+
+		//.....................................................................
+		// Start a new run if the type changes or the rep count is maxed out;
+		// the first event of a run is encoded against zero.
+		//.....................................................................
+		bool newrun = (countptr == NULL || eventtype != runtype || *countptr == UCHAR_MAX);
+		if (newrun) {
+			memset(next, 0, sizeof(next));
+		} else {
+			memcpy(next, prev, sizeof(next));
+		}
+
+		int enclen = Encode_Varint_Payload(encoded, Event_Payload(event), datasize, next);
+		int storedsize = enclen + (newrun ? 2 : 0);
+		if (eventtype == EventClass::ADDPLAYER) {
+			storedsize += event.Data.Variable.Size;
+		}
+
+		//.....................................................................
+		// Will the next event exceed the size of the buffer?  If so,
+		// stop compressing.
+		//.....................................................................
+		if ( (size + storedsize) > bufsize )
+			break;
+
+		//.....................................................................
+		// Set the event's frame delay & ID
+		//.....................................................................
+		event.Frame = ((Frame + frame_delay +
+			(Session.FrameSendRate - 1)) / Session.FrameSendRate) *
+			Session.FrameSendRate;
+		event.ID = PlayerPtr->ID;
+
+		//.....................................................................
+		// Transfer the event in OutList to DoList, un-queue the OutList event.
+		// If the DoList is full, stop transferring immediately.
+		//.....................................................................
+		event.IsExecuted = 0;
+		if ( !DoList.Add( event ) ) {
+			break;
+		}
+		#ifdef MIRROR_QUEUE
+		MirrorList.Add(event);
+		#endif
+
+		//.....................................................................
+		// Store the event into the send packet buffer
+		//.....................................................................
+		if (newrun) {
+			packet[size++] = (unsigned char)eventtype;
+			countptr = packet + size;
+			packet[size++] = 0;
+			runtype = eventtype;
+		}
+
+		memcpy(packet + size, encoded, enclen);
+		size += enclen;
+
+		if (eventtype == EventClass::ADDPLAYER) {
+			memcpy(packet + size, event.Data.Variable.Pointer, event.Data.Variable.Size);
+			size += event.Data.Variable.Size;
+		}
+
+		(*countptr)++;
+		memcpy(prev, next, sizeof(prev));
+
+		num++;
+		OutList.Next();
+	}
+
+	return (size);
+
+}	// end of Add_Varint_Events
+
+
+
 /***************************************************************************
  * Breakup_Receive_Packet -- Splits a big packet into little ones.			*
  *                                                                         *
@@ -2910,6 +3269,10 @@ static int Breakup_Receive_Packet(void *buf, int bufsize )
 			count = Extract_Uncompressed_Events(buf, bufsize);
 			break;
 
+		case (COMM_PROTOCOL_MULTI_V_COMP):
+			count = Extract_Varint_Events(buf, bufsize);
+			break;
+
 		default:
 			count = Extract_Compressed_Events(buf, bufsize);
 			break;
@@ -3206,6 +3569,250 @@ int Extract_Compressed_Events(void *buf, int bufsize)
 }	// end of Extract_Compressed_Events
 
 
+/***************************************************************************
+ * Extract_Varint_Events -- extracts varint/delta encoded events           *
+ *                                                                         *
+ * INPUT:                                                                  *
+ *		buf			buffer containing events to extract								*
+ *		bufsize		length of 'buf'														*
+ *                                                                         *
+ * OUTPUT:                                                                 *
+ *		# events extracted, -1 if the DoList is full									*
+ *                                                                         *
+ * WARNINGS:                                                               *
+ *		A truncated or corrupt packet stops extraction at the bad event.		*
+ *                                                                         *
+ * HISTORY:                                                                *
+ *   10/19/2026 AGT : Created.                                             *
+ *=========================================================================*/
+int Extract_Varint_Events(void *buf, int bufsize)
+{
+	unsigned char *packet = (unsigned char *)buf;
+	EventClass *header = (EventClass *)buf;
+	EventClass eventdata;				// stores Frame, ID, etc
+	uint32_t prev[VARINT_MAX_WORDS];	// words of previous event in run
+	int count = 0;							// # events processed
+	int pos = offsetof(EventClass, Data) + size_of(EventClass, Data.FrameInfo);
+
+	if (bufsize < pos || header->Type == EventClass::FRAMESYNC) {
+		return (0);
+	}
+
+	//------------------------------------------------------------------------
+	// The FRAMEINFO header supplies the Frame & ID for all events, and is
+	// itself added to the DoList.
+	//------------------------------------------------------------------------
+	memset (&eventdata, 0, sizeof(EventClass));
+	eventdata.Type = EventClass::FRAMEINFO;
+	eventdata.Frame = header->Frame;
+	eventdata.ID = header->ID;
+	memcpy (&eventdata.Data, packet + offsetof(EventClass, Data),
+		size_of(EventClass, Data.FrameInfo));
+
+	if ( !DoList.Add( eventdata ) ) {
+		return (-1);
+	}
+	#ifdef MIRROR_QUEUE
+	MirrorList.Add( eventdata );
+	#endif
+	count++;
+
+	//------------------------------------------------------------------------
+	// Process each run of same-typed events
+	//------------------------------------------------------------------------
+	while (pos + 2 <= bufsize) {
+
+		Keyboard->Check();
+
+		int eventtype = packet[pos];
+		int numevents = packet[pos + 1];
+		pos += 2;
+
+		if (eventtype >= EventClass::LAST_EVENT) {
+			return (count);
+		}
+
+		int datasize = EventClass::EventLength[ eventtype ];
+		memset(prev, 0, sizeof(prev));
+
+		while (numevents--) {
+
+			memset (&eventdata.Data, 0, sizeof(eventdata.Data));
+			eventdata.Type = (EventClass::EventType)eventtype;
+
+			int len = Decode_Varint_Payload(packet + pos, bufsize - pos,
+				Event_Payload(eventdata), datasize, prev);
+			if (len < 0) {
+				return (count);
+			}
+			pos += len;
+
+			//..................................................................
+			// Variable-sized events carry their data after the encoded size
+			//..................................................................
+			if (eventdata.Type == EventClass::ADDPLAYER) {
+				if (eventdata.Data.Variable.Size > (uint32_t)(bufsize - pos)) {
+					return (count);
+				}
+				eventdata.Data.Variable.Pointer =
+					new char[eventdata.Data.Variable.Size];
+				memcpy (eventdata.Data.Variable.Pointer, packet + pos,
+					eventdata.Data.Variable.Size);
+				pos += eventdata.Data.Variable.Size;
+			}
+
+			if ( !DoList.Add( eventdata ) ) {
+				if (eventdata.Type == EventClass::ADDPLAYER) {
+					delete [] eventdata.Data.Variable.Pointer;
+				}
+				return (-1);
+			}
+			#ifdef MIRROR_QUEUE
+			MirrorList.Add( eventdata );
+			#endif
+
+			//..................................................................
+			// Keep count of how many events we add to the queue
+			//..................................................................
+			count++;
+		}
+	}
+
+	return (count);
+
+}	// end of Extract_Varint_Events
+
+
+/***************************************************************************
+ * Measure_Packets -- sizes played back events in each packet format       *
+ *                                                                         *
+ * This is the packet benchmark for a regression run.  The events read	*
+ * for a frame are sized as the uncompressed, compressed & varint packets	*
+ * that would carry them.  The varint packet is built & decoded again a		*
+ * number of times to time it, and the decoded events are checked			*
+ * against the originals.																	*
+ *                                                                         *
+ * INPUT:                                                                  *
+ *		first		index in DoList of the first event read for this frame		*
+ *		count		# events read for this frame										*
+ *                                                                         *
+ * OUTPUT:                                                                 *
+ *		none.																						*
+ *                                                                         *
+ * WARNINGS:                                                               *
+ *		ADDPLAYER data can't be played back, so only its size is counted.	*
+ *                                                                         *
+ * HISTORY:                                                                *
+ *   10/19/2026 AGT : Created.                                             *
+ *=========================================================================*/
+static void Measure_Packets(int first, int count)
+{
+	int const repeats = 16;
+	int header = offsetof(EventClass, Data) + size_of(EventClass, Data.FrameInfo);
+	long plain = sizeof(EventClass) * (count + 1);
+	long compressed = header;
+	long varint = header;
+	bool match = true;
+	uint32_t prev[VARINT_MAX_WORDS];
+
+	unsigned char *packet = new unsigned char[count * (VARINT_MAX_BYTES + 2) + 1];
+
+	//------------------------------------------------------------------------
+	// Size the events as Add_Compressed_Events would store them: a repeated
+	// MEGAMISSION only stores its 'Whom'.
+	//------------------------------------------------------------------------
+	for (int i = 0; i < count; i++) {
+		EventClass & event = DoList[first + i];
+		int extra = (event.Type == EventClass::ADDPLAYER) ? event.Data.Variable.Size : 0;
+		plain += extra;
+		compressed += extra;
+		varint += extra;
+
+		if (event.Type == EventClass::MEGAMISSION && i > 0 &&
+			DoList[first + i - 1].Type == EventClass::MEGAMISSION &&
+			event.Data.MegaMission.Mission == DoList[first + i - 1].Data.MegaMission.Mission &&
+			event.Data.MegaMission.Target == DoList[first + i - 1].Data.MegaMission.Target &&
+			event.Data.MegaMission.Destination == DoList[first + i - 1].Data.MegaMission.Destination) {
+			compressed += sizeof(event.Data.MegaMission.Whom);
+		}
+		else {
+			compressed += EventClass::EventLength[ event.Type ] + sizeof(EventClass::EventType);
+			if (event.Type == EventClass::MEGAMISSION) {
+				compressed += sizeof(unsigned char);
+			}
+		}
+	}
+
+	//------------------------------------------------------------------------
+	// Encode the events into runs just as Add_Varint_Events does.
+	//------------------------------------------------------------------------
+	int size = 0;
+	double start = MetricsClass::Now();
+	for (int repeat = 0; repeat < repeats; repeat++) {
+		unsigned char *countptr = NULL;
+		EventClass::EventType runtype = EventClass::EMPTY;
+		size = 0;
+		for (int i = 0; i < count; i++) {
+			EventClass & event = DoList[first + i];
+			if (countptr == NULL || event.Type != runtype || *countptr == UCHAR_MAX) {
+				packet[size++] = (unsigned char)event.Type;
+				countptr = packet + size;
+				packet[size++] = 0;
+				runtype = event.Type;
+				memset(prev, 0, sizeof(prev));
+			}
+			size += Encode_Varint_Payload(packet + size, Event_Payload(event),
+				EventClass::EventLength[ event.Type ], prev);
+			(*countptr)++;
+		}
+	}
+	double encode = (MetricsClass::Now() - start) / repeats;
+	varint += size;
+
+	//------------------------------------------------------------------------
+	// Decode the runs, checking that each event comes back the same.
+	//------------------------------------------------------------------------
+	start = MetricsClass::Now();
+	for (int repeat = 0; repeat < repeats; repeat++) {
+		int pos = 0;
+		int i = 0;
+		while (pos + 2 <= size && i < count) {
+			int eventtype = packet[pos];
+			int numevents = packet[pos + 1];
+			int datasize = EventClass::EventLength[ eventtype ];
+			pos += 2;
+			memset(prev, 0, sizeof(prev));
+
+			while (numevents-- && i < count) {
+				EventClass decoded;
+				memset(&decoded, 0, sizeof(decoded));
+				decoded.Type = (EventClass::EventType)eventtype;
+				int len = Decode_Varint_Payload(packet + pos, size - pos,
+					Event_Payload(decoded), datasize, prev);
+				if (len < 0 || eventtype != DoList[first + i].Type ||
+					memcmp(Event_Payload(decoded), Event_Payload(DoList[first + i]), datasize) != 0) {
+					match = false;
+					break;
+				}
+				pos += len;
+				i++;
+			}
+			if (!match) break;
+		}
+		if (i != count || pos != size) {
+			match = false;
+		}
+	}
+	double decode = (MetricsClass::Now() - start) / repeats;
+
+	delete [] packet;
+
+	Regression.Packets(count, plain, compressed, varint, encode, decode, match);
+
+}	// end of Measure_Packets
+
+
+
 /***************************************************************************
  * Execute_DoList -- Executes commands from the DoList                     *
  *                                                                         *
@@ -3648,6 +4255,7 @@ static void Queue_Record(void)
  *                                                                         *
  * HISTORY:                                                                *
  *   05/15/1995 BRR : Created.                                             *
+ *   10/19/2026 AGT : Measures packets in regression runs.                 *
  *=========================================================================*/
 static void Queue_Playback(void)
 {
@@ -3670,6 +4278,12 @@ static void Queue_Playback(void)
 			GameActive = 0;
 			return;
 		}
+
+		//.....................................................................
+		// Page up & page down skip back & ahead a minute; home goes back to
+		// the start.
+		//.....................................................................
+		Replay.Key(KeyNumType(key));
 	}
 
 	//------------------------------------------------------------------------
@@ -3684,11 +4298,23 @@ static void Queue_Playback(void)
 	mx = Get_Mouse_X();
 	my = Get_Mouse_Y();
 
+	//------------------------------------------------------------------------
+	// Keep a snapshot every so often, so the playback can seek back to it.
+	// A regression run keeps them too, so that it can check a seek.
+	//------------------------------------------------------------------------
+	if (Regression.IsActive) {
+		Regression.AI();
+	}
+	Replay.AI();
+
 	//------------------------------------------------------------------------
 	//	Compute the Game's CRC
 	//------------------------------------------------------------------------
 	Compute_Game_CRC();
 	CRC[Frame & 0x001f] = GameCRC;
+	if (Regression.IsActive) {
+		Regression.Frame(GameCRC);
+	}
 
 	//------------------------------------------------------------------------
 	// If we've reached the CRC print frame, do so & exit
@@ -3714,7 +4340,7 @@ static void Queue_Playback(void)
 	testframe = ((Frame + (Session.FrameSendRate - 1)) /
 		Session.FrameSendRate) * Session.FrameSendRate;
 	if ( (Session.Type != GAME_NORMAL && Session.Type != GAME_SKIRMISH) &&
-		Session.CommProtocol == COMM_PROTOCOL_MULTI_E_COMP) {
+		Session.CommProtocol >= COMM_PROTOCOL_MULTI_E_COMP) {
 		if (Frame != testframe) {
 			return;
 		}
@@ -3724,6 +4350,7 @@ static void Queue_Playback(void)
 	//	Read the DoList from disk
 	//------------------------------------------------------------------------
 	ok = 1;
+	int first = DoList.Count;
 	if (Session.RecordFile.Read (&numevents, sizeof(numevents)) ==
 		sizeof(numevents)) {
 		for (i = 0; i < numevents; i++) {
@@ -3750,6 +4377,13 @@ static void Queue_Playback(void)
 		return;
 	}
 
+	//------------------------------------------------------------------------
+	// A regression run also measures the packets that would carry the events.
+	//------------------------------------------------------------------------
+	if (Regression.IsActive) {
+		Measure_Packets(first, DoList.Count - first);
+	}
+
 
 	//------------------------------------------------------------------------
 	// Execute the DoList; if an error occurs, bail out.
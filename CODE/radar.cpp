@@ -126,8 +126,9 @@ RadarClass::RadarClass(void) :
 	IsPlayerNames(false),
 	IsHouseSpy(false),
 	SpyingOn(HOUSE_SPAIN),
-	PixelPtr(0)
+	PixelCount(0)
 {
+	memset(PixelBits, '\0', sizeof(PixelBits));
 }
 
 
@@ -207,7 +208,8 @@ void RadarClass::Init_Clear(void)
 	IsRadarActivating 	= false;
 	IsRadarDeactivating 	= false;
 	DoesRadarExist 		= false;
-	PixelPtr 				= 0;
+	PixelCount				= 0;
+	memset(PixelBits, '\0', sizeof(PixelBits));
 	IsPlayerNames			= false;
 
 	/*
@@ -362,6 +364,7 @@ bool RadarClass::Radar_Activate(int control)
  * HISTORY:                                                                                    *
  *   04/24/1991 JLB : Created.                                                                 *
  *   05/08/1994 JLB : Converted to member function.                                            *
+ *   10/19/2026 AGT : Redraws from the bit array and only the cells in view.                   *
  *=============================================================================================*/
 void RadarClass::Draw_It(bool forced)
 {
@@ -486,46 +489,29 @@ void RadarClass::Draw_It(bool forced)
 			if (!forced && IsToRedraw && !FullRedraw && !IsPulseActive) {
 				IsToRedraw = false;
 
-				if (PixelPtr) {
+				if (PixelCount) {
 
 					/*
-					**	Render all pixels in the "to redraw" stack.
+					**	Render all pixels flagged in the "to redraw" bits. Whole words with no
+					**	bits set are skipped, so this costs little more than the cells plotted.
 					*/
 					if (LogicPage->Lock()) {
-						for (int index = 0; index < PixelPtr; index++) {
-							CELL cell = PixelStack[index];
-					  		if (Cell_On_Radar(cell)) {
-								(*this)[cell].IsPlot = false;
-								Plot_Radar_Pixel(cell);
-								RadarCursorRedraw |= (*this)[cell].IsRadarCursor;
-							}
-						}
-						LogicPage->Unlock();
-					}
-
-					/*
-					**	Refill the stack if there is pending pixels yet to be plotted.
-					**	This should only process in sections for speed reasons
-					*/
-					if (PixelPtr == PIXELSTACK) {
-						PixelPtr = 0;
-
-						for (int y = 0; y < MapCellHeight; y++) {
-							for (int x = 0; x < MapCellWidth; x++) {
-								CELL cell = XY_Cell(MapCellX + x, MapCellY + y);
-							  	if (Cell_On_Radar(cell)) {
-
-									if ((*this)[cell].IsPlot) {
-										PixelStack[PixelPtr++] = cell;
-										IsToRedraw = true;
-										if	(PixelPtr == PIXELSTACK) break;
-									}
+						for (int index = 0; index < ARRAY_SIZE(PixelBits); index++) {
+							unsigned bits = PixelBits[index];
+							if (bits == 0) continue;
+							PixelBits[index] = 0;
+
+							CELL cell = (CELL)(index * PIXELBITS);
+							for (; bits != 0; bits >>= 1, cell++) {
+								if ((bits & 1) && Cell_On_Radar(cell)) {
+									(*this)[cell].IsPlot = false;
+									Plot_Radar_Pixel(cell);
+									RadarCursorRedraw |= (*this)[cell].IsRadarCursor;
 								}
 							}
-							if	(PixelPtr == PIXELSTACK) break;
 						}
-					} else {
-						PixelPtr = 0;
+						PixelCount = 0;
+						LogicPage->Unlock();
 					}
 				}
 
@@ -565,11 +551,23 @@ void RadarClass::Draw_It(bool forced)
 				** Draw the entire radar map.
 				*/
 				if (LogicPage->Lock()) {
-					for (int index = 0; index < MAP_CELL_TOTAL; index++) {
-						if (In_Radar(index) && Cell_On_Radar(index)) {
-							Plot_Radar_Pixel(index);
+
+					/*
+					**	Only the cells that fit in the radar window can be plotted, so there
+					**	is no need to visit the rest of the map.
+					*/
+					unsigned x2 = min(RadarX + RadarCellWidth, (unsigned)MAP_CELL_W);
+					unsigned y2 = min(RadarY + RadarCellHeight, (unsigned)MAP_CELL_H);
+					for (unsigned y = RadarY; y < y2; y++) {
+						for (unsigned x = RadarX; x < x2; x++) {
+							CELL cell = XY_Cell(x, y);
+							if (In_Radar(cell) && Cell_On_Radar(cell)) {
+								Plot_Radar_Pixel(cell);
+							}
 						}
 					}
+					memset(PixelBits, '\0', sizeof(PixelBits));
+					PixelCount = 0;
 					if (IsPulseActive) {
 						CC_Draw_Shape(RadarPulse, RadarPulseFrame++, RadX + RadOffX, RadY+1*RESFACTOR, WINDOW_MAIN, SHAPE_NORMAL);
 					}
@@ -1138,14 +1136,18 @@ void RadarClass::Plot_Radar_Pixel(CELL cell)
  * HISTORY:                                                                                    *
  *   07/12/1992 JLB : Created.                                                                 *
  *   05/08/1994 JLB : Converted to member function.                                            *
+ *   10/19/2026 AGT : Flags the cell in the redraw bits.                                       *
  *=============================================================================================*/
 void RadarClass::Radar_Pixel(CELL cell)
 {
 	if (IsRadarActive && Map.IsSidebarActive && Cell_On_Radar(cell)) {
 		IsToRedraw = true;
 		(*this)[cell].IsPlot = true;
-		if (PixelPtr < PIXELSTACK) {
-			PixelStack[PixelPtr++] = cell;
+
+		unsigned bit = 1U << (cell % PIXELBITS);
+		if ((PixelBits[cell / PIXELBITS] & bit) == 0) {
+			PixelBits[cell / PIXELBITS] |= bit;
+			PixelCount++;
 		}
 	}
 }
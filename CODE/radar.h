@@ -234,12 +234,13 @@ class RadarClass: public DisplayClass
 		HousesType SpyingOn;
 
 		/*
-		**	This is the list of radar pixels that need to be updated. Only a partial
-		**	list is maintained for maximum speed.
+		**	This has one bit for every map cell and flags the radar pixels that need to
+		**	be updated. A whole word of clear bits can be skipped at once, so finding
+		**	the few cells that changed never requires looking at every cell.
 		*/
-		unsigned PixelPtr;
-		enum PixelStackEnums {PIXELSTACK=400};
-		CELL PixelStack[PIXELSTACK];
+		unsigned PixelCount;
+		enum PixelBitsEnums {PIXELBITS=32};
+		unsigned PixelBits[MAP_CELL_TOTAL/PIXELBITS];
 };
 
 
@@ -34,10 +34,12 @@
  *---------------------------------------------------------------------------------------------*
  * Functions:                                                                                  *
  *   RawFileClass::Bias -- Bias a file with a specific starting position and length.           *
+ *   RawFileClass::Changed_File -- Fetches the name of a file that was changed.                *
  *   RawFileClass::Close -- Perform a closure of the file.                                     *
  *   RawFileClass::Create -- Creates an empty file.                                            *
  *   RawFileClass::Delete -- Deletes the file object from the disk.                            *
  *   RawFileClass::Error -- Handles displaying a file error message.                           *
+ *   RawFileClass::File_Changed -- Records a change to a file on disk.                         *
  *   RawFileClass::Get_Date_Time -- Gets the date and time the file was last modified.         *
  *   RawFileClass::Is_Available -- Checks to see if the specified file is available to open.   *
  *   RawFileClass::Open -- Assigns name and opens file in one operation.                       *
@@ -45,6 +47,7 @@
  *   RawFileClass::RawFileClass -- Simple constructor for a file object.                       *
  *   RawFileClass::Raw_Seek -- Performs a seek on the unbiased file                            *
  *   RawFileClass::Read -- Reads the specified number of bytes into a memory buffer.           *
+ *   RawFileClass::Rename -- Renames the file on disk, replacing any file of the new name.     *
  *   RawFileClass::Seek -- Reposition the file pointer as indicated.                           *
  *   RawFileClass::Set_Date_Time -- Sets the date and time the file was last modified.         *
  *   RawFileClass::Set_Name -- Manually sets the name for a file object.                       *
@@ -73,6 +76,9 @@
 extern short Hard_Error_Occured;
 #endif
 
+unsigned long RawFileClass::ChangeCount = 0;
+char RawFileClass::ChangeLog[CHANGE_LOG][CHANGE_NAME_MAX];
+
 
 /***********************************************************************************************
  * RawFileClass::Error -- Handles displaying a file error message.                             *
@@ -218,6 +224,7 @@ int RawFileClass::Open(char const * filename, int rights)
  *                                                                                             *
  * HISTORY:                                                                                    *
  *   10/17/1994 JLB : Created.                                                                 *
+ *   10/19/2026 AGT : Logs the change for disk caches.                                         *
  *=============================================================================================*/
 int RawFileClass::Open(int rights)
 {
@@ -237,6 +244,13 @@ int RawFileClass::Open(int rights)
 	*/
 	Rights = rights;
 
+	/*
+	**	Opening for write may create the file, so anything cached about it is stale.
+	*/
+	if (rights & WRITE) {
+		File_Changed(Filename);
+	}
+
 	/*
 	**	Repetitively try to open the file. Abort if a fatal error condition occurs.
 	*/
@@ -1019,6 +1033,7 @@ int RawFileClass::Create(void)
  *                                                                                             *
  * HISTORY:                                                                                    *
  *   10/18/1994 JLB : Created.                                                                 *
+ *   10/19/2026 AGT : Logs the change for disk caches.                                         *
  *=============================================================================================*/
 int RawFileClass::Delete(void)
 {
@@ -1093,10 +1108,106 @@ int RawFileClass::Delete(void)
 	/*
 	**	DOS reports that the file was successfully deleted. Return with this fact.
 	*/
+	File_Changed(Filename);
 	return(true);
 }
 
 
+/***********************************************************************************************
+ * RawFileClass::Rename -- Renames the file on disk, replacing any file of the new name.       *
+ *                                                                                             *
+ *    The file is closed and then renamed. If a file of the new name is already there, it is   *
+ *    replaced; this makes it possible to write a file safely by writing a temporary file and  *
+ *    then renaming it over the old one. The file object takes on the new name.                *
+ *                                                                                             *
+ * INPUT:   newname  -- The new name for the file.                                             *
+ *                                                                                             *
+ * OUTPUT:  bool; Was the file renamed?                                                        *
+ *                                                                                             *
+ * WARNINGS:   If the new name had to be removed first and the rename still fails, the file    *
+ *             of the new name is gone.                                                        *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+bool RawFileClass::Rename(char const * newname)
+{
+	Close();
+
+	if (Filename == NULL || newname == NULL) {
+		return(false);
+	}
+
+	/*
+	**	Some systems will not rename over a file that already exists.
+	*/
+	bool ok = (rename(Filename, newname) == 0);
+	if (!ok) {
+		remove(newname);
+		ok = (rename(Filename, newname) == 0);
+	}
+	File_Changed(Filename);
+	File_Changed(newname);
+
+	if (ok) {
+		Set_Name(newname);
+	}
+	return(ok);
+}
+
+
+/***********************************************************************************************
+ * RawFileClass::File_Changed -- Records a change to a file on disk.                           *
+ *                                                                                             *
+ *    The change is counted and the file name is logged, so that anything that caches what is  *
+ *    on disk can refresh what it knows about just this file.                                  *
+ *                                                                                             *
+ * INPUT:   filename -- The name of the file that was (or may have been) created, written,     *
+ *                      renamed or deleted.                                                    *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   A name too long for the log is logged as empty, which Changed_File reports as   *
+ *             unknown.                                                                        *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+void RawFileClass::File_Changed(char const * filename)
+{
+	char * entry = ChangeLog[ChangeCount % CHANGE_LOG];
+	if (filename != NULL && strlen(filename) < CHANGE_NAME_MAX) {
+		strcpy(entry, filename);
+	} else {
+		entry[0] = '\0';
+	}
+	ChangeCount++;
+}
+
+
+/***********************************************************************************************
+ * RawFileClass::Changed_File -- Fetches the name of a file that was changed.                  *
+ *                                                                                             *
+ * INPUT:   change   -- The change count before the change (0 for the first change).           *
+ *                                                                                             *
+ * OUTPUT:  Returns with the name of the file changed, or NULL if the change has dropped       *
+ *          out of the log or its name is not known.                                           *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+char const * RawFileClass::Changed_File(unsigned long change)
+{
+	if (ChangeCount - change > CHANGE_LOG || change >= ChangeCount) {
+		return(NULL);
+	}
+	char const * entry = ChangeLog[change % CHANGE_LOG];
+	return((entry[0] != '\0') ? entry : NULL);
+}
+
+
 /***********************************************************************************************
  * RawFileClass::Get_Date_Time -- Gets the date and time the file was last modified.           *
  *                                                                                             *
@@ -156,6 +156,7 @@ class RawFileClass : public FileClass
 		virtual char const * Set_Name(char const *filename);
 		virtual int Create(void);
 		virtual int Delete(void);
+		bool Rename(char const * newname);
 		virtual int Is_Available(int forced=false);
 		virtual int Is_Open(void) const;
 		virtual int Open(char const *filename, int rights=READ);
@@ -173,6 +174,17 @@ class RawFileClass : public FileClass
 
 		HANDLE_TYPE Get_File_Handle(void) { return (Handle); };
 
+		/*
+		**	This counts the files opened for writing, renamed or deleted, and logs the names
+		**	of the most recent ones. Anything that caches what is on disk compares the count
+		**	with the count it last saw, and refreshes just the files changed since, as long
+		**	as they are still in the log.
+		*/
+		enum {CHANGE_LOG=16, CHANGE_NAME_MAX=256};
+		static unsigned long ChangeCount;
+		static char const * Changed_File(unsigned long change);
+		static void File_Changed(char const * filename);
+
 		/*
 		**	These bias values enable a sub-portion of a file to appear as if it
 		**	were the whole file. This comes in very handy for multi-part files such as
@@ -226,6 +238,11 @@ class RawFileClass : public FileClass
 		**	(using strdup()).
 		*/
 		unsigned Allocated:1;
+
+		/*
+		**	The names of the most recently changed files, by change count.
+		*/
+		static char ChangeLog[CHANGE_LOG][CHANGE_NAME_MAX];
 };
 
 
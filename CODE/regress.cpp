@@ -0,0 +1,515 @@
+/*
+**	Command & Conquer Red Alert(tm)
+**	Copyright 2025 Electronic Arts Inc.
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/***********************************************************************************************
+ *                                                                                             *
+ *                 Project Name : Command & Conquer                                            *
+ *                                                                                             *
+ *                    File Name : REGRESS.CPP                                                  *
+ *                                                                                             *
+ *                   Start Date : 10/19/26                                                     *
+ *                                                                                             *
+ *                  Last Update : October 19, 2026                                             *
+ *                                                                                             *
+ *---------------------------------------------------------------------------------------------*
+ * Functions:                                                                                  *
+ *   RegressionClass::AI -- Seeks back to the frame being checked when it is time to.          *
+ *   RegressionClass::Finish -- Checks and reports on the finished playback.                   *
+ *   RegressionClass::Frame -- Records the game CRC of a frame played back.                    *
+ *   RegressionClass::Load_Golden -- Reads in the golden trace.                                *
+ *   RegressionClass::Packets -- Adds up the packets measured for a frame's events.            *
+ *   RegressionClass::RegressionClass -- Constructor for the regression benchmark.             *
+ *   RegressionClass::Start -- Sets up a recording to be run as a regression benchmark.        *
+ *   RegressionClass::Write_Report -- Writes the result and the scope timings to a file.       *
+ *   RegressionClass::Write_Trace -- Writes the trace of this run to a file.                   *
+ * - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+#include	"function.h"
+
+
+/***********************************************************************************************
+ * RegressionClass::RegressionClass -- Constructor for the regression benchmark.               *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+RegressionClass::RegressionClass(void) :
+	IsActive(false),
+	SeekFrame(-1),
+	IsGolden(false),
+	HasGolden(false),
+	Mismatch(-1),
+	SeekFrom(-1),
+	SeekMismatch(-1),
+	PacketEvents(0),
+	PlainBytes(0),
+	CompressedBytes(0),
+	VarintBytes(0),
+	EncodeTime(0),
+	DecodeTime(0),
+	PacketFrame(-1),
+	PacketMismatch(-1),
+	StartTime(0)
+{
+	Name[0] = '\0';
+	Trace.Set_Growth_Step(4096);
+	Golden.Set_Growth_Step(4096);
+}
+
+
+/***********************************************************************************************
+ * RegressionClass::Start -- Sets up a recording to be run as a regression benchmark.          *
+ *                                                                                             *
+ *    The recording is set up to be played back, its golden trace is read in if there is       *
+ *    one, and the profiler is started so that the time spent in every scope is totalled up.   *
+ *                                                                                             *
+ * INPUT:   name  -- The name of the recording, without the extension.                         *
+ *                                                                                             *
+ * OUTPUT:  bool; Was the recording found?                                                     *
+ *                                                                                             *
+ * WARNINGS:   This must be called before the game is started, since it turns on playback.     *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+bool RegressionClass::Start(char const * name)
+{
+	char filename[_MAX_PATH+4];
+
+	strncpy(Name, name, sizeof(Name)-1);
+	Name[sizeof(Name)-1] = '\0';
+
+	sprintf(filename, "%s.BIN", Name);
+	if (!RawFileClass(filename).Is_Available()) return(false);
+	Session.RecordFile.Set_Name(filename);
+	Session.Play = true;
+	Session.Record = false;
+
+	sprintf(filename, "%s.CRC", Name);
+	HasGolden = Load_Golden(filename);
+
+	Trace.Delete_All();
+	Mismatch = -1;
+	SeekFrom = -1;
+	SeekMismatch = -1;
+	PacketEvents = 0;
+	PlainBytes = 0;
+	CompressedBytes = 0;
+	VarintBytes = 0;
+	EncodeTime = 0;
+	DecodeTime = 0;
+	PacketFrame = -1;
+	PacketMismatch = -1;
+	StartTime = MetricsClass::Now();
+	if (!Profiler.IsActive) {
+		Profiler.Start();
+	}
+	IsActive = true;
+	return(true);
+}
+
+
+/***********************************************************************************************
+ * RegressionClass::AI -- Seeks back to the frame being checked when it is time to.            *
+ *                                                                                             *
+ *    Once the playback has gone a minute past the frame to check, it is sent back to that     *
+ *    frame. The replay seeker puts it back to its last snapshot at or before the frame and    *
+ *    plays it forward from there, and Frame checks each frame played again.                   *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   Only call this from Queue_Playback, before the replay seeker's AI.              *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+void RegressionClass::AI(void)
+{
+	if (SeekFrame >= 0 && SeekFrom < 0 && ::Frame >= SeekFrame + TICKS_PER_MINUTE) {
+		SeekFrom = ::Frame;
+		Replay.Seek(SeekFrame);
+	}
+}
+
+
+/***********************************************************************************************
+ * RegressionClass::Frame -- Records the game CRC of a frame played back.                      *
+ *                                                                                             *
+ *    The CRC is added to the trace and checked against the golden trace. Only the first frame *
+ *    that differs is noted, since every frame after it is expected to differ too. A frame     *
+ *    played again after the seek check is checked against the trace instead.                  *
+ *                                                                                             *
+ * INPUT:   crc   -- The game CRC computed at the start of the frame.                          *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+void RegressionClass::Frame(unsigned long crc)
+{
+	/*
+	**	A frame played again after the seek check must come out as it did the first time.
+	*/
+	if (SeekFrom >= 0 && ::Frame < Trace.Count()) {
+		if (SeekMismatch < 0 && Trace[(int)::Frame] != crc) {
+			SeekMismatch = ::Frame;
+		}
+		return;
+	}
+
+	int frame = Trace.Count();
+	Trace.Add(crc);
+
+	if (HasGolden && !IsGolden && Mismatch < 0) {
+		if (frame >= Golden.Count() || Golden[frame] != crc) {
+			Mismatch = frame;
+		}
+	}
+}
+
+
+/***********************************************************************************************
+ * RegressionClass::Packets -- Adds up the packets measured for a frame's events.              *
+ *                                                                                             *
+ *    Queue_Playback measures the events it reads for each frame and passes the results on     *
+ *    to be totalled for the report. A frame played again after the seek check is not counted  *
+ *    again.                                                                                   *
+ *                                                                                             *
+ * INPUT:   events     -- The number of events read for the frame.                             *
+ *                                                                                             *
+ *          plain      -- The bytes of the uncompressed packet that would carry them.          *
+ *                                                                                             *
+ *          compressed -- The bytes of the compressed packet.                                  *
+ *                                                                                             *
+ *          varint     -- The bytes of the varint packet.                                      *
+ *                                                                                             *
+ *          encode     -- The seconds it took to encode the varint packet.                     *
+ *                                                                                             *
+ *          decode     -- The seconds it took to decode it again.                              *
+ *                                                                                             *
+ *          match      -- Did the varint packet decode to the same events?                     *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+void RegressionClass::Packets(int events, long plain, long compressed, long varint, double encode, double decode, bool match)
+{
+	if (::Frame <= PacketFrame) return;
+	PacketFrame = ::Frame;
+
+	PacketEvents += events;
+	PlainBytes += plain;
+	CompressedBytes += compressed;
+	VarintBytes += varint;
+	EncodeTime += encode;
+	DecodeTime += decode;
+	if (!match && PacketMismatch < 0) {
+		PacketMismatch = ::Frame;
+	}
+}
+
+
+/***********************************************************************************************
+ * RegressionClass::Finish -- Checks and reports on the finished playback.                     *
+ *                                                                                             *
+ *    This is called once the playback has ended. The trace is written out, either as the new  *
+ *    golden trace or alongside the golden one that it was checked against, and the report is  *
+ *    written. A run that has no golden trace to check against fails, unless it was asked to   *
+ *    make one.                                                                                *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  Returns with the ResultType code that the game should exit with.                   *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *   10/19/2026 AGT : Only makes a golden trace when asked to.                                 *
+ *=============================================================================================*/
+int RegressionClass::Finish(void)
+{
+	char filename[_MAX_PATH+4];
+	ResultType result = RESULT_MATCH;
+
+	IsActive = false;
+	Profiler.Stop();
+
+	/*
+	**	A recording that could not be played at all has nothing to check.
+	*/
+	if (Trace.Count() == 0) {
+		result = RESULT_ERROR;
+	}
+
+	/*
+	**	Unless this run is to make the golden trace, there must be one to check against.
+	*/
+	if (!IsGolden && !HasGolden) {
+		result = RESULT_ERROR;
+	}
+
+	/*
+	**	A seek check that was asked for must have been made, and have matched.
+	*/
+	if (SeekFrame >= 0 && result == RESULT_MATCH) {
+		if (SeekFrom < 0) {
+			result = RESULT_ERROR;
+		} else if (SeekMismatch >= 0) {
+			result = RESULT_MISMATCH;
+		}
+	}
+
+	/*
+	**	Every varint packet must have decoded to the events it was built from.
+	*/
+	if (PacketMismatch >= 0 && result == RESULT_MATCH) {
+		result = RESULT_MISMATCH;
+	}
+
+	/*
+	**	The playback must also have run exactly as long as the golden one did.
+	*/
+	if (!IsGolden && result == RESULT_MATCH) {
+		if (Mismatch < 0 && Trace.Count() != Golden.Count()) {
+			Mismatch = min(Trace.Count(), Golden.Count());
+		}
+		if (Mismatch >= 0) {
+			result = RESULT_MISMATCH;
+		}
+	}
+
+	/*
+	**	Only a run that played out the same way after seeking can become the golden trace.
+	*/
+	sprintf(filename, (IsGolden && result == RESULT_MATCH) ? "%s.CRC" : "%s.OUT", Name);
+	if (!Write_Trace(filename)) {
+		result = RESULT_ERROR;
+	}
+
+	sprintf(filename, "%s.TXT", Name);
+	Write_Report(filename, result);
+
+	return(result);
+}
+
+
+/***********************************************************************************************
+ * RegressionClass::Load_Golden -- Reads in the golden trace.                                  *
+ *                                                                                             *
+ *    The trace file holds one line per frame, with the frame number and then its game CRC in  *
+ *    hexadecimal.                                                                             *
+ *                                                                                             *
+ * INPUT:   filename -- The name of the golden trace file.                                     *
+ *                                                                                             *
+ * OUTPUT:  bool; Was a golden trace read in?                                                  *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+bool RegressionClass::Load_Golden(char const * filename)
+{
+	Golden.Delete_All();
+
+	RawFileClass file(filename);
+	if (!file.Is_Available() || !file.Open(READ)) return(false);
+
+	long size = file.Size();
+	char * buffer = new char [size+1];
+	if (buffer == NULL) {
+		file.Close();
+		return(false);
+	}
+	size = file.Read(buffer, size);
+	buffer[max(size, 0L)] = '\0';
+	file.Close();
+
+	char * line = buffer;
+	while (*line != '\0') {
+		int frame;
+		unsigned long crc;
+		if (sscanf(line, "%d %lx", &frame, &crc) == 2) {
+			Golden.Add(crc);
+		}
+		line = strchr(line, '\n');
+		if (line == NULL) break;
+		line++;
+	}
+
+	delete [] buffer;
+	return(Golden.Count() > 0);
+}
+
+
+/***********************************************************************************************
+ * RegressionClass::Write_Trace -- Writes the trace of this run to a file.                     *
+ *                                                                                             *
+ * INPUT:   filename -- The name of the file to write the trace to.                            *
+ *                                                                                             *
+ * OUTPUT:  bool; Was the trace written?                                                       *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+bool RegressionClass::Write_Trace(char const * filename) const
+{
+	RawFileClass file(filename);
+	FilePipe pipe(file);
+	char buffer[32];
+	int total = 0;
+
+	for (int index = 0; index < Trace.Count(); index++) {
+		sprintf(buffer, "%d %08lX\n", index, Trace[index]);
+		total += pipe.Put(buffer, strlen(buffer));
+	}
+	total += pipe.End();
+	file.Close();
+
+	return(total > 0);
+}
+
+
+/***********************************************************************************************
+ * RegressionClass::Write_Report -- Writes the result and the scope timings to a file.         *
+ *                                                                                             *
+ *    The report says whether the trace matched and, if not, the first frame that differed.    *
+ *    It then lists the total and per frame time spent in each benchmark scope, so that runs   *
+ *    from before and after a change can be compared.                                          *
+ *                                                                                             *
+ * INPUT:   filename -- The name of the file to write the report to.                           *
+ *                                                                                             *
+ *          result   -- The result of the run.                                                 *
+ *                                                                                             *
+ * OUTPUT:  bool; Was the report written?                                                      *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *   10/19/2026 AGT : Says when there is no golden trace.                                      *
+ *=============================================================================================*/
+bool RegressionClass::Write_Report(char const * filename, ResultType result) const
+{
+	RawFileClass file(filename);
+	FilePipe pipe(file);
+	char buffer[256];
+	int total = 0;
+	int frames = max(Trace.Count(), 1);
+	double elapsed = MetricsClass::Now() - StartTime;
+
+	sprintf(buffer, "Recording: %s.BIN\nFrames: %d\n", Name, Trace.Count());
+	total += pipe.Put(buffer, strlen(buffer));
+
+	switch (result) {
+		case RESULT_MATCH:
+			if (IsGolden) {
+				sprintf(buffer, "Result: new golden trace (%s.CRC)\n", Name);
+			} else {
+				sprintf(buffer, "Result: match (%s.CRC)\n", Name);
+			}
+			break;
+
+		case RESULT_MISMATCH:
+			if (Mismatch < 0 && PacketMismatch >= 0) {
+				sprintf(buffer, "Result: varint packet mismatch at frame %ld\n", PacketMismatch);
+			} else if (Mismatch < 0) {
+				sprintf(buffer, "Result: mismatch after seeking\n");
+			} else if (Mismatch < Trace.Count() && Mismatch < Golden.Count()) {
+				sprintf(buffer, "Result: mismatch at frame %d (golden %08lX, now %08lX)\n", Mismatch, Golden[Mismatch], Trace[Mismatch]);
+			} else {
+				sprintf(buffer, "Result: mismatch at frame %d (golden %d frames, now %d frames)\n", Mismatch, Golden.Count(), Trace.Count());
+			}
+			break;
+
+		default:
+			if (!IsGolden && !HasGolden) {
+				sprintf(buffer, "Result: error, no golden trace (%s.CRC); -GOLDEN makes one\n", Name);
+			} else {
+				sprintf(buffer, "Result: error\n");
+			}
+			break;
+	}
+	total += pipe.Put(buffer, strlen(buffer));
+
+	if (SeekFrame >= 0) {
+		if (SeekFrom < 0) {
+			sprintf(buffer, "Seek check: frame %ld not reached (it needs a minute after it)\n", SeekFrame);
+		} else if (SeekMismatch < 0) {
+			sprintf(buffer, "Seek check: back to frame %ld from frame %ld, match\n", SeekFrame, SeekFrom);
+		} else {
+			sprintf(buffer, "Seek check: back to frame %ld from frame %ld, mismatch at frame %d\n", SeekFrame, SeekFrom, SeekMismatch);
+		}
+		total += pipe.Put(buffer, strlen(buffer));
+	}
+
+	sprintf(buffer, "Wall time: %.3f s (%.3f ms per frame)\n\n", elapsed, elapsed * 1000.0 / frames);
+	total += pipe.Put(buffer, strlen(buffer));
+
+	/*
+	**	The bytes per frame that the events would take in each packet format, and the time it
+	**	took to encode and decode the varint ones.
+	*/
+	sprintf(buffer, "Packets: %ld events\n", PacketEvents);
+	total += pipe.Put(buffer, strlen(buffer));
+	sprintf(buffer, "%-16s %12s %12s\n", "Format", "Bytes", "Bytes/frame");
+	total += pipe.Put(buffer, strlen(buffer));
+	sprintf(buffer, "%-16s %12ld %12.2f\n", "Uncompressed", PlainBytes, (double)PlainBytes / frames);
+	total += pipe.Put(buffer, strlen(buffer));
+	sprintf(buffer, "%-16s %12ld %12.2f\n", "Compressed", CompressedBytes, (double)CompressedBytes / frames);
+	total += pipe.Put(buffer, strlen(buffer));
+	sprintf(buffer, "%-16s %12ld %12.2f\n", "Varint", VarintBytes, (double)VarintBytes / frames);
+	total += pipe.Put(buffer, strlen(buffer));
+	if (PacketEvents > 0) {
+		sprintf(buffer, "Varint encode: %.1f ns per event, decode: %.1f ns per event\n\n", EncodeTime * 1e9 / PacketEvents, DecodeTime * 1e9 / PacketEvents);
+	} else {
+		sprintf(buffer, "\n");
+	}
+	total += pipe.Put(buffer, strlen(buffer));
+
+	sprintf(buffer, "%-16s %10s %12s %12s\n", "Scope", "Calls", "Total ms", "ms/frame");
+	total += pipe.Put(buffer, strlen(buffer));
+	for (int bench = BENCH_FIRST; bench < BENCH_COUNT; bench++) {
+		double ms = Profiler.Total_Time((BenchType)bench) / 1000000.0;
+		sprintf(buffer, "%-16s %10lu %12.3f %12.4f\n", ProfilerClass::Name((BenchType)bench), Profiler.Total_Calls((BenchType)bench), ms, ms / frames);
+		total += pipe.Put(buffer, strlen(buffer));
+	}
+
+	total += pipe.End();
+	file.Close();
+
+	return(total > 0);
+}
@@ -0,0 +1,146 @@
+/*
+**	Command & Conquer Red Alert(tm)
+**	Copyright 2025 Electronic Arts Inc.
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/***********************************************************************************************
+ *                                                                                             *
+ *                 Project Name : Command & Conquer                                            *
+ *                                                                                             *
+ *                    File Name : REGRESS.H                                                    *
+ *                                                                                             *
+ *                   Start Date : 10/19/26                                                     *
+ *                                                                                             *
+ *                  Last Update : October 19, 2026                                             *
+ *                                                                                             *
+ *---------------------------------------------------------------------------------------------*
+ * Functions:                                                                                  *
+ * - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+#ifndef REGRESS_H
+#define REGRESS_H
+
+
+/*
+**	This runs a recorded game as a regression benchmark. The recording is played back as fast
+**	as possible with nothing drawn, and the game CRC of every frame is kept as a trace. The
+**	new trace is checked against the recording's golden trace frame by frame; a recording
+**	with no golden trace fails. A run made with IsGolden set instead makes its trace the
+**	golden one, in place of any that was there. When the playback ends, a report
+**	of the result and of the time spent in each benchmark scope is written out and the game
+**	exits, returning a code that says whether the trace matched.
+**
+**	The events played back are also sized in each of the packet formats that the multiplayer
+**	game can send them in, and the varint packets are timed and decoded again to check them.
+**
+**	A run can also check that seeking plays the game out the same way. Once the playback has
+**	gone a minute past the frame to check, it seeks back to it. The frames played again must
+**	have the same CRCs as the first time through.
+**
+**	For a recording named "NAME", the files are:
+**		NAME.BIN		The recorded game (made with the -X command line option).
+**		NAME.CRC		The golden trace.
+**		NAME.OUT		The trace of this run, when a golden trace was checked.
+**		NAME.TXT		The report.
+*/
+class RegressionClass
+{
+	public:
+		RegressionClass(void);
+
+		bool Start(char const * name);
+		void AI(void);
+		void Frame(unsigned long crc);
+		void Packets(int events, long plain, long compressed, long varint, double encode, double decode, bool match);
+		int Finish(void);
+
+		/*
+		**	Is a recording being run as a regression benchmark?
+		*/
+		bool IsActive;
+
+		/*
+		**	The frame to check seeking back to, or -1 if seeking isn't checked.
+		*/
+		long SeekFrame;
+
+		/*
+		**	Should the trace of this run become the golden trace, rather than be checked
+		**	against it?
+		*/
+		bool IsGolden;
+
+		/*
+		**	These are the codes that the game exits with at the end of the run.
+		*/
+		typedef enum ResultEnum {
+			RESULT_MATCH,				// The trace matched the golden trace, or became it.
+			RESULT_MISMATCH,			// The trace differed from the golden trace.
+			RESULT_ERROR				// The recording or a trace was missing, or couldn't be read or written.
+		} ResultType;
+
+	private:
+		bool Load_Golden(char const * filename);
+		bool Write_Trace(char const * filename) const;
+		bool Write_Report(char const * filename, ResultType result) const;
+
+		/*
+		**	The recording name that the file names are built from.
+		*/
+		char Name[_MAX_PATH];
+
+		/*
+		**	The game CRC of each frame played back, and of each frame of the golden trace.
+		*/
+		DynamicVectorClass<unsigned long> Trace;
+		DynamicVectorClass<unsigned long> Golden;
+		bool HasGolden;
+
+		/*
+		**	The first frame whose CRC differed from the golden trace, or -1 if none has.
+		*/
+		int Mismatch;
+
+		/*
+		**	The frame the seek check was made from, or -1 if it hasn't been made yet, and the
+		**	first frame played again with a different CRC, or -1 if none has.
+		*/
+		long SeekFrom;
+		int SeekMismatch;
+
+		/*
+		**	The events played back, the bytes that the packets carrying them would take in each
+		**	format, and the seconds spent encoding and decoding the varint ones. The last frame
+		**	measured keeps frames played again after a seek from being counted twice, and the
+		**	first frame whose varint packet did not decode to the same events is noted, or -1.
+		*/
+		long PacketEvents;
+		long PlainBytes;
+		long CompressedBytes;
+		long VarintBytes;
+		double EncodeTime;
+		double DecodeTime;
+		long PacketFrame;
+		long PacketMismatch;
+
+		/*
+		**	Time the playback started at, in seconds.
+		*/
+		double StartTime;
+};
+
+
+#endif
@@ -0,0 +1,373 @@
+/*
+**	Command & Conquer Red Alert(tm)
+**	Copyright 2025 Electronic Arts Inc.
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/***********************************************************************************************
+ *                                                                                             *
+ *                 Project Name : Command & Conquer                                            *
+ *                                                                                             *
+ *                    File Name : REPLAY.CPP                                                   *
+ *                                                                                             *
+ *                   Start Date : 10/19/26                                                     *
+ *                                                                                             *
+ *                  Last Update : October 19, 2026                                             *
+ *                                                                                             *
+ *---------------------------------------------------------------------------------------------*
+ * Functions:                                                                                  *
+ *   ReplayClass::AI -- Takes a snapshot of the playback when one is due.                      *
+ *   ReplayClass::Clear -- Discards every snapshot.                                            *
+ *   ReplayClass::Is_Seeking -- Checks if the playback is being run ahead to a frame.          *
+ *   ReplayClass::Key -- Handles the keys that move the playback.                              *
+ *   ReplayClass::ReplayClass -- Constructor for the replay seeker.                            *
+ *   ReplayClass::Restore -- Puts the playback back to a snapshot.                             *
+ *   ReplayClass::Seek -- Moves the playback to the frame specified.                           *
+ *   ReplayClass::Take -- Takes a snapshot of the playback as it is now.                       *
+ *   ReplayClass::Thin -- Discards every other snapshot to make room for more.                 *
+ *   ReplayClass::~ReplayClass -- Destructor for the replay seeker.                            *
+ * - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+#include	"function.h"
+
+
+/***********************************************************************************************
+ * ReplayClass::ReplayClass -- Constructor for the replay seeker.                              *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+ReplayClass::ReplayClass(void) :
+	Count(0),
+	Interval(SNAPSHOT_INTERVAL),
+	Target(0),
+	Request(0),
+	IsRequested(false)
+{
+}
+
+
+/***********************************************************************************************
+ * ReplayClass::~ReplayClass -- Destructor for the replay seeker.                              *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+ReplayClass::~ReplayClass(void)
+{
+	Clear();
+}
+
+
+/***********************************************************************************************
+ * ReplayClass::Clear -- Discards every snapshot.                                              *
+ *                                                                                             *
+ *    This is called when the playback ends, so that the next playback starts afresh.          *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+void ReplayClass::Clear(void)
+{
+	for (int index = 0; index < Count; index++) {
+		delete [] Snapshots[index].Image;
+		Snapshots[index].Image = NULL;
+	}
+	Count = 0;
+	Interval = SNAPSHOT_INTERVAL;
+	Target = 0;
+	IsRequested = false;
+}
+
+
+/***********************************************************************************************
+ * ReplayClass::Is_Seeking -- Checks if the playback is being run ahead to a frame.            *
+ *                                                                                             *
+ *    While this is true, the game loop runs as fast as it can and draws nothing.              *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  bool; Has the playback yet to reach the frame that was asked for?                  *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+bool ReplayClass::Is_Seeking(void) const
+{
+	return(::Frame < Target);
+}
+
+
+/***********************************************************************************************
+ * ReplayClass::AI -- Takes a snapshot of the playback when one is due.                        *
+ *                                                                                             *
+ *    This is called each frame of the playback, just before the recorded events for the       *
+ *    frame are read. A seek that a key asked for is done first. A snapshot is then taken once *
+ *    the playback has gone past the last snapshot by the snapshot interval. Frames that are   *
+ *    played again after seeking back already have their snapshots.                            *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *   10/19/2026 AGT : Does the seek asked for by a key.                                        *
+ *=============================================================================================*/
+void ReplayClass::AI(void)
+{
+	if (IsRequested) {
+		IsRequested = false;
+		Seek(Request);
+	}
+
+	if (Count == 0 || ::Frame >= Snapshots[Count-1].Frame + Interval) {
+		if (Count == SNAPSHOT_MAX) {
+			Thin();
+		}
+		Take();
+	}
+}
+
+
+/***********************************************************************************************
+ * ReplayClass::Key -- Handles the keys that move the playback.                                *
+ *                                                                                             *
+ *    Page up and page down move the playback back and ahead a minute; home moves it back to   *
+ *    the start. The seek is only noted here and is done by the next call to AI, so this can   *
+ *    be called from wherever the keys are read. Moves asked for before then add up.           *
+ *                                                                                             *
+ * INPUT:   key   -- The key that was pressed.                                                 *
+ *                                                                                             *
+ * OUTPUT:  bool; Was the key one that moves the playback?                                     *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+bool ReplayClass::Key(KeyNumType key)
+{
+	long from = IsRequested ? Request : max(::Frame, Target);
+
+	switch (KeyNumType(key & ~WWKEY_VK_BIT)) {
+		case KN_PGUP:
+			Request = max(from - TICKS_PER_MINUTE, 0L);
+			break;
+
+		case KN_PGDN:
+			Request = from + TICKS_PER_MINUTE;
+			break;
+
+		case KN_HOME:
+			Request = 0;
+			break;
+
+		default:
+			return(false);
+	}
+	IsRequested = true;
+	return(true);
+}
+
+
+/***********************************************************************************************
+ * ReplayClass::Seek -- Moves the playback to the frame specified.                             *
+ *                                                                                             *
+ *    The playback is put back to the last snapshot at or before the frame, unless it is       *
+ *    already closer to the frame than that snapshot is, and is then run ahead until it gets   *
+ *    there.                                                                                   *
+ *                                                                                             *
+ * INPUT:   frame -- The frame to move the playback to.                                        *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   Only call this from Queue_Playback, before the events for the frame are read.   *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *   10/19/2026 AGT : Drops a snapshot that fails to restore.                                  *
+ *=============================================================================================*/
+void ReplayClass::Seek(long frame)
+{
+	frame = max(frame, 0L);
+
+	int best = -1;
+	for (int index = 0; index < Count; index++) {
+		if (Snapshots[index].Frame <= frame) {
+			best = index;
+		}
+	}
+
+	if (best != -1 && (frame < ::Frame || Snapshots[best].Frame > ::Frame)) {
+		if (!Restore(Snapshots[best])) {
+
+			/*
+			**	A snapshot that can't be read back will never be any better, so it is
+			**	thrown away and the playback stays where the failed restore left it.
+			*/
+			delete [] Snapshots[best].Image;
+			for (int index = best; index < Count-1; index++) {
+				Snapshots[index] = Snapshots[index+1];
+			}
+			Snapshots[--Count].Image = NULL;
+			Target = ::Frame;
+			return;
+		}
+	}
+	Target = frame;
+}
+
+
+/***********************************************************************************************
+ * ReplayClass::Take -- Takes a snapshot of the playback as it is now.                         *
+ *                                                                                             *
+ *    The snapshot holds the game state, the events already read from the recording that are   *
+ *    waiting to be executed, and the place reached in the recording. It is compressed, since  *
+ *    most of the game state is empty map cells and unused objects.                            *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   There must be room for another snapshot.                                        *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+void ReplayClass::Take(void)
+{
+	Buffer.Reset();
+
+	{
+		LZOPipe pipe(LZOPipe::COMPRESS, SNAPSHOT_BLOCK_SIZE);
+		pipe.Put_To(Buffer);
+
+		Save_Snapshot(pipe);
+
+		int count = DoList.Count;
+		pipe.Put(&count, sizeof(count));
+		for (int index = 0; index < count; index++) {
+			pipe.Put(&DoList[index], sizeof(EventClass));
+		}
+
+		long position = Session.RecordFile.Seek(0, SEEK_CUR);
+		pipe.Put(&position, sizeof(position));
+
+		pipe.Flush();
+		pipe.End();
+	}
+
+	char * image = new char [Buffer.Get_Length()];
+	if (image == NULL) return;
+	memcpy(image, Buffer.Get_Buffer(), Buffer.Get_Length());
+
+	SnapshotType & snapshot = Snapshots[Count++];
+	snapshot.Frame = ::Frame;
+	snapshot.Image = image;
+	snapshot.Size = Buffer.Get_Length();
+}
+
+
+/***********************************************************************************************
+ * ReplayClass::Restore -- Puts the playback back to a snapshot.                               *
+ *                                                                                             *
+ * INPUT:   snapshot -- The snapshot to put the playback back to.                              *
+ *                                                                                             *
+ * OUTPUT:  bool; Was the whole snapshot read?                                                 *
+ *                                                                                             *
+ * WARNINGS:   If this routine returns false, the game is in an unknown state.                 *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *   10/19/2026 AGT : Fails if the snapshot is short.                                          *
+ *=============================================================================================*/
+bool ReplayClass::Restore(SnapshotType const & snapshot)
+{
+	BufferStraw bstraw(snapshot.Image, snapshot.Size);
+	LZOStraw straw(LZOStraw::DECOMPRESS, SNAPSHOT_BLOCK_SIZE);
+	straw.Get_From(bstraw);
+
+	if (!Load_Snapshot(straw)) return(false);
+
+	DoList.Init();
+	int count = 0;
+	if (straw.Get(&count, sizeof(count)) != sizeof(count)) return(false);
+	for (int index = 0; index < count; index++) {
+		EventClass event;
+		if (straw.Get(&event, sizeof(event)) != sizeof(event)) return(false);
+		DoList.Add(event);
+	}
+
+	long position = 0;
+	if (straw.Get(&position, sizeof(position)) != sizeof(position)) return(false);
+	Session.RecordFile.Seek(position, SEEK_SET);
+	return(true);
+}
+
+
+/***********************************************************************************************
+ * ReplayClass::Thin -- Discards every other snapshot to make room for more.                   *
+ *                                                                                             *
+ *    The first snapshot is always kept, so the playback can still go back to the start. The   *
+ *    snapshots that are left are twice as far apart, so the interval is doubled to match.     *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+void ReplayClass::Thin(void)
+{
+	int kept = 0;
+	for (int index = 0; index < Count; index++) {
+		if ((index & 1) == 0) {
+			Snapshots[kept++] = Snapshots[index];
+		} else {
+			delete [] Snapshots[index].Image;
+		}
+	}
+	for (int index = kept; index < Count; index++) {
+		Snapshots[index].Image = NULL;
+	}
+	Count = kept;
+	Interval *= 2;
+}
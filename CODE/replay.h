@@ -0,0 +1,108 @@
+/*
+**	Command & Conquer Red Alert(tm)
+**	Copyright 2025 Electronic Arts Inc.
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/***********************************************************************************************
+ *                                                                                             *
+ *                 Project Name : Command & Conquer                                            *
+ *                                                                                             *
+ *                    File Name : REPLAY.H                                                     *
+ *                                                                                             *
+ *                   Start Date : 10/19/26                                                     *
+ *                                                                                             *
+ *                  Last Update : October 19, 2026                                             *
+ *                                                                                             *
+ *---------------------------------------------------------------------------------------------*
+ * Functions:                                                                                  *
+ * - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+#ifndef REPLAY_H
+#define REPLAY_H
+
+
+/*
+**	This lets the playback of a recorded game jump to any frame. While the recording plays,
+**	a compressed snapshot of the game state is kept in memory every so often, along with the
+**	events waiting to be executed and the place reached in the recording. To reach a frame,
+**	the game is put back to the nearest snapshot at or before it and then played forward as
+**	fast as possible, with nothing drawn, until the frame is reached. The number of snapshots
+**	is limited; when the limit is reached every other one is discarded and they are then kept
+**	half as often.
+*/
+class ReplayClass
+{
+	public:
+		ReplayClass(void);
+		~ReplayClass(void);
+
+		void AI(void);
+		bool Key(KeyNumType key);
+		void Seek(long frame);
+		void Clear(void);
+		bool Is_Seeking(void) const;
+
+	private:
+		enum ReplayEnums {
+			SNAPSHOT_MAX=32,									// Most snapshots held.
+			SNAPSHOT_INTERVAL=TICKS_PER_MINUTE,			// Frames between snapshots at first.
+			SNAPSHOT_BLOCK_SIZE=1024*8						// Compression block size.
+		};
+
+		/*
+		**	One snapshot of the game state.
+		*/
+		struct SnapshotType {
+			long Frame;					// Frame the snapshot was taken at.
+			char * Image;				// Compressed snapshot data.
+			int Size;					// Bytes of compressed data.
+		};
+
+		void Take(void);
+		bool Restore(SnapshotType const & snapshot);
+		void Thin(void);
+
+		SnapshotType Snapshots[SNAPSHOT_MAX];
+		int Count;
+
+		/*
+		**	Frames between snapshots, which doubles each time the snapshots are thinned out.
+		*/
+		long Interval;
+
+		/*
+		**	The frame that the playback is being run ahead to.
+		*/
+		long Target;
+
+		/*
+		**	The frame that a key asked to seek to, which is done at the start of the next
+		**	frame played back.
+		*/
+		long Request;
+		bool IsRequested;
+
+		/*
+		**	Buffer the snapshot is compressed into before it is copied to its own memory.
+		*/
+		DynamicBufferPipe Buffer;
+
+		ReplayClass(ReplayClass const & rvalue);
+		ReplayClass & operator = (ReplayClass const & rvalue);
+};
+
+
+#endif
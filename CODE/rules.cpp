@@ -35,6 +35,7 @@
  * Functions:                                                                                  *
  *   Difficulty_Get -- Fetch the difficulty bias values.                                       *
  *   RulesClass::AI -- Processes the AI control constants from the database.                   *
+ *   RulesClass::Base_Rules -- Processes the rules control files and compiles the rules image. *
  *   RulesClass::General -- Process the general main game rules.                               *
  *   RulesClass::Heap_Maximums -- Fetch and process the heap override values.                  *
  *   RulesClass::IQ -- Fetches the IQ control values from the INI database.                    *
@@ -43,7 +44,9 @@
  *   RulesClass::Powerups -- Process the powerup values from the database.                     *
  *   RulesClass::Process -- Fetch the bulk of the rule data from the control file.             *
  *   RulesClass::Recharge -- Process the super weapon recharge statistics.                     *
+ *   RulesClass::Restore_Base_Rules -- Restores the rules from the rules image.                *
  *   RulesClass::RulesClass -- Default constructor for rules class object.                     *
+ *   RulesClass::Save_Image -- Compiles the current rules into the rules image.                *
  *   RulesClass::Themes -- Fetches the theme control values from the INI database.             *
  *   Techno_Get -- Get rule data common for all techno type objects.                           *
  *   _Scale_To_256 -- Scales a 1..100 number into a 1..255 number.                             *
@@ -256,6 +259,7 @@ RulesClass::RulesClass(void) :
 	WeaponMax(20),
 	WarheadMax(20),
 	TrigTypeMax(80),
+	IsHeapGrowable(false),
 	CloseEnoughDistance(0x0280),
 	StrayDistance(0x0200),
 	CrushDistance(0x0180),
@@ -629,6 +633,7 @@ bool RulesClass::Heap_Maximums(CCINIClass & ini)
 		WeaponMax = ini.Get_Int(MAXIMUMS, "Weapon", WeaponMax);
 		WarheadMax = ini.Get_Int(MAXIMUMS, "Warhead", WarheadMax);
 		TrigTypeMax = ini.Get_Int(MAXIMUMS, "TrigType", TrigTypeMax);
+		IsHeapGrowable = ini.Get_Bool(MAXIMUMS, "Growable", IsHeapGrowable);
 	}
 
 	/*
@@ -1047,3 +1052,387 @@ bool RulesClass::Difficulty(CCINIClass & ini)
 	Difficulty_Get(ini, Diff[DIFF_HARD], "Difficult");
 	return(true);
 }
+
+
+/*
+**	This is the compiled image of the rules as they stand once RULES.INI and AFTRMATH.INI
+**	have been processed at scenario start. It is only valid for the rules databases it was
+**	made from, and for the life of the program, since the type objects it holds refer to
+**	each other (and to their art) by pointer. The rules object and the type objects are kept
+**	as copies; the other values are plain data and are kept in a buffer.
+*/
+#define	RULES_IMAGE_VERSION	2
+
+typedef struct {
+	long Version;
+	long RulesID;
+	long AftermathID;
+	int Counts[10];
+} RulesImageHeader;
+
+static DynamicBufferPipe RulesImage;
+static bool IsRulesImageValid = false;
+
+
+/*
+**	Copies of every object in a type heap. A copy is made by copy construction and put back
+**	by assignment, so only the data members are copied and the objects keep their own
+**	virtual function tables.
+*/
+template<class T>
+class TypeImageClass
+{
+	public:
+		TypeImageClass(void) : Copies(NULL), Count(0) {}
+		~TypeImageClass(void) {Clear();}
+
+		T const & operator [] (int index) const {return(Copies[index]);}
+
+		void Save(TFixedIHeapClass<T> & heap) {
+			Clear();
+			Copies = (T *)::operator new(heap.Count() * sizeof(T));
+			for (; Count < heap.Count(); Count++) {
+				new(&Copies[Count]) T(*heap.Ptr(Count));
+			}
+		}
+
+		void Clear(void) {
+			for (int index = 0; index < Count; index++) {
+				Copies[index].~T();
+			}
+			::operator delete(Copies);
+			Copies = NULL;
+			Count = 0;
+		}
+
+	private:
+		T * Copies;
+		int Count;
+
+		TypeImageClass(TypeImageClass const & rvalue);
+		TypeImageClass & operator = (TypeImageClass const & rvalue);
+};
+
+static RulesClass RulesCopy;
+static TypeImageClass<WarheadTypeClass> WarheadImage;
+static TypeImageClass<BulletTypeClass> BulletImage;
+static TypeImageClass<WeaponTypeClass> WeaponImage;
+static TypeImageClass<UnitTypeClass> UnitImage;
+static TypeImageClass<InfantryTypeClass> InfantryImage;
+static TypeImageClass<VesselTypeClass> VesselImage;
+static TypeImageClass<AircraftTypeClass> AircraftImage;
+static TypeImageClass<BuildingTypeClass> BuildingImage;
+static TypeImageClass<HouseTypeClass> HouseImage;
+
+
+/*
+**	Fills in the header that identifies the rules databases and type object counts that an
+**	image is made from.
+*/
+static void Rules_Image_Header(RulesImageHeader & header)
+{
+	memset(&header, 0, sizeof(header));
+	header.Version = RULES_IMAGE_VERSION;
+	header.RulesID = RuleINI.Get_Unique_ID();
+#ifdef FIXIT_CSII	//	checked - ajw 9/28/98
+	header.AftermathID = AftermathINI.Get_Unique_ID();
+#endif
+	header.Counts[0] = Warheads.Count();
+	header.Counts[1] = BulletTypes.Count();
+	header.Counts[2] = Weapons.Count();
+	header.Counts[3] = UnitTypes.Count();
+	header.Counts[4] = InfantryTypes.Count();
+	header.Counts[5] = VesselTypes.Count();
+	header.Counts[6] = AircraftTypes.Count();
+	header.Counts[7] = BuildingTypes.Count();
+	header.Counts[8] = HouseTypes.Count();
+	header.Counts[9] = sizeof(RulesClass);
+}
+
+
+template<class T>
+static void Load_Types(TypeImageClass<T> const & copies, TFixedIHeapClass<T> & heap)
+{
+	for (int index = 0; index < heap.Count(); index++) {
+		*heap.Ptr(index) = copies[index];
+	}
+}
+
+
+/*
+**	Object types hold art that is loaded for them apart from the rules (some of it per
+**	theater). That art is kept as it is when the type is restored from the image.
+*/
+template<class T>
+static void Load_Object_Types(TypeImageClass<T> const & copies, TFixedIHeapClass<T> & heap)
+{
+	for (int index = 0; index < heap.Count(); index++) {
+		T * ptr = heap.Ptr(index);
+		void const * image = ptr->ImageData;
+		Rect * dimensions = ptr->DimensionData;
+		void const * radar = ptr->RadarIcon;
+		void const * cameo = ptr->CameoData;
+
+		*ptr = copies[index];
+
+		ptr->ImageData = image;
+		ptr->DimensionData = dimensions;
+		ptr->RadarIcon = radar;
+		ptr->CameoData = cameo;
+	}
+}
+
+
+/***********************************************************************************************
+ * RulesClass::Base_Rules -- Processes the rules control files and compiles the rules image.   *
+ *                                                                                             *
+ *    This is called at the start of a scenario when the rules could not be restored from the  *
+ *    rules image, before the scenario's own rule overrides are processed. RULES.INI and       *
+ *    AFTRMATH.INI are processed as text and the result is compiled into an image, so that     *
+ *    later scenarios can restore it with Restore_Base_Rules.                                  *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *   10/19/2026 AGT : Restoring the image was split out into Restore_Base_Rules.               *
+ *=============================================================================================*/
+void RulesClass::Base_Rules(void)
+{
+	General(RuleINI);
+	Recharge(RuleINI);
+	AI(RuleINI);
+	Powerups(RuleINI);
+	Land_Types(RuleINI);
+	Themes(RuleINI);
+	IQ(RuleINI);
+	Objects(RuleINI);
+	Difficulty(RuleINI);
+#ifdef FIXIT_CSII	//	checked - ajw 9/28/98
+	General(AftermathINI);
+	Recharge(AftermathINI);
+	AI(AftermathINI);
+	Powerups(AftermathINI);
+	Land_Types(AftermathINI);
+	Themes(AftermathINI);
+	IQ(AftermathINI);
+	Objects(AftermathINI);
+	Difficulty(AftermathINI);
+#endif
+
+	Save_Image();
+}
+
+
+/***********************************************************************************************
+ * RulesClass::Save_Image -- Compiles the current rules into the rules image.                  *
+ *                                                                                             *
+ *    This records every value that the rules processing routines (other than the startup      *
+ *    only MPlayer and Heap_Maximums) can change.                                              *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *   10/19/2026 AGT : Copies the rules and type objects rather than their bytes.               *
+ *=============================================================================================*/
+void RulesClass::Save_Image(void)
+{
+	RulesImageHeader header;
+	Rules_Image_Header(header);
+
+	RulesImage.Reset();
+	RulesImage.Put(&header, sizeof(header));
+	RulesCopy = *this;
+
+#ifdef FIXIT_CSII	//	checked - ajw 9/28/98
+	RulesImage.Put(&NewUnitsEnabled, sizeof(NewUnitsEnabled));
+	RulesImage.Put(&MTankDistance, sizeof(MTankDistance));
+	RulesImage.Put(&QuakeUnitDamage, sizeof(QuakeUnitDamage));
+	RulesImage.Put(&QuakeBuildingDamage, sizeof(QuakeBuildingDamage));
+	RulesImage.Put(&QuakeInfantryDamage, sizeof(QuakeInfantryDamage));
+	RulesImage.Put(&QuakeDelay, sizeof(QuakeDelay));
+	RulesImage.Put(&ChronoTankDuration, sizeof(ChronoTankDuration));
+#ifdef FIXIT_CARRIER	//	checked - ajw 9/28/98
+	RulesImage.Put(&CarrierLaunchDelay, sizeof(CarrierLaunchDelay));
+#endif
+#ifdef FIXIT_ENGINEER	//	checked - ajw 9/28/98
+	RulesImage.Put(&EngineerDamage, sizeof(EngineerDamage));
+	RulesImage.Put(&EngineerCaptureLevel, sizeof(EngineerCaptureLevel));
+#endif
+#endif
+
+	RulesImage.Put(CrateShares, sizeof(CrateShares));
+	RulesImage.Put(CrateAnims, sizeof(CrateAnims));
+	RulesImage.Put(CrateData, sizeof(CrateData));
+	RulesImage.Put(Ground, sizeof(Ground));
+	Theme.Save_Theme_Data(RulesImage);
+
+	WarheadImage.Save(Warheads);
+	BulletImage.Save(BulletTypes);
+	WeaponImage.Save(Weapons);
+	UnitImage.Save(UnitTypes);
+	InfantryImage.Save(InfantryTypes);
+	VesselImage.Save(VesselTypes);
+	AircraftImage.Save(AircraftTypes);
+	BuildingImage.Save(BuildingTypes);
+	HouseImage.Save(HouseTypes);
+	RulesImage.Put(MissionControl, sizeof(MissionControl));
+
+#ifdef FIXIT_NAME_OVERRIDE
+	/*
+	**	The name overrides are recorded as id and string pairs, ending with a zero id.
+	*/
+	for (int index = 0; index < ARRAY_SIZE(NameOverride); index++) {
+		if (NameIDOverride[index] != 0 && NameOverride[index] != NULL) {
+			int length = strlen(NameOverride[index]);
+			RulesImage.Put(&NameIDOverride[index], sizeof(NameIDOverride[index]));
+			RulesImage.Put(&length, sizeof(length));
+			RulesImage.Put(NameOverride[index], length);
+		}
+	}
+	int end = 0;
+	RulesImage.Put(&end, sizeof(end));
+#endif
+
+	IsRulesImageValid = true;
+}
+
+
+/***********************************************************************************************
+ * RulesClass::Restore_Base_Rules -- Restores the rules from the rules image.                  *
+ *                                                                                             *
+ *    This puts the rules back as RULES.INI and AFTRMATH.INI left them, without processing     *
+ *    them again. Every value they can change is restored, so a value that an earlier          *
+ *    scenario overrode goes back to its base setting, even if RULES.INI does not give it.     *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  bool; Was the image restored? If not, call Base_Rules to process the rules as      *
+ *                text.                                                                        *
+ *                                                                                             *
+ * WARNINGS:   The image is not used if the rules databases or the type objects have changed   *
+ *             since it was made.                                                              *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *   10/19/2026 AGT : Copies data members only; now called by Read_Scenario_INI.               *
+ *=============================================================================================*/
+bool RulesClass::Restore_Base_Rules(void)
+{
+	if (!IsRulesImageValid) return(false);
+
+	RulesImageHeader header;
+	RulesImageHeader current;
+	Rules_Image_Header(current);
+
+	BufferStraw straw(RulesImage.Get_Buffer(), RulesImage.Get_Length());
+	if (straw.Get(&header, sizeof(header)) != sizeof(header) || memcmp(&header, &current, sizeof(header)) != 0) {
+		return(false);
+	}
+
+	*this = RulesCopy;
+
+#ifdef FIXIT_CSII	//	checked - ajw 9/28/98
+	straw.Get(&NewUnitsEnabled, sizeof(NewUnitsEnabled));
+	straw.Get(&MTankDistance, sizeof(MTankDistance));
+	straw.Get(&QuakeUnitDamage, sizeof(QuakeUnitDamage));
+	straw.Get(&QuakeBuildingDamage, sizeof(QuakeBuildingDamage));
+	straw.Get(&QuakeInfantryDamage, sizeof(QuakeInfantryDamage));
+	straw.Get(&QuakeDelay, sizeof(QuakeDelay));
+	straw.Get(&ChronoTankDuration, sizeof(ChronoTankDuration));
+#ifdef FIXIT_CARRIER	//	checked - ajw 9/28/98
+	straw.Get(&CarrierLaunchDelay, sizeof(CarrierLaunchDelay));
+#endif
+#ifdef FIXIT_ENGINEER	//	checked - ajw 9/28/98
+	straw.Get(&EngineerDamage, sizeof(EngineerDamage));
+	straw.Get(&EngineerCaptureLevel, sizeof(EngineerCaptureLevel));
+#endif
+#endif
+
+	straw.Get(CrateShares, sizeof(CrateShares));
+	straw.Get(CrateAnims, sizeof(CrateAnims));
+	straw.Get(CrateData, sizeof(CrateData));
+	straw.Get(Ground, sizeof(Ground));
+	Theme.Load_Theme_Data(straw);
+
+	Load_Types(WarheadImage, Warheads);
+	Load_Types(BulletImage, BulletTypes);
+	Load_Types(WeaponImage, Weapons);
+	Load_Object_Types(UnitImage, UnitTypes);
+	Load_Object_Types(InfantryImage, InfantryTypes);
+	Load_Object_Types(VesselImage, VesselTypes);
+	Load_Object_Types(AircraftImage, AircraftTypes);
+
+	/*
+	**	Building types also have their own buildup art to keep.
+	*/
+	for (int index = 0; index < BuildingTypes.Count(); index++) {
+		BuildingTypeClass * ptr = BuildingTypes.Ptr(index);
+		void const * image = ptr->ImageData;
+		Rect * dimensions = ptr->DimensionData;
+		void const * radar = ptr->RadarIcon;
+		void const * cameo = ptr->CameoData;
+		void const * buildup = ptr->BuildupData;
+
+		*ptr = BuildingImage[index];
+
+		ptr->ImageData = image;
+		ptr->DimensionData = dimensions;
+		ptr->RadarIcon = radar;
+		ptr->CameoData = cameo;
+		ptr->BuildupData = buildup;
+	}
+
+	Load_Types(HouseImage, HouseTypes);
+	straw.Get(MissionControl, sizeof(MissionControl));
+
+#ifdef FIXIT_NAME_OVERRIDE
+	/*
+	**	Put the name overrides in the free slots, as processing the rules would have.
+	*/
+	for (;;) {
+		int id = 0;
+		int length = 0;
+		char buffer[256];
+
+		straw.Get(&id, sizeof(id));
+		if (id == 0) break;
+		straw.Get(&length, sizeof(length));
+		straw.Get(buffer, length);
+		buffer[length] = '\0';
+
+		for (int index = 0; index < ARRAY_SIZE(NameOverride); index++) {
+			if (NameIDOverride[index] == 0)  {
+				NameOverride[index] = strdup(buffer);
+				NameIDOverride[index] = id;
+				break;
+			}
+		}
+	}
+#endif
+
+	/*
+	**	The chronal vortex takes its settings from the rules when the general section is
+	**	processed.
+	*/
+	if (RuleINI.Is_Present("General")
+#ifdef FIXIT_CSII	//	checked - ajw 9/28/98
+		|| AftermathINI.Is_Present("General")
+#endif
+		) {
+		ChronalVortex.Set_Range(VortexRange / CELL_LEPTON_W);
+		ChronalVortex.Set_Speed(VortexSpeed);
+		ChronalVortex.Set_Damage(VortexDamage);
+	}
+
+	return(true);
+}
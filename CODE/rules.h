@@ -77,6 +77,8 @@ class RulesClass {
 		bool IQ(CCINIClass & ini);
 		bool Objects(CCINIClass & ini);
 		bool Difficulty(CCINIClass & ini);
+		void Base_Rules(void);
+		bool Restore_Base_Rules(void);
 
 		/*
 		**	This specifies the turbo boost speed for missiles when they are fired upon
@@ -766,6 +768,13 @@ class RulesClass {
 		int WarheadMax;
 		int TrigTypeMax;
 
+		/*
+		**	If the game object heaps are allowed to grow when they fill up, then the
+		**	maximums above are only the starting size (and growth step) of each heap.
+		**	This is off unless the rules turn it on, so the limits are as they always were.
+		*/
+		unsigned IsHeapGrowable:1;
+
 		/*
 		**	Close enough distance that is used to determine if the object should
 		**	stop movement when blocked. If the distance to the desired destination
@@ -879,6 +888,9 @@ class RulesClass {
 		*/
 		LEPTON TiberiumShortScan;
 		LEPTON TiberiumLongScan;
+
+	private:
+		void Save_Image(void);
 };
 
 
@@ -35,16 +35,24 @@
  * Functions:                                                                                  *
  *   Code_All_Pointers -- Code all pointers.                                                   *
  *   Decode_All_Pointers -- Decodes all pointers.                                              *
+ *   Get_All -- Fetch all save game data from the straw.                                       *
+ *   Get_State -- Fetch the game state from the straw.                                         *
  *   Get_Savefile_Info -- gets description, scenario #, house                                  *
+ *   Load_Checkpoint -- Restores the game state from the most recent checkpoint.               *
  *   Load_Game -- loads a saved game                                                           *
  *   Load_MPlayer_Values -- Loads multiplayer-specific values                                  *
  *   Load_Misc_Values -- loads miscellaneous variables                                         *
+ *   Load_Snapshot -- Restores the game state from an in-memory snapshot.                      *
  *   MPlayer_Save_Message -- pops up a "saving..." message                                     *
  *   Put_All -- Store all save game data to the pipe.                                          *
+ *   Put_Heap -- Stores a heap of game objects, marking it for a checkpoint.                   *
  *   Reconcile_Players -- Reconciles loaded data with the 'Players' vector							  *
+ *   Save_Checkpoint -- Writes a crash recovery checkpoint of the game state.                  *
+ *   Save_Emergency_Game -- Saves a multiplayer game whose connection was lost.                *
  *   Save_Game -- saves a game to disk                                                         *
  *   Save_MPlayer_Values -- Saves multiplayer-specific values                                  *
  *   Save_Misc_Values -- saves miscellaneous variables                                         *
+ *   Save_Snapshot -- Captures the game state into an in-memory snapshot.                      *
  * - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
 
 #include	"function.h"
@@ -105,18 +113,56 @@ extern bool SpawnedFromWChat;
 
 
 static int Reconcile_Players(void);
+static void Put_All(Pipe & pipe, int save_net, CheckpointClass * checkpoint=NULL);
+static bool Get_All(Straw & straw, int load_net);
+static bool Get_State(Straw & straw, int load_net);
 extern bool Is_Mission_Counterstrike (char *file_name);
 #ifdef FIXIT_CSII	//	checked - ajw 9/28/98
 extern bool Is_Mission_Aftermath (char *file_name);
 #endif
 
+/***********************************************************************************************
+ * Put_Heap -- Stores a heap of game objects, marking it for a checkpoint.                     *
+ *                                                                                             *
+ *    The heap is saved as usual. If a checkpoint is being captured, the heap is first marked  *
+ *    as a table of objects keyed by their heap slot, so that each object is compared with     *
+ *    the object in the same slot at the previous checkpoint.                                  *
+ *                                                                                             *
+ * INPUT:   pipe        -- Reference to the pipe that will receive the save game data.         *
+ *                                                                                             *
+ *          heap        -- Reference to the heap to store.                                     *
+ *                                                                                             *
+ *          checkpoint  -- Pointer to the checkpoint being captured (NULL if none).            *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+template<class T>
+static void Put_Heap(Pipe & pipe, TFixedIHeapClass<T> const & heap, CheckpointClass * checkpoint)
+{
+	if (checkpoint != NULL) {
+		checkpoint->Mark_Table(sizeof(int), sizeof(T));
+	}
+	heap.Save(pipe);
+}
+
+
 /***********************************************************************************************
  * Put_All -- Store all save game data to the pipe.                                            *
  *                                                                                             *
  *    This is the bulk processor of the game related save game data. All the game object       *
  *    and state data is stored to the pipe specified.                                          *
  *                                                                                             *
- * INPUT:   pipe  -- Reference to the pipe that will receive the save game data.               *
+ * INPUT:   pipe        -- Reference to the pipe that will receive the save game data.         *
+ *                                                                                             *
+ *          save_net    -- Is this a multiplayer game?                                         *
+ *                                                                                             *
+ *          checkpoint  -- Pointer to the checkpoint being captured, which has the map cells   *
+ *                         and game objects marked in it (NULL if none).                       *
  *                                                                                             *
  * OUTPUT:  none                                                                               *
  *                                                                                             *
@@ -124,8 +170,9 @@ extern bool Is_Mission_Aftermath (char *file_name);
  *                                                                                             *
  * HISTORY:                                                                                    *
  *   07/08/1996 JLB : Created.                                                                 *
+ *   10/19/2026 AGT : Marks the cells and objects for a checkpoint.                            *
  *=============================================================================================*/
-static void Put_All(Pipe & pipe, int save_net)
+static void Put_All(Pipe & pipe, int save_net, CheckpointClass * checkpoint)
 {
 	/*
 	**	Save the scenario global information.
@@ -136,6 +183,9 @@ static void Put_All(Pipe & pipe, int save_net)
 	**	Save the map.  The map must be saved first, since it saves the Theater.
 	*/
 	if (!save_net) Call_Back();
+	if (checkpoint != NULL) {
+		checkpoint->Mark_Table(sizeof(CELL), sizeof(CellClass), sizeof(TheaterType) + sizeof(MouseClass));
+	}
 	Map.Save(pipe);
 
 	if (!save_net) Call_Back();
@@ -144,41 +194,41 @@ static void Put_All(Pipe & pipe, int save_net)
 	**	Save all game objects.  This code saves every object that's stored in a
 	**	TFixedIHeap class.
 	*/
-	Houses.Save(pipe);
+	Put_Heap(pipe, Houses, checkpoint);
 	if (!save_net) Call_Back();
-	TeamTypes.Save(pipe);
+	Put_Heap(pipe, TeamTypes, checkpoint);
 	if (!save_net) Call_Back();
-	Teams.Save(pipe);
+	Put_Heap(pipe, Teams, checkpoint);
 	if (!save_net) Call_Back();
-	TriggerTypes.Save(pipe);
+	Put_Heap(pipe, TriggerTypes, checkpoint);
 	if (!save_net) Call_Back();
-	Triggers.Save(pipe);
+	Put_Heap(pipe, Triggers, checkpoint);
 	if (!save_net) Call_Back();
-	Aircraft.Save(pipe);
+	Put_Heap(pipe, Aircraft, checkpoint);
 	if (!save_net) Call_Back();
-	Anims.Save(pipe);
+	Put_Heap(pipe, Anims, checkpoint);
 
 	if (!save_net) Call_Back();
 
-	Buildings.Save(pipe);
+	Put_Heap(pipe, Buildings, checkpoint);
 	if (!save_net) Call_Back();
-	Bullets.Save(pipe);
+	Put_Heap(pipe, Bullets, checkpoint);
 	if (!save_net) Call_Back();
-	Infantry.Save(pipe);
+	Put_Heap(pipe, Infantry, checkpoint);
 	if (!save_net) Call_Back();
-	Overlays.Save(pipe);
+	Put_Heap(pipe, Overlays, checkpoint);
 	if (!save_net) Call_Back();
-	Smudges.Save(pipe);
+	Put_Heap(pipe, Smudges, checkpoint);
 	if (!save_net) Call_Back();
-	Templates.Save(pipe);
+	Put_Heap(pipe, Templates, checkpoint);
 	if (!save_net) Call_Back();
-	Terrains.Save(pipe);
+	Put_Heap(pipe, Terrains, checkpoint);
 	if (!save_net) Call_Back();
-	Units.Save(pipe);
+	Put_Heap(pipe, Units, checkpoint);
 	if (!save_net) Call_Back();
-	Factories.Save(pipe);
+	Put_Heap(pipe, Factories, checkpoint);
 	if (!save_net) Call_Back();
-	Vessels.Save(pipe);
+	Put_Heap(pipe, Vessels, checkpoint);
 
 	if (!save_net) Call_Back();
 
@@ -392,7 +442,8 @@ bool Save_Game(int id, char const * descr, bool )
 	*/
 	SHAPipe sha;
 	BlowPipe bpipe(BlowPipe::ENCRYPT);
-	LZOPipe pipe(LZOPipe::COMPRESS, SAVE_BLOCK_SIZE);
+	ParallelPipe pipe(CODEC_LZO, ParallelPipe::COMPRESS, SAVE_BLOCK_SIZE);
+//	LZOPipe pipe(LZOPipe::COMPRESS, SAVE_BLOCK_SIZE);
 //	LZWPipe pipe(LZWPipe::COMPRESS, SAVE_BLOCK_SIZE);
 //	LCWPipe pipe(LCWPipe::COMPRESS, SAVE_BLOCK_SIZE);
 	bpipe.Key(&FastKey, BlowfishEngine::MAX_KEY_LENGTH);
@@ -462,7 +513,6 @@ bool Save_Game(int id, char const * descr, bool )
 bool Load_Game(int id)
 {
 	char name[_MAX_FNAME+_MAX_EXT];
-	int i;
 	unsigned scenario;
 	HousesType house;
 	char descr_buf[DESCRIP_MAX];
@@ -564,7 +614,8 @@ bool Load_Game(int id)
 	*/
 	file.Seek(pos, SEEK_SET);
 	BlowStraw bstraw(BlowStraw::DECRYPT);
-	LZOStraw straw(LZOStraw::DECOMPRESS, SAVE_BLOCK_SIZE);
+	ParallelStraw straw(CODEC_LZO, ParallelStraw::DECOMPRESS, SAVE_BLOCK_SIZE);
+//	LZOStraw straw(LZOStraw::DECOMPRESS, SAVE_BLOCK_SIZE);
 //	LZWStraw straw(LZWStraw::DECOMPRESS, SAVE_BLOCK_SIZE);
 //	LCWStraw straw(LCWStraw::DECOMPRESS, SAVE_BLOCK_SIZE);
 
@@ -572,6 +623,36 @@ bool Load_Game(int id)
 	bstraw.Get_From(fstraw);
 	straw.Get_From(bstraw);
 
+	bool ok = Get_All(straw, load_net);
+	file.Close();
+	return(ok);
+}
+
+
+/***********************************************************************************************
+ * Get_State -- Fetch the game state from the straw.                                           *
+ *                                                                                             *
+ *    This clears the current scenario and rebuilds the game objects, map and miscellaneous    *
+ *    values from the data image supplied by the straw. It is the part of loading that only    *
+ *    depends on the image itself; the fixups that depend on how it was saved are left to the  *
+ *    caller.                                                                                  *
+ *                                                                                             *
+ * INPUT:   straw    -- Reference to the straw that supplies the save game data.               *
+ *                                                                                             *
+ *          load_net -- Is this a network/modem game image?                                    *
+ *                                                                                             *
+ * OUTPUT:  bool; Was the whole image read?                                                    *
+ *                                                                                             *
+ * WARNINGS:   If this routine returns false, the game is in an unknown state.                 *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Split out of Get_All.                                                    *
+ *   10/19/2026 AGT : Fails if the image is short.                                             *
+ *=============================================================================================*/
+static bool Get_State(Straw & straw, int load_net)
+{
+	int i;
+
 	/*
 	**	Clear the scenario so we start fresh; this calls the Init_Clear() routine
 	**	for the Map, and all object arrays.  It has the following important
@@ -588,7 +669,7 @@ bool Load_Game(int id)
 	/*
 	**	Load the scenario global information.
 	*/
-	straw.Get(&Scen, sizeof(Scen));
+	if (straw.Get(&Scen, sizeof(Scen)) != sizeof(Scen)) return(false);
 
 	/*
 	**	Fixup the Sessionclass scenario info so we can work out which
@@ -644,68 +725,68 @@ bool Load_Game(int id)
 	**	what the Theater is; this must be done before any objects are created, so
 	**	they'll be properly created.
 	*/
-	Map.Load(straw);
+	if (!Map.Load(straw)) return(false);
 
 	Call_Back();
 
 	/*
 	**	Load the object data.
 	*/
-	Houses.Load(straw);
-	TeamTypes.Load(straw);
-	Teams.Load(straw);
-	TriggerTypes.Load(straw);
-	Triggers.Load(straw);
-	Aircraft.Load(straw);
-	Anims.Load(straw);
-	Buildings.Load(straw);
-	Bullets.Load(straw);
+	if (!Houses.Load(straw)) return(false);
+	if (!TeamTypes.Load(straw)) return(false);
+	if (!Teams.Load(straw)) return(false);
+	if (!TriggerTypes.Load(straw)) return(false);
+	if (!Triggers.Load(straw)) return(false);
+	if (!Aircraft.Load(straw)) return(false);
+	if (!Anims.Load(straw)) return(false);
+	if (!Buildings.Load(straw)) return(false);
+	if (!Bullets.Load(straw)) return(false);
 
 	Call_Back();
 
-	Infantry.Load(straw);
-	Overlays.Load(straw);
-	Smudges.Load(straw);
-	Templates.Load(straw);
-	Terrains.Load(straw);
-	Units.Load(straw);
-	Factories.Load(straw);
-	Vessels.Load(straw);
+	if (!Infantry.Load(straw)) return(false);
+	if (!Overlays.Load(straw)) return(false);
+	if (!Smudges.Load(straw)) return(false);
+	if (!Templates.Load(straw)) return(false);
+	if (!Terrains.Load(straw)) return(false);
+	if (!Units.Load(straw)) return(false);
+	if (!Factories.Load(straw)) return(false);
+	if (!Vessels.Load(straw)) return(false);
 
 	/*
 	**	Load the Logic & Map Layers
 	*/
-	Logic.Load(straw);
+	if (!Logic.Load(straw)) return(false);
 
 	int count;
-	straw.Get(&count, sizeof(count));
+	if (straw.Get(&count, sizeof(count)) != sizeof(count)) return(false);
 	MapTriggers.Clear();
 	for (int index = 0; index < count; index++) {
 		TARGET target;
-		straw.Get(&target, sizeof(target));
+		if (straw.Get(&target, sizeof(target)) != sizeof(target)) return(false);
 		MapTriggers.Add(As_Trigger(target));
 	}
 
-	straw.Get(&count, sizeof(count));
+	if (straw.Get(&count, sizeof(count)) != sizeof(count)) return(false);
 	LogicTriggers.Clear();
 	for (int index = 0; index < count; index++) {
 		TARGET target;
-		straw.Get(&target, sizeof(target));
+		if (straw.Get(&target, sizeof(target)) != sizeof(target)) return(false);
 		LogicTriggers.Add(As_Trigger(target));
 	}
 
 	for (HousesType h = HOUSE_FIRST; h < HOUSE_COUNT; h++) {
-		straw.Get(&count, sizeof(count));
+		if (straw.Get(&count, sizeof(count)) != sizeof(count)) return(false);
 		HouseTriggers[h].Clear();
 		for (int index = 0; index < count; index++) {
 			TARGET target;
-			straw.Get(&target, sizeof(target));
+			if (straw.Get(&target, sizeof(target)) != sizeof(target)) return(false);
 			HouseTriggers[h].Add(As_Trigger(target));
 		}
 	}
 
 	for (i = 0; i < LAYER_COUNT; i++) {
-		Map.Layer[i].Load(straw);
+		if (!Map.Layer[i].Load(straw)) return(false);
 	}
 
 	Call_Back();
@@ -713,13 +794,13 @@ bool Load_Game(int id)
 	/*
 	**	Load the Score
 	*/
-	straw.Get(&Score, sizeof(Score));
+	if (straw.Get(&Score, sizeof(Score)) != sizeof(Score)) return(false);
 	new(&Score) ScoreClass(NoInitClass());
 
 	/*
 	**	Load the AI Base
 	*/
-	Base.Load(straw);
+	if (!Base.Load(straw)) return(false);
 
 	/*
 	**	Delete any carryover pseudo-saved game list.
@@ -735,12 +816,15 @@ bool Load_Game(int id)
 	**	Load any carryover pseudo-saved game list.
 	*/
 	int carry_count = 0;
-	straw.Get(&carry_count, sizeof(carry_count));
+	if (straw.Get(&carry_count, sizeof(carry_count)) != sizeof(carry_count)) return(false);
 	while (carry_count) {
 		CarryoverClass * cptr = new CarryoverClass;
 		assert(cptr != NULL);
 
-		straw.Get(cptr, sizeof(CarryoverClass));
+		if (straw.Get(cptr, sizeof(CarryoverClass)) != sizeof(CarryoverClass)) {
+			delete cptr;
+			return(false);
+		}
 		new (cptr) CarryoverClass(NoInitClass());
 		cptr->Zap();
 
@@ -757,19 +841,44 @@ bool Load_Game(int id)
 	/*
 	**	Load miscellaneous variables, including the map size & the Theater
 	*/
-	Load_Misc_Values(straw);
+	if (!Load_Misc_Values(straw)) return(false);
 
 	/*
 	**	Load multiplayer values
 	*/
 	if (load_net) {
-		Load_MPlayer_Values(straw);
+		if (!Load_MPlayer_Values(straw)) return(false);
 	}
 
-	file.Close();
 	Decode_All_Pointers();
 	Map.Init_IO();
 	Map.Flag_To_Redraw(true);
+	return(true);
+}
+
+
+/***********************************************************************************************
+ * Get_All -- Fetch all save game data from the straw.                                         *
+ *                                                                                             *
+ *    This is the counterpart to Put_All. It clears the current scenario and then rebuilds     *
+ *    the game state from the data image supplied by the straw.                                *
+ *                                                                                             *
+ * INPUT:   straw    -- Reference to the straw that supplies the save game data.               *
+ *                                                                                             *
+ *          load_net -- Is this a network/modem game image?                                    *
+ *                                                                                             *
+ * OUTPUT:  bool; Was the game state loaded?                                                   *
+ *                                                                                             *
+ * WARNINGS:   If this routine returns false, the game is in an unknown state.                 *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Split out of Load_Game.                                                  *
+ *=============================================================================================*/
+static bool Get_All(Straw & straw, int load_net)
+{
+	if (!Get_State(straw, load_net)) {
+		return(false);
+	}
 
 	/*
 	**	Fixup any expediency data that can be inferred from the physical
@@ -984,6 +1093,216 @@ if(Special.IsFromWChat || SpawnedFromWChat) {
 }
 
 
+/***********************************************************************************************
+ * Save_Checkpoint -- Writes a crash recovery checkpoint of the game state.                    *
+ *                                                                                             *
+ *    The game state is captured into memory with the same data layout as a save game, with    *
+ *    the map cells and game objects marked in it. The checkpoint manager then writes either   *
+ *    the complete image or just the cells, objects and other data that changed since the      *
+ *    previous checkpoint.                                                                     *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  bool; Was the checkpoint written?                                                  *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *   10/19/2026 AGT : Marks the cells and objects in the image.                                *
+ *=============================================================================================*/
+bool Save_Checkpoint(void)
+{
+	int save_net = (Session.Type != GAME_NORMAL && Session.Type != GAME_SKIRMISH);
+
+	unsigned long version = SAVEGAME_VERSION;
+#ifdef FIXIT_CSII	//	checked - ajw 9/28/98
+	version++;
+#endif
+
+	Code_All_Pointers();
+	Put_All(Checkpoint.Capture(), save_net, &Checkpoint);
+	Decode_All_Pointers();
+
+	return(Checkpoint.Write(version, save_net, Frame));
+}
+
+
+/***********************************************************************************************
+ * Load_Checkpoint -- Restores the game state from the most recent checkpoint.                 *
+ *                                                                                             *
+ *    The checkpoint chain is read back (base image plus all valid deltas) and the resulting   *
+ *    image is loaded just as if it were the body of a save game file.                         *
+ *                                                                                             *
+ * INPUT:   net      -- Must the checkpoint be of a multiplayer game (or of a single player    *
+ *                      game, if false)?                                                       *
+ *                                                                                             *
+ *          maxframe -- Checkpoints taken after this game frame are not used.                  *
+ *                                                                                             *
+ * OUTPUT:  Returns with CHECKPOINT_LOADED if the game state was restored, CHECKPOINT_NONE     *
+ *          if there was no checkpoint to restore (the game is untouched), or                  *
+ *          CHECKPOINT_FAILED if the game was cleared but could not be restored.               *
+ *                                                                                             *
+ * WARNINGS:   If this routine returns CHECKPOINT_FAILED, the game is in an unknown state and  *
+ *             the scenario will have to be re-initialized.                                    *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *   10/19/2026 AGT : Checks the kind of game and limits the frame.                            *
+ *   10/19/2026 AGT : Tells a failed restore apart from there being nothing to restore.        *
+ *=============================================================================================*/
+CheckpointLoadType Load_Checkpoint(int net, long maxframe)
+{
+	unsigned long version = SAVEGAME_VERSION;
+#ifdef FIXIT_CSII	//	checked - ajw 9/28/98
+	version++;
+#endif
+
+	if (!Checkpoint.Read(version, maxframe)) {
+		return(CHECKPOINT_NONE);
+	}
+	if ((Checkpoint.Is_Net() != 0) != (net != 0)) {
+		Checkpoint.Reset();
+		return(CHECKPOINT_NONE);
+	}
+	GameVersion = version;
+
+	/*
+	**	Loading clears the scenario first (which also resets the checkpoint chain), so from
+	**	here on a failure leaves nothing of the game behind.
+	*/
+	BufferStraw straw(Checkpoint.Get_Image(), Checkpoint.Get_Size());
+	if (!Get_All(straw, Checkpoint.Is_Net())) {
+		return(CHECKPOINT_FAILED);
+	}
+	return(CHECKPOINT_LOADED);
+}
+
+
+/***********************************************************************************************
+ * Save_Emergency_Game -- Saves a multiplayer game whose connection was lost.                  *
+ *                                                                                             *
+ *    When the connection is lost, each player may be a few frames ahead of the others, so     *
+ *    saving the game as it is leaves each player with a different game to resume. If there    *
+ *    are checkpoints, the game is first put back to the newest one that every player is       *
+ *    sure to have taken too. Checkpoints are taken on the same frames by every player, so     *
+ *    the players then all save, and later resume, the same game.                              *
+ *                                                                                             *
+ * INPUT:   descr -- The description of the saved game.                                        *
+ *                                                                                             *
+ * OUTPUT:  bool; Was the game saved?                                                          *
+ *                                                                                             *
+ * WARNINGS:   A player who is more than MaxAhead frames behind, or whose newest checkpoint    *
+ *             falls in the frames between the players, can still end up with another game.    *
+ *             The emergency save flag is set while loading such a game, as before, so the     *
+ *             game CRCs are not compared. If there is no usable checkpoint, the game is       *
+ *             saved as it is.                                                                 *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *   10/19/2026 AGT : Never saves a game that failed to load from the checkpoint.              *
+ *=============================================================================================*/
+bool Save_Emergency_Game(char const * descr)
+{
+	if (Options.CheckpointInterval > 0) {
+		if (Load_Checkpoint(true, Frame - (long)Session.MaxAhead) == CHECKPOINT_FAILED) {
+			return(false);
+		}
+	}
+	return(Save_Game(-1, descr));
+}
+
+
+/***********************************************************************************************
+ * Save_Snapshot -- Captures the game state into an in-memory snapshot.                        *
+ *                                                                                             *
+ *    The game state is written to the pipe with the same data layout as a save game. Unlike   *
+ *    a save game, nothing about the session is included, since a snapshot is only ever        *
+ *    restored into the game that it was taken from. The few values that change during the     *
+ *    game but that a save game doesn't keep are added at the end.                             *
+ *                                                                                             *
+ * INPUT:   pipe  -- Reference to the pipe that will receive the snapshot.                     *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *   10/19/2026 AGT : Keeps the time quake and frame timing values.                            *
+ *=============================================================================================*/
+void Save_Snapshot(Pipe & pipe)
+{
+	Code_All_Pointers();
+	Put_All(pipe, false);
+	Decode_All_Pointers();
+
+	/*
+	**	These change as the game plays, but a save game doesn't keep them, so a loaded game
+	**	starts them afresh. A snapshot has to put them back as they were.
+	*/
+	pipe.Put(&TimeQuake, sizeof(TimeQuake));
+#ifdef FIXIT_CSII	//	checked - ajw 9/28/98
+	pipe.Put(&PendingTimeQuake, sizeof(PendingTimeQuake));
+	pipe.Put(&TimeQuakeCenter, sizeof(TimeQuakeCenter));
+#endif
+	pipe.Put(&Session.MaxAhead, sizeof(Session.MaxAhead));
+	pipe.Put(&Session.FrameSendRate, sizeof(Session.FrameSendRate));
+	pipe.Put(&Session.DesiredFrameRate, sizeof(Session.DesiredFrameRate));
+#if(TIMING_FIX)
+	pipe.Put(&NewMaxAheadFrame1, sizeof(NewMaxAheadFrame1));
+	pipe.Put(&NewMaxAheadFrame2, sizeof(NewMaxAheadFrame2));
+#endif
+	pipe.Flush();
+}
+
+
+/***********************************************************************************************
+ * Load_Snapshot -- Restores the game state from an in-memory snapshot.                        *
+ *                                                                                             *
+ *    This puts the game back into the state it was in when the snapshot was taken, so that    *
+ *    the game can carry on from there and play out the same way it did before.                *
+ *                                                                                             *
+ * INPUT:   straw -- Reference to the straw that supplies the snapshot.                        *
+ *                                                                                             *
+ * OUTPUT:  bool; Was the whole snapshot read?                                                 *
+ *                                                                                             *
+ * WARNINGS:   The snapshot must have been taken from the scenario that is being played. If    *
+ *             this routine returns false, the game is in an unknown state.                    *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *   10/19/2026 AGT : Keeps the time quake and frame timing values.                            *
+ *   10/19/2026 AGT : Fails if the snapshot is short.                                          *
+ *=============================================================================================*/
+bool Load_Snapshot(Straw & straw)
+{
+	if (!Get_State(straw, false)) return(false);
+
+	if (straw.Get(&TimeQuake, sizeof(TimeQuake)) != sizeof(TimeQuake)) return(false);
+#ifdef FIXIT_CSII	//	checked - ajw 9/28/98
+	if (straw.Get(&PendingTimeQuake, sizeof(PendingTimeQuake)) != sizeof(PendingTimeQuake)) return(false);
+	if (straw.Get(&TimeQuakeCenter, sizeof(TimeQuakeCenter)) != sizeof(TimeQuakeCenter)) return(false);
+#endif
+	if (straw.Get(&Session.MaxAhead, sizeof(Session.MaxAhead)) != sizeof(Session.MaxAhead)) return(false);
+	if (straw.Get(&Session.FrameSendRate, sizeof(Session.FrameSendRate)) != sizeof(Session.FrameSendRate)) return(false);
+	if (straw.Get(&Session.DesiredFrameRate, sizeof(Session.DesiredFrameRate)) != sizeof(Session.DesiredFrameRate)) return(false);
+#if(TIMING_FIX)
+	if (straw.Get(&NewMaxAheadFrame1, sizeof(NewMaxAheadFrame1)) != sizeof(NewMaxAheadFrame1)) return(false);
+	if (straw.Get(&NewMaxAheadFrame2, sizeof(NewMaxAheadFrame2)) != sizeof(NewMaxAheadFrame2)) return(false);
+#endif
+
+	/*
+	**	Fixup the inferred data as for a multiplayer game. This skips the bridge overpass
+	**	check, which draws random numbers and so would change the course of the game.
+	*/
+	Post_Load_Game(true);
+
+	Map.Reload_Sidebar();
+	return(true);
+}
+
+
 /***************************************************************************
  * Save_Misc_Values -- saves miscellaneous variables                       *
  *                                                                         *
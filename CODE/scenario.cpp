@@ -765,6 +765,12 @@ void Clear_Scenario(void)
 
 	CurrentObject.Clear();
 
+	/*
+	**	Any checkpoint chain belongs to the old game state, so the next checkpoint must
+	**	be a full one.
+	*/
+	Checkpoint.Reset();
+
 	for (int index = 0; index < WAYPT_COUNT; index++) {
 		Scen.Waypoint[index] = -1;
 	}
@@ -2144,6 +2150,14 @@ bool Read_Scenario_INI(char * fname, bool )
 	}
 #endif
 
+	/*
+	**	Put the rules back as the rules control files left them. Every value they can change
+	**	is restored, so anything an earlier scenario overrode goes back to its base setting.
+	**	The image was made after the resets below and the rules control files were processed,
+	**	so it already holds them, and any value the rules set over a reset.
+	*/
+	bool restored = Rule.Restore_Base_Rules();
+
 #ifdef FIXIT_ANTS
 	Session.Messages.Reset();
 //	Session.Messages.Add_Message(NULL, 0, NULL, PCOLOR_GREEN, TPF_6PT_GRAD|TPF_USE_GRAD_PAL|TPF_FULLSHADOW, 1);
@@ -2152,42 +2166,31 @@ bool Read_Scenario_INI(char * fname, bool )
 //	Session.Messages.Add_Message(NULL, 0, NULL, PCOLOR_GREEN, TPF_6PT_GRAD|TPF_USE_GRAD_PAL|TPF_FULLSHADOW, 1);
 //	Session.Messages.Add_Message(NULL, 0, NULL, PCOLOR_GREEN, TPF_6PT_GRAD|TPF_USE_GRAD_PAL|TPF_FULLSHADOW, 1);
 //	Session.Messages.Add_Message(NULL, 0, NULL, PCOLOR_GREEN, TPF_6PT_GRAD|TPF_USE_GRAD_PAL|TPF_FULLSHADOW, 1);
-	WeaponTypeClass::As_Pointer(WEAPON_FLAMER)->Sound = VOC_NONE;
-	InfantryTypeClass::As_Reference(INFANTRY_THIEF).IsDoubleOwned = false;
-	InfantryTypeClass::As_Reference(INFANTRY_E4).IsDoubleOwned = false;
-	InfantryTypeClass::As_Reference(INFANTRY_SPY).PrimaryWeapon = NULL;
-	InfantryTypeClass::As_Reference(INFANTRY_SPY).SecondaryWeapon = NULL;
-	InfantryTypeClass::As_Reference(INFANTRY_GENERAL).IsBomber = false;
-	UnitTypeClass::As_Reference(UNIT_HARVESTER).IsExploding = false;
-	UnitTypeClass::As_Reference(UNIT_ANT1).Level = -1;
-	UnitTypeClass::As_Reference(UNIT_ANT2).Level = -1;
-	UnitTypeClass::As_Reference(UNIT_ANT3).Level = -1;
-	BuildingTypeClass::As_Reference(STRUCT_QUEEN).Level = -1;
-	BuildingTypeClass::As_Reference(STRUCT_LARVA1).Level = -1;
-	BuildingTypeClass::As_Reference(STRUCT_LARVA2).Level = -1;
 #endif
 
-
-	Rule.General(RuleINI);
-	Rule.Recharge(RuleINI);
-	Rule.AI(RuleINI);
-	Rule.Powerups(RuleINI);
-	Rule.Land_Types(RuleINI);
-	Rule.Themes(RuleINI);
-	Rule.IQ(RuleINI);
-	Rule.Objects(RuleINI);
-	Rule.Difficulty(RuleINI);
-#ifdef FIXIT_CSII	//	checked - ajw 9/28/98 - Except does this _change_ any rules, or just add to them? - Just adds.
-	Rule.General(AftermathINI);
-	Rule.Recharge(AftermathINI);
-	Rule.AI(AftermathINI);
-	Rule.Powerups(AftermathINI);
-	Rule.Land_Types(AftermathINI);
-	Rule.Themes(AftermathINI);
-	Rule.IQ(AftermathINI);
-	Rule.Objects(AftermathINI);
-	Rule.Difficulty(AftermathINI);
+	/*
+	**	If the image couldn't be used, reset the values the rules may not give and then
+	**	process the rules control files as text. This compiles a new image.
+	*/
+	if (!restored) {
+#ifdef FIXIT_ANTS
+		WeaponTypeClass::As_Pointer(WEAPON_FLAMER)->Sound = VOC_NONE;
+		InfantryTypeClass::As_Reference(INFANTRY_THIEF).IsDoubleOwned = false;
+		InfantryTypeClass::As_Reference(INFANTRY_E4).IsDoubleOwned = false;
+		InfantryTypeClass::As_Reference(INFANTRY_SPY).PrimaryWeapon = NULL;
+		InfantryTypeClass::As_Reference(INFANTRY_SPY).SecondaryWeapon = NULL;
+		InfantryTypeClass::As_Reference(INFANTRY_GENERAL).IsBomber = false;
+		UnitTypeClass::As_Reference(UNIT_HARVESTER).IsExploding = false;
+		UnitTypeClass::As_Reference(UNIT_ANT1).Level = -1;
+		UnitTypeClass::As_Reference(UNIT_ANT2).Level = -1;
+		UnitTypeClass::As_Reference(UNIT_ANT3).Level = -1;
+		BuildingTypeClass::As_Reference(STRUCT_QUEEN).Level = -1;
+		BuildingTypeClass::As_Reference(STRUCT_LARVA1).Level = -1;
+		BuildingTypeClass::As_Reference(STRUCT_LARVA2).Level = -1;
 #endif
+		Rule.Base_Rules();
+	}
+
 	/*
 	**	Override any rules values specified in this
 	**	particular scenario file.
@@ -0,0 +1,2823 @@
+/*
+**	Command & Conquer Red Alert(tm)
+**	Copyright 2025 Electronic Arts Inc.
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/***********************************************************************************************
+ *                                                                                             *
+ *                 Project Name : Command & Conquer                                            *
+ *                                                                                             *
+ *                    File Name : SELFTEST.CPP                                                 *
+ *                                                                                             *
+ *                   Start Date : 10/19/26                                                     *
+ *                                                                                             *
+ *                  Last Update : October 19, 2026                                             *
+ *                                                                                             *
+ *---------------------------------------------------------------------------------------------*
+ * Functions:                                                                                  *
+ *   Self_Test -- Runs the self tests and benchmarks named on the command line.                *
+ *   Reference_Crypt -- Encrypts or decrypts data one block at a time.                         *
+ *   Reference_Exponent_Mod -- Raises a number to a power by long multiplication and division. *
+ *   Reference_Find_Cell -- Finds a spot in a zone by checking every square of every cell.     *
+ *   Test_Blowfish -- Checks Blowfish and its pipe and straw against a block at a time.        *
+ *   Test_Checkpoint -- Checks that a chain of checkpoints reads back, and times it.           *
+ *   Test_Distance -- Checks measuring distance lists against Distance, and times it.          *
+ *   Test_Heap -- Checks heap allocation, freeing and logical IDs, and times them.             *
+ *   Test_Heap_Growth -- Checks that heaps grow without moving objects, and times the growth.  *
+ *   Test_INI -- Checks INI loading, lookup and rewriting, and times them.                     *
+ *   Test_Metrics -- Checks the metrics written out for scraping, and times them.              *
+ *   Test_Modexp -- Checks modular exponentiation against a reference, and times it.           *
+ *   Test_Placement -- Checks finding building spots against a full scan, and times it.        *
+ *   Test_Profiler -- Checks the scopes and trace the profiler records, and times a scope.     *
+ *   Test_Straw -- Checks the straw and pipe views against copying, and times them.            *
+ *   Test_Terrain_Cache -- Checks the terrain cache against drawing each cell, and times it.   *
+ *   Test_UnVQ -- Checks the VQ block drawers against drawing by the block, and times them.    *
+ *   Test_VQA -- Checks that loading movie frames ahead draws the same frames, and times it.   *
+ * - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+#include	"function.h"
+#include	<vqa32/unvq.h>
+#include	<thread>
+
+
+/*
+**	Each self test checks that a part of the game works as it should and then times it, so that
+**	runs from before and after a change can be compared. The tests use no game data and draw
+**	only into pages of their own, so they can run before the game is set up. "-SELFTEST" runs
+**	them all and "-SELFTEST:NAME" runs just the one named. A test that can use a file of the
+**	game's, such as a movie, is given one with "-SELFTEST:NAME=FILE" and otherwise makes its
+**	own. The radar is not tested here: which of its cells get plotted depends on the map, the
+**	shroud and the sidebar being set up, and plotting them needs the game's palette and art.
+*/
+struct SelfTestType {
+	char const * Name;
+	bool (*Test)(void);
+};
+
+
+/*
+**	The file given to the test being run, or NULL if none was.
+*/
+static char const * SelfTestFile = NULL;
+
+
+/*
+**	Prints a check that failed. It returns the result of the check so that a test can keep
+**	track of whether all of its checks passed.
+*/
+static bool Check(bool result, char const * what)
+{
+	if (!result) {
+		printf("  failed: %s\n", what);
+	}
+	return(result);
+}
+
+
+/*
+**	Fetches the milliseconds that have gone by since a time fetched from the metrics clock.
+*/
+static double Milliseconds(double start)
+{
+	return((MetricsClass::Now() - start) * 1000.0);
+}
+
+
+/*
+**	This gives the self test access to how much of the INI arena has been used, so that it
+**	can check that rewriting a value does not use more of it, and to how much memory the INI
+**	holds. It also lists every entry, so that they can all be looked up.
+*/
+class SelfTestINIClass : public INIClass
+{
+	public:
+		int Arena_Used(void) const {
+			int used = 0;
+			for (ArenaBlock const * block = Arena; block != NULL; block = block->Next) {
+				used += block->Used;
+			}
+			return(used);
+		}
+
+		int Memory_Used(void) const {
+			int size = (SectionSlots * sizeof(SectionTable[0])) + (EntrySlots * sizeof(EntryTable[0]));
+			for (ArenaBlock const * block = Arena; block != NULL; block = block->Next) {
+				size += sizeof(ArenaBlock) + block->Size;
+			}
+			return(size);
+		}
+
+		int List_Entries(char const ** sections, char const ** entries, int max) const {
+			int count = 0;
+			for (INISection const * secptr = SectionList.First(); secptr && secptr->Is_Valid(); secptr = secptr->Next()) {
+				for (INIEntry const * entptr = secptr->EntryList.First(); entptr && entptr->Is_Valid(); entptr = entptr->Next()) {
+					if (count == max) return(count);
+					sections[count] = secptr->Section;
+					entries[count++] = entptr->Entry;
+				}
+			}
+			return(count);
+		}
+};
+
+
+/*
+**	Writes the text of a large multiplayer map into the buffer: the map and overlay packs,
+**	the terrain and the starting objects of eight players, with the sections and entries
+**	named as a real map names them. It returns with the length of the text.
+*/
+static int Write_Test_Map(char * text)
+{
+	static char const base64[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+	static char const * const terrain[] = {"T01", "T02", "T05", "T07", "T11", "TC01", "TC03", "MINE", "BOXES01"};
+	static char const * const structures[] = {"FACT", "POWR", "APWR", "PROC", "SILO", "WEAP", "BARR", "GUN", "SAM", "DOME"};
+	static char const * const units[] = {"1TNK", "2TNK", "3TNK", "JEEP", "APC", "ARTY", "HARV", "MCV"};
+	static char const * const infantry[] = {"E1", "E2", "E3", "E4", "E6", "DOG", "SPY", "MEDI"};
+	unsigned long seed = 77;
+	char * ptr = text;
+
+	ptr += sprintf(ptr, "; generated for the INI self test\r\n\r\n[Basic]\r\nName=Self Test Map\r\nIntro=<none>\r\n"
+		"Brief=<none>\r\nWin=<none>\r\nLose=<none>\r\nAction=<none>\r\nPlayer=Multi1\r\nTheme=No theme\r\n"
+		"CarryOverMoney=0\r\nToCarryOver=no\r\nToInherit=no\r\nTimerInherit=no\r\nCivEvac=no\r\nNewINIFormat=3\r\n"
+		"CarryOverCap=-1\r\nEndOfGame=no\r\nNoSpyPlane=no\r\nSkipScore=no\r\nOneTimeOnly=no\r\nSkipMapSelect=no\r\n"
+		"Official=no\r\nFillSilos=no\r\nTruckCrate=no\r\nPercent=0\r\n\r\n"
+		"[Map]\r\nTheater=TEMPERATE\r\nX=1\r\nY=1\r\nWidth=126\r\nHeight=126\r\n\r\n");
+
+	for (int house = 1; house <= 8; house++) {
+		ptr += sprintf(ptr, "[Multi%d]\r\nCountry=Multi%d\r\nAllies=Multi%d\r\nCredits=10\r\nEdge=North\r\n"
+			"MaxBuilding=150\r\nMaxInfantry=150\r\nMaxUnit=150\r\nMaxVessel=100\r\nTechLevel=-1\r\nIQ=0\r\n"
+			"PlayerControl=no\r\n\r\n", house, house, house);
+	}
+
+	ptr += sprintf(ptr, "[Waypoints]\r\n");
+	for (int index = 0; index < 100; index++) {
+		seed = seed * 1103515245 + 12345;
+		ptr += sprintf(ptr, "%d=%d\r\n", index, (int)((seed >> 16) % MAP_CELL_TOTAL));
+	}
+
+	/*
+	**	The packs are what make a map big: its cells, packed and encoded in lines of text.
+	*/
+	static char const * const packs[] = {"MapPack", "OverlayPack"};
+	static int const packlines[] = {640, 96};
+	for (int pack = 0; pack < 2; pack++) {
+		ptr += sprintf(ptr, "\r\n[%s]\r\n", packs[pack]);
+		for (int line = 1; line <= packlines[pack]; line++) {
+			ptr += sprintf(ptr, "%d=", line);
+			for (int index = 0; index < 70; index++) {
+				seed = seed * 1103515245 + 12345;
+				*ptr++ = base64[(seed >> 16) & 0x3F];
+			}
+			ptr += sprintf(ptr, "\r\n");
+		}
+	}
+
+	ptr += sprintf(ptr, "\r\n[TERRAIN]\r\n");
+	for (int index = 0; index < 900; index++) {
+		seed = seed * 1103515245 + 12345;
+		ptr += sprintf(ptr, "%d=%s\r\n", 1000 + index * 17, terrain[(seed >> 16) % ARRAY_SIZE(terrain)]);
+	}
+
+	ptr += sprintf(ptr, "\r\n[STRUCTURES]\r\n");
+	for (int index = 0; index < 240; index++) {
+		ptr += sprintf(ptr, "%d=Multi%d,%s,256,%d,0,None,1,0\r\n", index, 1 + index % 8, structures[index % ARRAY_SIZE(structures)], 2000 + index * 53);
+	}
+
+	ptr += sprintf(ptr, "\r\n[UNITS]\r\n");
+	for (int index = 0; index < 160; index++) {
+		ptr += sprintf(ptr, "%d=Multi%d,%s,256,%d,64,Guard,None\r\n", index, 1 + index % 8, units[index % ARRAY_SIZE(units)], 3000 + index * 41);
+	}
+
+	ptr += sprintf(ptr, "\r\n[INFANTRY]\r\n");
+	for (int index = 0; index < 320; index++) {
+		ptr += sprintf(ptr, "%d=Multi%d,%s,256,%d,%d,Guard,128,None\r\n", index, 1 + index % 8, infantry[index % ARRAY_SIZE(infantry)], 4000 + index * 29, index % 5);
+	}
+
+	ptr += sprintf(ptr, "\r\n[CellTriggers]\r\n");
+	for (int index = 0; index < 200; index++) {
+		ptr += sprintf(ptr, "%d=tr%d\r\n", 5000 + index * 7, index % 12);
+	}
+	return(ptr - text);
+}
+
+
+/***********************************************************************************************
+ * Test_INI -- Checks INI loading, lookup and rewriting, and times them.                       *
+ *                                                                                             *
+ *    The values of a small INI file must be found after it is loaded, a rewritten entry must  *
+ *    move to the end of its section and take no more of the arena when the new value fits,    *
+ *    and the data must come back the same after it is saved and loaded again. A large INI     *
+ *    is then loaded to time loading, looking up every entry and rewriting them, and to see    *
+ *    how much memory it holds: the INI file given for the test (such as RULES.INI), or else   *
+ *    a large multiplayer map made up for the test. Since the arena only grows until the INI   *
+ *    is cleared, the memory held after the rewrites is the most it holds.                     *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  bool; Did all the checks pass?                                                     *
+ *                                                                                             *
+ * WARNINGS:   An INI file given must be a plain file; files in a mixfile cannot be used.      *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *   10/19/2026 AGT : Times a rules file or a large map, and reports the memory held.          *
+ *=============================================================================================*/
+static bool Test_INI(void)
+{
+	static char const text[] =
+		"[General]\r\n"
+		"Name=Alpha\r\n"
+		"Count=3 ; a comment\r\n"
+		"Speed=fast\r\n"
+		"\r\n"
+		"[Other]\r\n"
+		"Name=Beta\r\n";
+	char buffer[128];
+	bool ok = true;
+
+	SelfTestINIClass ini;
+	BufferStraw straw(text, strlen(text));
+	ok = Check(ini.Load(straw), "load") && ok;
+	ok = Check(ini.Section_Count() == 2, "section count") && ok;
+	ok = Check(ini.Entry_Count("General") == 3, "entry count") && ok;
+	ini.Get_String("General", "Name", "", buffer, sizeof(buffer));
+	ok = Check(strcmp(buffer, "Alpha") == 0, "lookup") && ok;
+	ok = Check(ini.Get_Int("General", "Count") == 3, "comment stripped") && ok;
+	ini.Get_String("Other", "Name", "", buffer, sizeof(buffer));
+	ok = Check(strcmp(buffer, "Beta") == 0, "lookup in second section") && ok;
+	ok = Check(!ini.Is_Present("General", "Missing") && !ini.Is_Present("Missing"), "missing entry") && ok;
+
+	/*
+	**	A rewritten entry moves to the end of its section. A value that fits in the old one's
+	**	room takes no more of the arena, however many times it is written.
+	*/
+	ok = Check(ini.Put_String("General", "Name", "Gamma"), "rewrite") && ok;
+	ok = Check(strcmp(ini.Get_Entry("General", 2), "Name") == 0, "rewritten entry moved to the end") && ok;
+	int used = ini.Arena_Used();
+	for (int index = 0; index < 10000; index++) {
+		ini.Put_String("General", "Name", (index & 1) ? "Delta" : "Eps");
+	}
+	ok = Check(ini.Arena_Used() == used, "rewrites that fit take no more arena") && ok;
+	ok = Check(ini.Put_String("General", "Name", "A much longer value than before"), "longer rewrite") && ok;
+	ini.Get_String("General", "Name", "", buffer, sizeof(buffer));
+	ok = Check(strcmp(buffer, "A much longer value than before") == 0, "longer rewrite value") && ok;
+
+	/*
+	**	An empty value removes the entry.
+	*/
+	ok = Check(ini.Put_String("General", "Speed", "") && !ini.Is_Present("General", "Speed"), "empty value removes") && ok;
+	ok = Check(ini.Entry_Count("General") == 2, "entry count after removal") && ok;
+
+	/*
+	**	Saving and loading again must give the same data.
+	*/
+	static char saved[1024];
+	BufferPipe pipe(saved, sizeof(saved));
+	int size = ini.Save(pipe);
+	INIClass copy;
+	BufferStraw savedstraw(saved, size);
+	ok = Check(size > 0 && copy.Load(savedstraw), "save and load") && ok;
+	copy.Get_String("General", "Name", "", buffer, sizeof(buffer));
+	ok = Check(strcmp(buffer, "A much longer value than before") == 0, "value after save and load") && ok;
+	ok = Check(copy.Get_Int("General", "Count") == 3 && copy.Entry_Count("Other") == 1, "entries after save and load") && ok;
+
+	/*
+	**	Time loading the large INI, looking up every entry in it, and rewriting them all with
+	**	values of the same length, as a game reading and saving its rules would.
+	*/
+	char * big = NULL;
+	int length = 0;
+	if (SelfTestFile != NULL) {
+		RawFileClass file(SelfTestFile);
+		length = file.Size();
+		if (!Check(file.Is_Available() && length > 0, "open the INI file given")) return(false);
+		big = new char [length];
+		length = file.Read(big, length);
+		printf("  %s, %d bytes\n", SelfTestFile, length);
+	} else {
+		big = new char [256*1024];
+		length = Write_Test_Map(big);
+		printf("  made up multiplayer map, %d bytes\n", length);
+	}
+
+	int const loads = 20;
+	double start = MetricsClass::Now();
+	for (int index = 0; index < loads; index++) {
+		INIClass loadini;
+		BufferStraw loadstraw(big, length);
+		loadini.Load(loadstraw);
+	}
+	double loadms = Milliseconds(start) / loads;
+
+	SelfTestINIClass bigini;
+	BufferStraw bigstraw(big, length);
+	ok = Check(bigini.Load(bigstraw), "load the large INI") && ok;
+	int loadmemory = bigini.Memory_Used();
+
+	int const maxentries = 20000;
+	char const ** sectionnames = new char const * [maxentries];
+	char const ** entrynames = new char const * [maxentries];
+	char (* values)[sizeof(buffer)] = new char [maxentries][sizeof(buffer)];
+	int entries = bigini.List_Entries(sectionnames, entrynames, maxentries);
+	for (int index = 0; index < entries; index++) {
+		bigini.Get_String(sectionnames[index], entrynames[index], "", values[index], sizeof(values[index]));
+	}
+	ok = Check(entries > 0, "large INI entries") && ok;
+
+	int const passes = 100;
+	int found = 0;
+	start = MetricsClass::Now();
+	for (int pass = 0; pass < passes; pass++) {
+		for (int index = 0; index < entries; index++) {
+			found += (bigini.Get_String(sectionnames[index], entrynames[index], "", buffer, sizeof(buffer)) > 0);
+		}
+	}
+	double lookupms = Milliseconds(start);
+	ok = Check(found == entries * passes, "large INI lookups") && ok;
+
+	/*
+	**	The names belong to the INI, and a rewritten entry keeps its own, so they stay good
+	**	through the rewrites.
+	*/
+	start = MetricsClass::Now();
+	for (int pass = 0; pass < passes; pass++) {
+		for (int index = 0; index < entries; index++) {
+			bigini.Put_String(sectionnames[index], entrynames[index], values[index]);
+		}
+	}
+	double rewritems = Milliseconds(start);
+	int peakmemory = bigini.Memory_Used();
+	bigini.Get_String(sectionnames[entries-1], entrynames[entries-1], "", buffer, sizeof(buffer));
+	ok = Check(strcmp(buffer, values[entries-1]) == 0, "large INI rewrites") && ok;
+
+	delete [] values;
+	delete [] entrynames;
+	delete [] sectionnames;
+	delete [] big;
+
+	int lookups = entries * passes;
+	printf("  load %d entries: %.3f ms\n", entries, loadms);
+	printf("  %d lookups: %.3f ms (%.1f ns each)\n", lookups, lookupms, lookupms * 1000000.0 / lookups);
+	printf("  %d rewrites: %.3f ms (%.1f ns each)\n", lookups, rewritems, rewritems * 1000000.0 / lookups);
+	printf("  memory held: %d bytes after loading, %d bytes at most (after the rewrites)\n", loadmemory, peakmemory);
+	return(ok);
+}
+
+
+/*
+**	The save game image used to time loading is written in blocks of this size, as Save_Game
+**	writes it, and is read back in pieces of these sizes, as the objects that make up most of
+**	a save game are.
+*/
+static int const SaveBlockSize = 4096;
+static int const SaveRecordSizes[] = {
+	sizeof(CellClass), sizeof(InfantryClass), sizeof(UnitClass), sizeof(BuildingClass),
+	sizeof(TARGET), sizeof(AnimClass), sizeof(BulletClass), sizeof(int)
+};
+static char const SaveKey[] = "The self test's key for the save game image.";
+
+
+/*
+**	Writes data to a file through the same chain that Save_Game uses: compressed in blocks
+**	and then encrypted.
+*/
+static void Save_Test_Image(char const * name, char const * data, int length)
+{
+	RawFileClass file(name);
+	FilePipe fpipe(file);
+	BlowPipe bpipe(BlowPipe::ENCRYPT);
+	ParallelPipe pipe(CODEC_LZO, ParallelPipe::COMPRESS, SaveBlockSize);
+	bpipe.Key(SaveKey, sizeof(SaveKey));
+	bpipe.Put_To(fpipe);
+	pipe.Put_To(bpipe);
+
+	pipe.Put(data, length);
+	pipe.Flush();
+	pipe.End();
+}
+
+
+/*
+**	Reads a save game image back out of a file in the pieces that Load_Game would. The
+**	chain is either the one that Load_Game used to have (LZO straw, with Get), the parallel
+**	straw with Get and no views anywhere, or the parallel straw with Peek and Consume all
+**	the way down to the Blowfish straw. It returns with the number of bytes read.
+*/
+static int Load_Test_Image(char const * name, int chain, char * dest, int length)
+{
+	RawFileClass file(name);
+	FileStraw fstraw(file);
+	BlowStraw bstraw(BlowStraw::DECRYPT);
+	bstraw.Key(SaveKey, sizeof(SaveKey));
+	bstraw.Get_From(fstraw);
+
+	LZOStraw lzo(LZOStraw::DECOMPRESS, SaveBlockSize);
+	Straw copier;
+	ParallelStraw parallel(CODEC_LZO, ParallelStraw::DECOMPRESS, SaveBlockSize);
+	Straw * straw = &parallel;
+	switch (chain) {
+		case 0:
+			lzo.Get_From(bstraw);
+			straw = &lzo;
+			break;
+
+		case 1:
+			copier.Get_From(bstraw);
+			parallel.Get_From(copier);
+			break;
+
+		default:
+			parallel.Get_From(bstraw);
+			break;
+	}
+
+	int pos = 0;
+	for (int record = 0; pos < length; record++) {
+		int size = min(SaveRecordSizes[record % ARRAY_SIZE(SaveRecordSizes)], length - pos);
+		int got = 0;
+		if (chain == 2) {
+			void const * view;
+			int chunk;
+			while (got < size && (chunk = straw->Peek(view, size - got)) > 0) {
+				memcpy(dest + pos + got, view, chunk);
+				got += straw->Consume(chunk);
+			}
+		} else {
+			got = straw->Get(dest + pos, size);
+		}
+		pos += got;
+		if (got < size) break;
+	}
+	return(pos);
+}
+
+
+/***********************************************************************************************
+ * Test_Straw -- Checks the straw and pipe views against copying, and times them.              *
+ *                                                                                             *
+ *    Data drawn through a straw with Peek and Consume must be the same, and give the same     *
+ *    CRC, as data drawn with Get. Data written into a pipe with Reserve and Commit must come  *
+ *    out the same, with the same hash, as data written with Put. Data compressed by the       *
+ *    parallel pipe must come back the same from the parallel straw's view. Drawing a large    *
+ *    buffer through a CRC straw is then timed both ways. Last, a save game image is read      *
+ *    back from a file the old way through the LZO straw, through the parallel straw with      *
+ *    Get, and through the views; all three must give the same data and are timed.             *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  bool; Did all the checks pass?                                                     *
+ *                                                                                             *
+ * WARNINGS:   This writes and then removes the file SELFTEST.SAV.                             *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *   10/19/2026 AGT : Times loading a save game image through the Blowfish straw's view.       *
+ *=============================================================================================*/
+static bool Test_Straw(void)
+{
+	int const length = 1024*1024;
+	char * data = new char [length];
+	char * copy = new char [length];
+	char * packed = new char [length * 2];
+	bool ok = true;
+
+	/*
+	**	Data that compresses somewhat, but not completely.
+	*/
+	unsigned long seed = 1;
+	for (int index = 0; index < length; index++) {
+		seed = seed * 1103515245 + 12345;
+		data[index] = (char)((index & 0x100) ? (seed >> 16) : (index >> 4));
+	}
+
+	/*
+	**	Peek and Consume through a CRC straw.
+	*/
+	BufferStraw getsource(data, length);
+	CRCStraw getcrc;
+	getcrc.Get_From(getsource);
+	int got = 0;
+	int chunk;
+	while ((chunk = getcrc.Get(copy + got, min(length - got, 3000))) > 0) {
+		got += chunk;
+	}
+
+	BufferStraw peeksource(data, length);
+	CRCStraw peekcrc;
+	peekcrc.Get_From(peeksource);
+	int peeked = 0;
+	void const * view;
+	while ((chunk = peekcrc.Peek(view, 3000)) > 0) {
+		if (memcmp(view, data + peeked, chunk) != 0) break;
+		peeked += peekcrc.Consume(chunk);
+	}
+	ok = Check(got == length && memcmp(copy, data, length) == 0, "straw Get") && ok;
+	ok = Check(peeked == length, "straw Peek and Consume") && ok;
+	ok = Check(getcrc.Result() == peekcrc.Result(), "CRC the same either way") && ok;
+
+	/*
+	**	Reserve and Commit through a SHA pipe.
+	*/
+	unsigned char puthash[20];
+	unsigned char reservehash[20];
+	BufferPipe putdest(copy, length);
+	SHAPipe putsha;
+	putsha.Put_To(putdest);
+	for (int pos = 0; pos < length; pos += 3000) {
+		putsha.Put(data + pos, min(length - pos, 3000));
+	}
+	putsha.End();
+	putsha.Result(puthash);
+
+	memset(packed, 0, length);
+	BufferPipe reservedest(packed, length);
+	SHAPipe reservesha;
+	reservesha.Put_To(reservedest);
+	int put = 0;
+	void * space;
+	while ((chunk = reservesha.Reserve(space, min(length - put, 3000))) > 0) {
+		memcpy(space, data + put, chunk);
+		put += chunk;
+		reservesha.Commit(chunk);
+	}
+	reservesha.End();
+	reservesha.Result(reservehash);
+	ok = Check(put == length && memcmp(packed, data, length) == 0, "pipe Reserve and Commit") && ok;
+	ok = Check(memcmp(puthash, reservehash, sizeof(puthash)) == 0, "hash the same either way") && ok;
+
+	/*
+	**	Compress with the parallel pipe and draw it back out through the parallel straw's view.
+	**	Only LZO is checked, since the LCW compressor is only a stub in this port.
+	*/
+	BufferPipe packdest(packed, length * 2);
+	ParallelPipe packer(CODEC_LZO, ParallelPipe::COMPRESS);
+	packer.Put_To(packdest);
+	int packedsize = packer.Put(data, length);
+	packedsize += packer.End();
+
+	BufferStraw unpacksource(packed, packedsize);
+	ParallelStraw unpacker(CODEC_LZO, ParallelStraw::DECOMPRESS);
+	unpacker.Get_From(unpacksource);
+	int unpacked = 0;
+	while ((chunk = unpacker.Peek(view, 5000)) > 0 && unpacked + chunk <= length) {
+		memcpy(copy + unpacked, view, chunk);
+		unpacked += unpacker.Consume(chunk);
+	}
+	ok = Check(packedsize > 0 && packedsize < length, "parallel pipe compression") && ok;
+	ok = Check(unpacked == length && memcmp(copy, data, length) == 0, "parallel straw Peek and Consume") && ok;
+
+	/*
+	**	Time drawing the data through a CRC straw by copying and by looking at it in place.
+	*/
+	int const passes = 64;
+	double start = MetricsClass::Now();
+	for (int pass = 0; pass < passes; pass++) {
+		BufferStraw source(data, length);
+		CRCStraw crc;
+		crc.Get_From(source);
+		while (crc.Get(copy, 16*1024) > 0) {}
+	}
+	double getms = Milliseconds(start);
+
+	start = MetricsClass::Now();
+	for (int pass = 0; pass < passes; pass++) {
+		BufferStraw source(data, length);
+		CRCStraw crc;
+		crc.Get_From(source);
+		while ((chunk = crc.Peek(view, 16*1024)) > 0) {
+			crc.Consume(chunk);
+		}
+	}
+	double peekms = Milliseconds(start);
+
+	printf("  CRC of %d MB with Get: %.3f ms (%.0f MB/s)\n", passes, getms, passes * 1000.0 / getms);
+	printf("  CRC of %d MB with Peek and Consume: %.3f ms (%.0f MB/s)\n", passes, peekms, passes * 1000.0 / peekms);
+
+	/*
+	**	A save game image is mostly objects that are largely zero, with some of their
+	**	values set. Write one the way Save_Game does and read it back all three ways.
+	*/
+	int const imagesize = 8*1024*1024;
+	char * image = new char [imagesize];
+	char * loaded = new char [imagesize];
+	memset(image, 0, imagesize);
+	for (int pos = 0, record = 0; pos < imagesize; pos += SaveRecordSizes[record++ % ARRAY_SIZE(SaveRecordSizes)]) {
+		for (int index = pos; index < min(pos + 48, imagesize); index += 3) {
+			seed = seed * 1103515245 + 12345;
+			image[index] = (char)(seed >> 16);
+		}
+	}
+	Save_Test_Image("SELFTEST.SAV", image, imagesize);
+
+	char const * const chains[3] = {"LZO straw", "parallel straw with Get", "parallel straw with Peek"};
+	int const loads = 8;
+	double loadms[3];
+	for (int chain = 0; chain < 3; chain++) {
+		memset(loaded, 0xFF, imagesize);
+		int size = Load_Test_Image("SELFTEST.SAV", chain, loaded, imagesize);
+		ok = Check(size == imagesize && memcmp(loaded, image, imagesize) == 0, chains[chain]) && ok;
+
+		start = MetricsClass::Now();
+		for (int pass = 0; pass < loads; pass++) {
+			Load_Test_Image("SELFTEST.SAV", chain, loaded, imagesize);
+		}
+		loadms[chain] = Milliseconds(start) / loads;
+	}
+	RawFileClass("SELFTEST.SAV").Delete();
+
+	for (int chain = 0; chain < 3; chain++) {
+		printf("  Load of an %d MB save image through the %s: %.3f ms (%.0f MB/s)\n", imagesize / (1024*1024), chains[chain], loadms[chain], (imagesize / (1024.0*1024.0)) * 1000.0 / loadms[chain]);
+	}
+
+	delete [] image;
+	delete [] loaded;
+	delete [] data;
+	delete [] copy;
+	delete [] packed;
+	return(ok);
+}
+
+
+/***********************************************************************************************
+ * Reference_Crypt -- Encrypts or decrypts data one block at a time.                           *
+ *                                                                                             *
+ *    This hands the engine a single block per call, so only its one block path is used. A     *
+ *    partial block at the end is copied unchanged, as the engine and its pipe and straw       *
+ *    leave it.                                                                                *
+ *                                                                                             *
+ * INPUT:   engine   -- The keyed engine to use.                                               *
+ *                                                                                             *
+ *          encrypt  -- Should the data be encrypted rather than decrypted?                    *
+ *                                                                                             *
+ *          source   -- Pointer to the data to process.                                        *
+ *                                                                                             *
+ *          length   -- The length of the data.                                                *
+ *                                                                                             *
+ *          dest     -- Pointer to the buffer to hold the result.                              *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+static void Reference_Crypt(BlowfishEngine & engine, bool encrypt, char const * source, int length, char * dest)
+{
+	int pos = 0;
+	for (; pos + 8 <= length; pos += 8) {
+		if (encrypt) {
+			engine.Encrypt(source + pos, 8, dest + pos);
+		} else {
+			engine.Decrypt(source + pos, 8, dest + pos);
+		}
+	}
+	memmove(dest + pos, source + pos, length - pos);
+}
+
+
+/***********************************************************************************************
+ * Test_Blowfish -- Checks Blowfish and its pipe and straw against a block at a time.          *
+ *                                                                                             *
+ *    The engine must give the published result for the all zero key and block. Encrypting     *
+ *    and decrypting many blocks in one call, which interleaves their rounds, must give the    *
+ *    same data as one block at a time, for lengths that are not whole blocks as well. The     *
+ *    same must come out of the Blowfish pipe written in chunks of odd sizes, both into a      *
+ *    pipe that offers room to write into and one that doesn't, and out of the Blowfish        *
+ *    straw read the same way with Get and with Peek and Consume. Encrypting a large buffer    *
+ *    is then timed both ways.                                                                 *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  bool; Did all the checks pass?                                                     *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+static bool Test_Blowfish(void)
+{
+	static char const key[] = "A key for the Blowfish self test, of odd length.";
+	static int const lengths[] = {1, 7, 8, 9, 31, 32, 33, 40, 63, 4099};
+	static int const chunks[] = {1, 3, 7, 8, 9, 13, 64, 1000, 5003};
+	bool ok = true;
+
+	/*
+	**	The published test vector: the all zero key and block.
+	*/
+	static unsigned char const zerokey[8] = {0};
+	static unsigned char const expect[8] = {0x4E, 0xF9, 0x97, 0x45, 0x61, 0x98, 0xDD, 0x78};
+	unsigned char block[8] = {0};
+	BlowfishEngine zero;
+	zero.Submit_Key(zerokey, sizeof(zerokey));
+	zero.Encrypt(block, sizeof(block), block);
+	ok = Check(memcmp(block, expect, sizeof(block)) == 0, "known answer") && ok;
+
+	int const length = 4099;
+	char * data = new char [length];
+	char * reference = new char [length];
+	char * result = new char [length];
+	unsigned long seed = 99;
+	for (int index = 0; index < length; index++) {
+		seed = seed * 1103515245 + 12345;
+		data[index] = (char)(seed >> 16);
+	}
+
+	BlowfishEngine engine;
+	engine.Submit_Key(key, sizeof(key));
+
+	for (int lindex = 0; lindex < ARRAY_SIZE(lengths); lindex++) {
+		int len = lengths[lindex];
+		char what[80];
+
+		/*
+		**	The engine, a whole buffer at a time.
+		*/
+		Reference_Crypt(engine, true, data, len, reference);
+		memset(result, 0, length);
+		engine.Encrypt(data, len, result);
+		sprintf(what, "encrypt %d bytes", len);
+		ok = Check(memcmp(result, reference, len) == 0, what) && ok;
+		engine.Decrypt(result, len, result);
+		sprintf(what, "decrypt %d bytes", len);
+		ok = Check(memcmp(result, data, len) == 0, what) && ok;
+
+		for (int cindex = 0; cindex < ARRAY_SIZE(chunks); cindex++) {
+			int chunk = chunks[cindex];
+
+			/*
+			**	The pipe, into room offered by the pipe after it and into a plain pipe.
+			*/
+			for (int reserve = 0; reserve < 2; reserve++) {
+				memset(result, 0, length);
+				BufferPipe dest(result, length);
+				Pipe plain;
+				BlowPipe pipe(BlowPipe::ENCRYPT);
+				pipe.Key(key, sizeof(key));
+				if (reserve) {
+					pipe.Put_To(dest);
+				} else {
+					plain.Put_To(dest);
+					pipe.Put_To(plain);
+				}
+				int put = 0;
+				for (int pos = 0; pos < len; pos += chunk) {
+					put += pipe.Put(data + pos, min(chunk, len - pos));
+				}
+				put += pipe.Flush();
+				sprintf(what, "pipe %d bytes in chunks of %d%s", len, chunk, reserve ? " into room" : "");
+				ok = Check(put == len && memcmp(result, reference, len) == 0, what) && ok;
+			}
+
+			/*
+			**	The straw, with Get from a straw that offers a view and one that doesn't, and
+			**	with Peek and Consume.
+			*/
+			for (int mode = 0; mode < 3; mode++) {
+				memset(result, 0, length);
+				BufferStraw source(reference, len);
+				Straw plain;
+				BlowStraw straw(BlowStraw::DECRYPT);
+				straw.Key(key, sizeof(key));
+				if (mode == 1) {
+					plain.Get_From(source);
+					straw.Get_From(plain);
+				} else {
+					straw.Get_From(source);
+				}
+				int got = 0;
+				int count;
+				if (mode == 2) {
+					void const * view;
+					while ((count = straw.Peek(view, min(chunk, len - got))) > 0) {
+						memcpy(result + got, view, count);
+						got += straw.Consume(count);
+					}
+				} else {
+					while ((count = straw.Get(result + got, min(chunk, len - got))) > 0) {
+						got += count;
+					}
+				}
+				static char const * const modes[3] = {"Get", "Get without a view", "Peek"};
+				sprintf(what, "straw %s %d bytes in chunks of %d", modes[mode], len, chunk);
+				ok = Check(got == len && memcmp(result, data, len) == 0, what) && ok;
+			}
+		}
+	}
+
+	/*
+	**	Time encrypting a large buffer a block at a time and all at once.
+	*/
+	int const bigsize = 16*1024*1024;
+	char * big = new char [bigsize];
+	memset(big, 0x5A, bigsize);
+
+	double start = MetricsClass::Now();
+	Reference_Crypt(engine, true, big, bigsize, big);
+	double blockms = Milliseconds(start);
+
+	start = MetricsClass::Now();
+	engine.Encrypt(big, bigsize, big);
+	double batchms = Milliseconds(start);
+
+	delete [] big;
+	delete [] data;
+	delete [] reference;
+	delete [] result;
+
+	printf("  encrypt 16 MB a block at a time: %.3f ms (%.0f MB/s)\n", blockms, 16 * 1000.0 / blockms);
+	printf("  encrypt 16 MB in one call: %.3f ms (%.0f MB/s)\n", batchms, 16 * 1000.0 / batchms);
+	return(ok);
+}
+
+
+/*
+**	Fills in a number with the bits given, the top one set, drawn from a simple generator.
+*/
+static void Random_Number(digit * number, int bits, unsigned long & seed)
+{
+	XMP_Init(number, 0, MAX_UNIT_PRECISION);
+	for (int bit = 0; bit < bits; bit++) {
+		seed = seed * 1103515245 + 12345;
+		if ((seed >> 16) & 1) {
+			number[bit / UNITSIZE] |= (digit)1 << (bit % UNITSIZE);
+		}
+	}
+	number[(bits-1) / UNITSIZE] |= (digit)1 << ((bits-1) % UNITSIZE);
+}
+
+
+/***********************************************************************************************
+ * Reference_Exponent_Mod -- Raises a number to a power by long multiplication and division.   *
+ *                                                                                             *
+ *    This is the plain square and multiply method, with every product reduced by a full       *
+ *    division. It is slow, but it shares nothing with the Montgomery or reciprocal methods    *
+ *    that xmp_exponent_mod uses, so it serves as a reference for them.                        *
+ *                                                                                             *
+ * INPUT:   result   -- Where to store the result.                                             *
+ *                                                                                             *
+ *          base     -- The number to raise to the power.                                      *
+ *                                                                                             *
+ *          exponent -- The power to raise it to.                                              *
+ *                                                                                             *
+ *          modulus  -- The modulus.                                                           *
+ *                                                                                             *
+ *          bits     -- The number of bits in the modulus.                                     *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   The numbers must be MAX_UNIT_PRECISION long and the modulus no more than half   *
+ *             that, since the products are twice as long.                                     *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+static void Reference_Exponent_Mod(digit * result, digit const * base, digit const * exponent, digit const * modulus, int bits)
+{
+	int precision = XMP_Bits_To_Digits(bits) * 2;
+	digit product[MAX_UNIT_PRECISION];
+	digit quotient[MAX_UNIT_PRECISION];
+
+	XMP_Init(result, 1, MAX_UNIT_PRECISION);
+	for (int bit = XMP_Count_Bits(exponent, MAX_UNIT_PRECISION) - 1; bit >= 0; bit--) {
+		XMP_Unsigned_Mult(product, result, result, precision);
+		XMP_Unsigned_Div(result, quotient, product, modulus, precision);
+		if ((exponent[bit / UNITSIZE] >> (bit % UNITSIZE)) & 1) {
+			XMP_Unsigned_Mult(product, result, base, precision);
+			XMP_Unsigned_Div(result, quotient, product, modulus, precision);
+		}
+	}
+}
+
+
+/***********************************************************************************************
+ * Test_Modexp -- Checks modular exponentiation against a reference, and times it.             *
+ *                                                                                             *
+ *    Odd moduli take the Montgomery path and even ones the older reciprocal path. Both must   *
+ *    give the same results as the reference, for moduli of a range of sizes and for both      *
+ *    full sized exponents and the usual public exponent. Full sized exponents are then timed  *
+ *    down each path, along with the public key operation that checks a mixfile's digest.      *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  bool; Did all the checks pass?                                                     *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+static bool Test_Modexp(void)
+{
+	digit base[MAX_UNIT_PRECISION];
+	digit exponent[MAX_UNIT_PRECISION];
+	digit modulus[MAX_UNIT_PRECISION];
+	digit result[MAX_UNIT_PRECISION];
+	digit expected[MAX_UNIT_PRECISION];
+	unsigned long seed = 1;
+	bool ok = true;
+
+	/*
+	**	A known answer: 4 to the 13th, mod 497, is 445.
+	*/
+	XMP_Init(base, 4, MAX_UNIT_PRECISION);
+	XMP_Init(exponent, 13, MAX_UNIT_PRECISION);
+	XMP_Init(modulus, 497, MAX_UNIT_PRECISION);
+	xmp_exponent_mod(result, base, exponent, modulus, MAX_UNIT_PRECISION);
+	ok = Check(XMP_Test_Eq_Int(result, 445, MAX_UNIT_PRECISION), "4^13 mod 497") && ok;
+
+	/*
+	**	Random odd and even moduli against the reference. Exponents as long as the modulus
+	**	are only used up to 512 bits, since the reference is slow.
+	*/
+	static int const sizes[] = {33, 64, 160, 320, 512, 1024};
+	int checked = 0;
+	int wrong = 0;
+	for (int size = 0; size < (int)(sizeof(sizes) / sizeof(sizes[0])); size++) {
+		int bits = sizes[size];
+		for (int trial = 0; trial < 8; trial++) {
+			Random_Number(modulus, bits, seed);
+			if (trial & 1) {
+				modulus[0] &= ~(digit)1;
+			} else {
+				modulus[0] |= 1;
+			}
+			Random_Number(base, bits-1, seed);
+			if (trial < 2) {
+				XMP_Init(exponent, 65537, MAX_UNIT_PRECISION);
+			} else {
+				Random_Number(exponent, (bits <= 512) ? bits-1 : 64, seed);
+			}
+
+			xmp_exponent_mod(result, base, exponent, modulus, MAX_UNIT_PRECISION);
+			Reference_Exponent_Mod(expected, base, exponent, modulus, bits);
+			checked++;
+			if (XMP_Compare(result, expected, MAX_UNIT_PRECISION) != 0) {
+				printf("  %d bit %s modulus, trial %d, differs\n", bits, (modulus[0] & 1) ? "odd" : "even", trial);
+				wrong++;
+			}
+		}
+	}
+	ok = Check(wrong == 0, "results the same as the reference") && ok;
+
+	/*
+	**	Time full sized exponents down each path, and the public key operation.
+	*/
+	static int const timedsizes[] = {512, 1024, 2048};
+	for (int size = 0; size < (int)(sizeof(timedsizes) / sizeof(timedsizes[0])); size++) {
+		int bits = timedsizes[size];
+		int const repeats = 4096 / bits;
+		Random_Number(modulus, bits, seed);
+		Random_Number(base, bits-1, seed);
+		Random_Number(exponent, bits-1, seed);
+
+		modulus[0] |= 1;
+		double start = MetricsClass::Now();
+		for (int repeat = 0; repeat < repeats; repeat++) {
+			xmp_exponent_mod(result, base, exponent, modulus, MAX_UNIT_PRECISION);
+		}
+		double montms = Milliseconds(start) / repeats;
+
+		modulus[0] &= ~(digit)1;
+		start = MetricsClass::Now();
+		for (int repeat = 0; repeat < repeats; repeat++) {
+			xmp_exponent_mod(result, base, exponent, modulus, MAX_UNIT_PRECISION);
+		}
+		double recipms = Milliseconds(start) / repeats;
+
+		printf("  %d bit exponent: %.3f ms Montgomery (odd modulus), %.3f ms reciprocal (even modulus)\n", bits, montms, recipms);
+	}
+
+	int const repeats = 1000;
+	Random_Number(modulus, 320, seed);
+	modulus[0] |= 1;
+	Random_Number(base, 319, seed);
+	XMP_Init(exponent, 65537, MAX_UNIT_PRECISION);
+	double start = MetricsClass::Now();
+	for (int repeat = 0; repeat < repeats; repeat++) {
+		xmp_exponent_mod(result, base, exponent, modulus, MAX_UNIT_PRECISION);
+	}
+	printf("  320 bit modulus, exponent 65537: %.2f us\n", Milliseconds(start) * 1000.0 / repeats);
+	printf("  %d results checked against the reference\n", checked);
+	return(ok);
+}
+
+
+/*
+**	The movie playback test records each frame drawn here, since the drawer's callback is given
+**	only the image and the frame number.
+*/
+struct VQARunType {
+	unsigned long * CRC;		// CRC of each frame's image, by frame number.
+	long Frames;				// Number of frames in the movie.
+	long ImageSize;			// Bytes in each frame's image.
+	long Drawn;					// Number of frames drawn.
+	double Time;				// Milliseconds taken to play the movie.
+	VQAStatistics Stats;		// What the player reports about the run.
+};
+static VQARunType * VQARun = NULL;
+
+
+/*
+**	Records the CRC of each frame the player draws.
+*/
+static long VQA_Test_Callback(unsigned char * image, long framenum)
+{
+	if (image != NULL && framenum >= 0 && framenum < VQARun->Frames) {
+		VQARun->CRC[framenum] = Calculate_CRC(image, VQARun->ImageSize);
+		VQARun->Drawn++;
+	}
+	return(0);
+}
+
+
+/*
+**	Plays a movie from a plain file into the player's own image buffer, drawing every frame as
+**	soon as it is loaded, and records the frames drawn. It returns false if the movie could not
+**	be played.
+*/
+static bool Play_Test_Movie(char const * filename, long options, VQARunType & run)
+{
+	memset(&run, 0, sizeof(run));
+
+	VQAHandle * vqa = VQA_Alloc();
+	if (vqa == NULL) return(false);
+	VQA_InitAsDOS(vqa);
+
+	VQAConfig config;
+	VQA_DefaultConfig(&config);
+	config.DrawerCallback = VQA_Test_Callback;
+	config.ImageWidth = -1;
+	config.ImageHeight = -1;
+	config.DrawFlags = VQACFGF_TOPLEFT | VQACFGF_BUFFER | VQACFGF_NOSKIP;
+	config.OptionFlags = VQAOPTF_STEP | VQAOPTF_PALOFF | options;
+
+	bool played = false;
+	if (VQA_Open(vqa, filename, &config) == 0) {
+		VQAInfo info;
+		VQA_GetInfo(vqa, &info);
+		run.Frames = info.NumFrames;
+		run.ImageSize = info.ImageWidth * info.ImageHeight;
+		run.CRC = new unsigned long [run.Frames];
+		memset(run.CRC, 0, run.Frames * sizeof(run.CRC[0]));
+
+		VQARun = &run;
+		double start = MetricsClass::Now();
+		played = (VQA_Play(vqa, VQAMODE_RUN) == VQAERR_EOF);
+		run.Time = Milliseconds(start);
+		VQARun = NULL;
+
+		VQA_GetStats(vqa, &run.Stats);
+		VQA_Close(vqa);
+	}
+	VQA_Free(vqa);
+	return(played);
+}
+
+
+/*
+**	Sets the size of the next chunk of a test movie, most significant byte first as in any IFF
+**	file, and moves past its header.
+*/
+static void Put_Chunk(unsigned char * & ptr, char const * id, long size)
+{
+	memcpy(ptr, id, 4);
+	ptr[4] = (unsigned char)(size >> 24);
+	ptr[5] = (unsigned char)(size >> 16);
+	ptr[6] = (unsigned char)(size >> 8);
+	ptr[7] = (unsigned char)size;
+	ptr += 8;
+}
+
+
+/*
+**	Fetches the next random byte from a simple generator, so that a test gets the same data
+**	each time it runs.
+*/
+static unsigned char Random_Byte(unsigned long & seed)
+{
+	seed = seed * 1103515245 + 12345;
+	return((unsigned char)(seed >> 16));
+}
+
+
+/*
+**	Writes a movie for the playback test: 60 frames of 320 by 200 drawn in 4 by 2 blocks from a
+**	codebook of 512 random blocks, with a new codebook for every group of 8 frames. The block
+**	pointers are random, and about a third of them are one-colour blocks. It has no sound.
+*/
+static bool Write_Test_Movie(char const * filename)
+{
+	int const width = 320;
+	int const height = 200;
+	int const frames = 60;
+	int const group = 8;
+	int const entries = 512;
+	long const blocks = (width / 4) * (height / 2);
+	long const cbsize = entries * 4 * 2;
+	long const palsize = 768;
+
+	/*
+	**	Every frame has its block pointers. The first also has the palette and the first codebook,
+	**	and the last frame of each group has the codebook for the next one.
+	*/
+	long size = 4 + 8 + sizeof(VQAHeader) + 8 + frames * 4;
+	long maxframe = 0;
+	for (int frame = 0; frame < frames; frame++) {
+		long framesize = 8 + blocks * 2;
+		if (frame == 0) framesize += 8 + palsize;
+		if (frame == 0 || frame % group == group-1) framesize += 8 + cbsize;
+		size += 8 + framesize;
+		maxframe = max(maxframe, framesize);
+	}
+
+	unsigned char * movie = new unsigned char [8 + size];
+	unsigned char * ptr = movie;
+	unsigned long seed = 1;
+
+	Put_Chunk(ptr, "FORM", size);
+	memcpy(ptr, "WVQA", 4);
+	ptr += 4;
+
+	VQAHeader header;
+	memset(&header, 0, sizeof(header));
+	header.Version = VQAHD_VER2;
+	header.Frames = frames;
+	header.ImageWidth = width;
+	header.ImageHeight = height;
+	header.BlockWidth = 4;
+	header.BlockHeight = 2;
+	header.FPS = 15;
+	header.Groupsize = group;
+	header.CBentries = entries;
+	header.Xpos = 0xFFFF;
+	header.Ypos = 0xFFFF;
+	header.MaxFramesize = (unsigned short)maxframe;
+	Put_Chunk(ptr, "VQHD", sizeof(header));
+	memcpy(ptr, &header, sizeof(header));
+	ptr += sizeof(header);
+
+	/*
+	**	The frame offsets are only used to seek, which the test does not do.
+	*/
+	Put_Chunk(ptr, "FINF", frames * 4);
+	memset(ptr, 0, frames * 4);
+	ptr += frames * 4;
+
+	for (int frame = 0; frame < frames; frame++) {
+		long framesize = 8 + blocks * 2;
+		if (frame == 0) framesize += 8 + palsize;
+		if (frame == 0 || frame % group == group-1) framesize += 8 + cbsize;
+		Put_Chunk(ptr, "VQFR", framesize);
+
+		if (frame == 0 || frame % group == group-1) {
+			Put_Chunk(ptr, "CBF0", cbsize);
+			for (long index = 0; index < cbsize; index++) {
+				*ptr++ = Random_Byte(seed);
+			}
+		}
+		if (frame == 0) {
+			Put_Chunk(ptr, "CPL0", palsize);
+			for (long index = 0; index < palsize; index++) {
+				*ptr++ = Random_Byte(seed) & 0x3F;
+			}
+		}
+
+		/*
+		**	The low bytes of the block pointers come first and then the high ones, where 0x0F
+		**	marks a block of the one colour in the low byte.
+		*/
+		Put_Chunk(ptr, "VPT0", blocks * 2);
+		for (long index = 0; index < blocks; index++) {
+			static unsigned char const high[] = {0x00, 0x01, 0x0F};
+			ptr[index] = Random_Byte(seed);
+			ptr[blocks + index] = high[Random_Byte(seed) % 3];
+		}
+		ptr += blocks * 2;
+	}
+
+	RawFileClass file(filename);
+	bool written = (file.Write(movie, ptr - movie) == ptr - movie);
+	file.Close();
+	delete [] movie;
+	return(written);
+}
+
+
+/***********************************************************************************************
+ * Test_VQA -- Checks that loading movie frames ahead draws the same frames, and times it.     *
+ *                                                                                             *
+ *    A movie is played twice with no waits between frames: once loading each frame between    *
+ *    drawing them, and once loading them on the read-ahead thread (VQAOPTF_PRELOAD). Every    *
+ *    frame must be drawn, none skipped, and each must come out the same both times. Since     *
+ *    the player draws each frame as soon as it is loaded, the times are how fast the movie    *
+ *    can be loaded and drawn, UnVQ included. The movie is the one given, or else one written  *
+ *    for the test.                                                                            *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  bool; Did all the checks pass?                                                     *
+ *                                                                                             *
+ * WARNINGS:   A movie given must be a plain file; movies in a mixfile cannot be used.         *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+static bool Test_VQA(void)
+{
+	char const * filename = SelfTestFile;
+	bool ok = true;
+
+	if (filename == NULL) {
+		filename = "SELFTEST.VQA";
+		if (!Check(Write_Test_Movie(filename), "write the test movie")) return(false);
+	}
+
+	VQARunType direct;
+	VQARunType ahead;
+	ok = Check(Play_Test_Movie(filename, 0, direct), "play loading between frames") && ok;
+	ok = Check(Play_Test_Movie(filename, VQAOPTF_PRELOAD, ahead), "play loading ahead") && ok;
+	if (ok) {
+		ok = Check(direct.Frames > 0 && direct.Frames == ahead.Frames, "frame count") && ok;
+		ok = Check(direct.Drawn == direct.Frames && ahead.Drawn == ahead.Frames, "every frame drawn") && ok;
+		ok = Check(direct.Stats.FramesSkipped == 0 && ahead.Stats.FramesSkipped == 0, "no frames skipped") && ok;
+		ok = Check(direct.Frames == ahead.Frames && memcmp(direct.CRC, ahead.CRC, direct.Frames * sizeof(direct.CRC[0])) == 0, "same frames drawn") && ok;
+
+		printf("  %ld frames, %ld bytes each\n", direct.Frames, direct.ImageSize);
+		printf("  loading between frames: %.1f ms (%.0f frames/s)\n", direct.Time, direct.Frames * 1000.0 / direct.Time);
+		printf("  loading ahead: %.1f ms (%.0f frames/s)\n", ahead.Time, ahead.Frames * 1000.0 / ahead.Time);
+		printf("  fewest frames queued %ld, loader waits %ld, drawer waits %ld\n", ahead.Stats.MinQueued, ahead.Stats.LoaderWaits, ahead.Stats.DrawerWaits);
+	}
+	delete [] direct.CRC;
+	delete [] ahead.CRC;
+
+	if (filename != SelfTestFile) {
+		RawFileClass(filename).Delete();
+	}
+	return(ok);
+}
+
+
+/*
+**	Draws VQ blocks 4 pixels wide and 2 or 4 high one block at a time, as UnVQ_4x2 and UnVQ_4x4
+**	did before they drew four blocks at once.
+*/
+static void Reference_UnVQ(unsigned char const * codebook, unsigned char const * pointers, unsigned char * buffer, long blocksperrow, long numrows, long bufwidth, int height)
+{
+	long entries = blocksperrow * numrows;
+	int onecolour = (height == 2) ? 0x0F : 0xFF;
+	unsigned char const * pointer = pointers;
+
+	for (long blockrow = 0; blockrow < numrows; blockrow++) {
+		unsigned char * dest = buffer + blockrow * bufwidth * height;
+
+		for (long column = 0; column < blocksperrow; column++) {
+			int low = pointer[0];
+			int high = pointer[entries];
+			pointer++;
+
+			if (high == onecolour) {
+				for (int row = 0; row < height; row++) {
+					memset(dest + row * bufwidth, low, 4);
+				}
+			} else {
+				unsigned char const * codeword = codebook + ((high << 8) | low) * 4 * height;
+				for (int row = 0; row < height; row++) {
+					memcpy(dest + row * bufwidth, codeword + row * 4, 4);
+				}
+			}
+			dest += 4;
+		}
+	}
+}
+
+
+/***********************************************************************************************
+ * Test_UnVQ -- Checks the VQ block drawers against drawing by the block, and times them.      *
+ *                                                                                             *
+ *    UnVQ_4x2 and UnVQ_4x4 draw four blocks at a time where they can. They must draw the      *
+ *    same image as drawing one block at a time does, for rows of any number of blocks, for    *
+ *    buffers wider than the image and with one-colour blocks mixed in, and must not draw      *
+ *    past the image. A 640 by 400 frame of each block size is then drawn both ways to time    *
+ *    them.                                                                                    *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  bool; Did all the checks pass?                                                     *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+static bool Test_UnVQ(void)
+{
+	static unsigned char const high2[] = {0x00, 0x01, 0x02, 0x0F};
+	static unsigned char const high4[] = {0x00, 0x01, 0x02, 0xFF};
+	long const cbsize = 3 * 256 * 4 * 4;
+	long const maxblocks = 640 / 4;
+	long const maxrows = 400 / 2;
+	long const bufsize = (640 + 16) * 400;
+	unsigned long seed = 1;
+	bool ok = true;
+
+	unsigned char * codebook = new unsigned char [cbsize];
+	unsigned char * pointers = new unsigned char [maxblocks * maxrows * 2];
+	unsigned char * expected = new unsigned char [bufsize];
+	unsigned char * drawn = new unsigned char [bufsize];
+	for (long index = 0; index < cbsize; index++) {
+		codebook[index] = Random_Byte(seed);
+	}
+
+	/*
+	**	Draw random images of random sizes both ways. The buffers start out the same so that
+	**	anything drawn outside the image shows up too.
+	*/
+	int const trials = 2000;
+	int mismatches = 0;
+	for (int trial = 0; trial < trials; trial++) {
+		int height = (trial & 1) ? 4 : 2;
+		long blocksperrow = 1 + Random_Byte(seed) % maxblocks;
+		long numrows = 1 + Random_Byte(seed) % 16;
+		long bufwidth = blocksperrow * 4 + (Random_Byte(seed) % 4) * 4;
+		long entries = blocksperrow * numrows;
+		long size = bufwidth * numrows * height + 16;
+
+		for (long index = 0; index < entries; index++) {
+			pointers[index] = Random_Byte(seed);
+			pointers[entries + index] = ((height == 2) ? high2 : high4)[Random_Byte(seed) % 4];
+		}
+
+		memset(expected, 0xCD, size);
+		memset(drawn, 0xCD, size);
+		Reference_UnVQ(codebook, pointers, expected, blocksperrow, numrows, bufwidth, height);
+		if (height == 2) {
+			UnVQ_4x2(codebook, pointers, drawn, blocksperrow, numrows, bufwidth);
+		} else {
+			UnVQ_4x4(codebook, pointers, drawn, blocksperrow, numrows, bufwidth);
+		}
+		if (memcmp(expected, drawn, size) != 0) mismatches++;
+	}
+	ok = Check(mismatches == 0, "same image as drawing a block at a time") && ok;
+	printf("  %d images checked, %d different\n", trials, mismatches);
+
+	/*
+	**	Time a full 640 by 400 frame of each block size.
+	*/
+	for (int height = 2; height <= 4; height += 2) {
+		long numrows = 400 / height;
+		long entries = maxblocks * numrows;
+		for (long index = 0; index < entries; index++) {
+			pointers[index] = Random_Byte(seed);
+			pointers[entries + index] = ((height == 2) ? high2 : high4)[Random_Byte(seed) % 4];
+		}
+
+		int const repeats = 200;
+		double start = MetricsClass::Now();
+		for (int repeat = 0; repeat < repeats; repeat++) {
+			Reference_UnVQ(codebook, pointers, expected, maxblocks, numrows, 640, height);
+		}
+		double single = Milliseconds(start) * 1000.0 / repeats;
+
+		start = MetricsClass::Now();
+		for (int repeat = 0; repeat < repeats; repeat++) {
+			if (height == 2) {
+				UnVQ_4x2(codebook, pointers, drawn, maxblocks, numrows, 640);
+			} else {
+				UnVQ_4x4(codebook, pointers, drawn, maxblocks, numrows, 640);
+			}
+		}
+		double four = Milliseconds(start) * 1000.0 / repeats;
+		printf("  640x400 frame of 4x%d blocks: %.1f us a block at a time, %.1f us with UnVQ_4x%d (%.1fx)\n", height, single, four, height, single / four);
+	}
+
+	delete [] codebook;
+	delete [] pointers;
+	delete [] expected;
+	delete [] drawn;
+	return(ok);
+}
+
+
+/*
+**	Checks that the heap's active objects are those in the list given, in the same order, and
+**	that each one's logical ID is where it is in the list and is recorded as where it was seen.
+*/
+static bool Check_Active(FixedIHeapClass const & heap, void * const * active, int count)
+{
+	if (heap.ActivePointers.Count() != count || heap.Count() != count) return(false);
+	for (int index = 0; index < count; index++) {
+		if (heap.ActivePointers[index] != active[index]) return(false);
+		if (heap.Logical_ID(active[index]) != index) return(false);
+		if (heap.ActiveIndex[heap.ID(active[index])] != index) return(false);
+	}
+	return(true);
+}
+
+
+/***********************************************************************************************
+ * Test_Heap -- Checks heap allocation, freeing and logical IDs, and times them.               *
+ *                                                                                             *
+ *    A heap is filled, has objects freed from it in a random order and is refilled. The       *
+ *    active objects must stay in the order they were allocated in, and each one's logical ID  *
+ *    must be where it is in that order. A heap with no growth step must not grow. Then the    *
+ *    time to free and allocate objects in a full heap, and to find their logical IDs, is      *
+ *    measured, along with finding the IDs by searching from the start.                        *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  bool; Did all the checks pass?                                                     *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+static bool Test_Heap(void)
+{
+	int const count = 4096;
+	unsigned long seed = 1;
+	bool ok = true;
+
+	FixedIHeapClass heap(32);
+	if (!Check(heap.Set_Heap(count), "set heap")) return(false);
+
+	/*
+	**	The list of active objects kept alongside the heap, in the order they were allocated.
+	*/
+	void ** active = new void * [count];
+	int live = 0;
+
+	bool allocated = true;
+	for (int index = 0; index < count; index++) {
+		active[live] = heap.Allocate();
+		allocated = (active[live++] != NULL) && allocated;
+	}
+	ok = Check(allocated, "allocate") && ok;
+	ok = Check(heap.Allocate() == NULL && heap.Length() == count, "full heap does not grow") && ok;
+	ok = Check(Check_Active(heap, active, live), "active objects after allocating") && ok;
+
+	/*
+	**	Free three quarters of them, picked at random, then fill the heap up again. The new
+	**	objects go to the end of the active list.
+	*/
+	while (live > count / 4) {
+		int index = ((Random_Byte(seed) << 8) | Random_Byte(seed)) % live;
+		heap.Free(active[index]);
+		memmove(&active[index], &active[index+1], (live - index - 1) * sizeof(active[0]));
+		live--;
+	}
+	ok = Check(Check_Active(heap, active, live), "active objects after freeing") && ok;
+	while (live < count) {
+		active[live++] = heap.Allocate();
+	}
+	ok = Check(Check_Active(heap, active, live), "active objects after refilling") && ok;
+	int logical = 0;
+	for (int index = 0; index < live; index++) {
+		if (heap.Logical_ID(heap.ID(active[index])) == index) logical++;
+	}
+	ok = Check(logical == live, "logical IDs by ID number") && ok;
+
+	/*
+	**	Time freeing an object at random and allocating another in its place.
+	*/
+	int const churns = 100000;
+	double start = MetricsClass::Now();
+	for (int churn = 0; churn < churns; churn++) {
+		int index = ((Random_Byte(seed) << 8) | Random_Byte(seed)) % count;
+		heap.Free(heap.ActivePointers[index]);
+		heap.Allocate();
+	}
+	double churnms = Milliseconds(start);
+	ok = Check(heap.Count() == count && heap.ActivePointers.Count() == count, "count after freeing and allocating") && ok;
+
+	/*
+	**	Time finding the logical ID of every object, after some objects have been freed so
+	**	that the others have moved down, and the same by searching the active objects from the
+	**	start, as was done before where each object was placed was recorded.
+	*/
+	for (int index = 0; index < count / 8; index++) {
+		heap.Free(heap.ActivePointers[(index * 7) % heap.ActivePointers.Count()]);
+	}
+	live = heap.ActivePointers.Count();
+	for (int index = 0; index < live; index++) {
+		active[index] = heap.ActivePointers[index];
+	}
+
+	int const passes = 20;
+	long found = 0;
+	start = MetricsClass::Now();
+	for (int pass = 0; pass < passes; pass++) {
+		for (int index = 0; index < live; index++) {
+			found += (heap.Logical_ID(active[index]) == index);
+		}
+	}
+	double recordedms = Milliseconds(start);
+
+	long searched = 0;
+	start = MetricsClass::Now();
+	for (int pass = 0; pass < passes; pass++) {
+		for (int index = 0; index < live; index++) {
+			for (int position = 0; position < live; position++) {
+				if (heap.ActivePointers[position] == active[index]) {
+					searched += (position == index);
+					break;
+				}
+			}
+		}
+	}
+	double searchms = Milliseconds(start);
+	ok = Check(found == (long)passes * live && searched == found, "logical IDs after freeing") && ok;
+
+	printf("  free and allocate in a heap of %d: %.0f ns\n", count, churnms * 1000000.0 / churns);
+	printf("  logical ID of %d objects: %.0f ns from where each was placed, %.0f ns searching from the start\n", live, recordedms * 1000000.0 / (passes * live), searchms * 1000000.0 / (passes * live));
+
+	delete [] active;
+	return(ok);
+}
+
+
+/***********************************************************************************************
+ * Test_Heap_Growth -- Checks that heaps grow without moving objects, and times the growth.    *
+ *                                                                                             *
+ *    A heap with a growth step is filled far past the size it was set to. Every object must   *
+ *    keep its address, its ID number and its contents as the heap grows, the index operator   *
+ *    must find it by its ID, and its logical ID must be where it is in the active objects.    *
+ *    Freed objects must be reused before the heap grows again, and it must stop growing at    *
+ *    GROWTH_LIMIT. Then filling a heap that grows is timed against one that was set to the    *
+ *    full size to start with.                                                                 *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  bool; Did all the checks pass?                                                     *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+static bool Test_Heap_Growth(void)
+{
+	int const initial = 100;
+	int const step = 50;
+	int const count = 1000;
+	bool ok = true;
+
+	FixedIHeapClass heap(sizeof(int) * 4);
+	heap.Set_Growth_Step(step);
+	if (!Check(heap.Set_Heap(initial), "set heap")) return(false);
+
+	/*
+	**	Each object is stamped with the order it was allocated in, so that any object that
+	**	moved or was overwritten shows up.
+	*/
+	int ** objects = new int * [count];
+	int * ids = new int [count];
+	bool allocated = true;
+	for (int index = 0; index < count; index++) {
+		objects[index] = (int *)heap.Allocate();
+		if (objects[index] == NULL) {
+			allocated = false;
+			break;
+		}
+		ids[index] = heap.ID(objects[index]);
+		for (int word = 0; word < 4; word++) {
+			objects[index][word] = index * 4 + word;
+		}
+	}
+	ok = Check(allocated, "allocate past the first buffer") && ok;
+	ok = Check(heap.Length() == initial + ((count - initial + step - 1) / step) * step, "grown by whole steps") && ok;
+	ok = Check(heap.Growth_Step() == step && heap.Set_Growth_Step(step * 2) == step, "growth step fixed once grown") && ok;
+
+	if (allocated) {
+		int kept = 0;
+		for (int index = 0; index < count; index++) {
+			bool same = (heap.ID(objects[index]) == ids[index]) && (heap[ids[index]] == objects[index]);
+			same = (heap.Logical_ID(objects[index]) == index) && (heap.ActivePointers[index] == objects[index]) && same;
+			for (int word = 0; word < 4; word++) {
+				same = (objects[index][word] == index * 4 + word) && same;
+			}
+			if (same) kept++;
+		}
+		ok = Check(kept == count, "objects keep their address, ID and contents") && ok;
+
+		/*
+		**	Objects freed from the grown part are handed out again before the heap grows.
+		*/
+		int length = heap.Length();
+		for (int index = initial; index < count; index += 3) {
+			heap.Free(objects[index]);
+		}
+		bool reused = true;
+		for (int index = initial; index < count; index += 3) {
+			void * object = heap.Allocate();
+			reused = (heap.ID(object) >= initial && heap.ID(object) < count) && reused;
+		}
+		ok = Check(reused && heap.Length() == length, "freed objects reused before growing") && ok;
+	}
+
+	/*
+	**	A heap stops growing when it would pass the limit.
+	*/
+	FixedIHeapClass limited(sizeof(int));
+	limited.Set_Growth_Step(4096);
+	limited.Set_Heap(1024);
+	int filled = 0;
+	while (limited.Allocate() != NULL) {
+		filled++;
+		if (filled > FixedHeapClass::GROWTH_LIMIT) break;
+	}
+	ok = Check(filled <= FixedHeapClass::GROWTH_LIMIT && limited.Length() <= FixedHeapClass::GROWTH_LIMIT, "growth limit") && ok;
+	ok = Check(filled == limited.Length() && limited.Length() + 4096 > FixedHeapClass::GROWTH_LIMIT, "grows up to the limit") && ok;
+
+	/*
+	**	Time filling a heap that grows from a small start, and one set to the full size.
+	*/
+	int const fill = 32768;
+	int const passes = 10;
+	double start = MetricsClass::Now();
+	for (int pass = 0; pass < passes; pass++) {
+		FixedIHeapClass growing(64);
+		growing.Set_Growth_Step(256);
+		growing.Set_Heap(256);
+		for (int index = 0; index < fill; index++) growing.Allocate();
+	}
+	double growms = Milliseconds(start) / passes;
+
+	start = MetricsClass::Now();
+	for (int pass = 0; pass < passes; pass++) {
+		FixedIHeapClass sized(64);
+		sized.Set_Heap(fill);
+		for (int index = 0; index < fill; index++) sized.Allocate();
+	}
+	double sizedms = Milliseconds(start) / passes;
+
+	printf("  heap of %d grown to %d for %d objects; heap of 1024 stopped at %d of a limit of %d\n", initial, heap.Length(), count, limited.Length(), (int)FixedHeapClass::GROWTH_LIMIT);
+	printf("  fill %d objects: %.2f ms growing by 256, %.2f ms set to the full size\n", fill, growms, sizedms);
+
+	delete [] objects;
+	delete [] ids;
+	return(ok);
+}
+
+/*
+**	Fills the pixels of a cell in the tactical window with a pattern that is different for
+**	every cell and every terrain it could have.
+*/
+static void Draw_Test_Cell(CellClass const & cell, int x, int y)
+{
+	unsigned long seed = (unsigned long)cell.Cell_Number() * 131 + cell.TType + cell.Overlay * 7 + cell.Smudge * 11;
+	int pitch = LogicPage->Get_XAdd() + LogicPage->Get_Width() + LogicPage->Get_Pitch();
+	unsigned char * dest = LogicPage->Get_Offset() + (y + WindowList[WINDOW_TACTICAL][WINDOWY]) * pitch + x + WindowList[WINDOW_TACTICAL][WINDOWX];
+	for (int row = 0; row < ICON_PIXEL_H; row++) {
+		for (int column = 0; column < ICON_PIXEL_W; column++) {
+			dest[column] = Random_Byte(seed);
+		}
+		dest += pitch;
+	}
+}
+
+
+/***********************************************************************************************
+ * Test_Terrain_Cache -- Checks the terrain cache against drawing each cell, and times it.     *
+ *                                                                                             *
+ *    A tactical window of cells is drawn into a page of its own and stored in a cache. Every  *
+ *    cell fetched back must give the same pixels in the same place, and nothing outside the   *
+ *    window may be touched. A cell whose template, overlay or smudge has changed must not be  *
+ *    found, nor any cell once the cache is flushed. Then fetching a window of cells is timed  *
+ *    against storing it, and against a fetch that finds the cell has changed.                 *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  bool; Did all the checks pass?                                                     *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+static bool Test_Terrain_Cache(void)
+{
+	int const across = 30;
+	int const down = 24;
+	int const left = 10;
+	int const top = 5;
+	int const count = across * down;
+	bool ok = true;
+
+	/*
+	**	The tactical window sits away from the corner of the page, so that a cell copied to
+	**	the wrong place shows up.
+	*/
+	GraphicBufferClass page(across * ICON_PIXEL_W + 40, down * ICON_PIXEL_H + 20);
+	GraphicViewPortClass * oldpage = Set_Logic_Page(page);
+	int oldwindow[8];
+	memcpy(oldwindow, WindowList[WINDOW_TACTICAL], sizeof(oldwindow));
+	WindowList[WINDOW_TACTICAL][WINDOWX] = 16;
+	WindowList[WINDOW_TACTICAL][WINDOWY] = 8;
+	WindowList[WINDOW_TACTICAL][WINDOWWIDTH] = across * ICON_PIXEL_W;
+	WindowList[WINDOW_TACTICAL][WINDOWHEIGHT] = down * ICON_PIXEL_H;
+	page.Lock();
+	int pitch = page.Get_XAdd() + page.Get_Width() + page.Get_Pitch();
+	long size = (long)pitch * page.Get_Height();
+
+	/*
+	**	The cells cross the edges of the chunks the cache is split into.
+	*/
+	CellClass * cells = new CellClass [count];
+	for (int index = 0; index < count; index++) {
+		cells[index].ID = XY_Cell(left + (index % across), top + (index / across));
+		cells[index].TType = TEMPLATE_CLEAR1;
+		cells[index].TIcon = (unsigned char)(index % 16);
+	}
+
+	TerrainCacheClass cache;
+	ok = Check(!cache.Is_Cacheable(-1, 0) && !cache.Is_Cacheable(0, -1), "cells off the top and left not cacheable") && ok;
+	ok = Check(!cache.Is_Cacheable((across - 1) * ICON_PIXEL_W + 1, 0) && !cache.Is_Cacheable(0, (down - 1) * ICON_PIXEL_H + 1), "cells off the bottom and right not cacheable") && ok;
+
+	memset(page.Get_Offset(), '\0', size);
+	int found = 0;
+	int cacheable = 0;
+	for (int index = 0; index < count; index++) {
+		int x = (index % across) * ICON_PIXEL_W;
+		int y = (index / across) * ICON_PIXEL_H;
+		cacheable += cache.Is_Cacheable(x, y);
+		found += cache.Fetch(cells[index], x, y);
+		Draw_Test_Cell(cells[index], x, y);
+		cache.Store(cells[index], x, y);
+	}
+	ok = Check(cacheable == count, "cells in the window cacheable") && ok;
+	ok = Check(found == 0, "nothing found before storing") && ok;
+
+	/*
+	**	Every cell fetched into a cleared page must give back the page as it was drawn.
+	*/
+	unsigned char * drawn = new unsigned char [size];
+	memcpy(drawn, page.Get_Offset(), size);
+	memset(page.Get_Offset(), '\0', size);
+	found = 0;
+	for (int index = 0; index < count; index++) {
+		found += cache.Fetch(cells[index], (index % across) * ICON_PIXEL_W, (index / across) * ICON_PIXEL_H);
+	}
+	ok = Check(found == count, "every stored cell found") && ok;
+	ok = Check(memcmp(drawn, page.Get_Offset(), size) == 0, "fetched page same as drawn") && ok;
+
+	/*
+	**	Changing the terrain of a cell in any way makes it miss.
+	*/
+	cells[0].TIcon++;
+	cells[1].TType = TEMPLATE_WATER;
+	cells[across + 2].Overlay = OVERLAY_GOLD1;
+	cells[across * 2 + 3].OverlayData = 1;
+	cells[count - 2].Smudge = SMUDGE_CRATER1;
+	cells[count - 1].SmudgeData = 1;
+	found = 0;
+	for (int index = 0; index < count; index++) {
+		found += cache.Fetch(cells[index], (index % across) * ICON_PIXEL_W, (index / across) * ICON_PIXEL_H);
+	}
+	ok = Check(found == count - 6, "changed cells not found") && ok;
+
+	/*
+	**	Time fetching a window of cells, storing it, and fetching cells that have changed.
+	*/
+	int const passes = 200;
+	double start = MetricsClass::Now();
+	for (int pass = 0; pass < passes; pass++) {
+		for (int index = 0; index < count; index++) {
+			cache.Store(cells[index], (index % across) * ICON_PIXEL_W, (index / across) * ICON_PIXEL_H);
+		}
+	}
+	double storems = Milliseconds(start);
+
+	found = 0;
+	start = MetricsClass::Now();
+	for (int pass = 0; pass < passes; pass++) {
+		for (int index = 0; index < count; index++) {
+			found += cache.Fetch(cells[index], (index % across) * ICON_PIXEL_W, (index / across) * ICON_PIXEL_H);
+		}
+	}
+	double fetchms = Milliseconds(start);
+	ok = Check(found == count * passes, "every cell found after storing again") && ok;
+
+	for (int index = 0; index < count; index++) {
+		cells[index].SmudgeData++;
+	}
+	found = 0;
+	start = MetricsClass::Now();
+	for (int pass = 0; pass < passes; pass++) {
+		for (int index = 0; index < count; index++) {
+			found += cache.Fetch(cells[index], (index % across) * ICON_PIXEL_W, (index / across) * ICON_PIXEL_H);
+		}
+	}
+	double missms = Milliseconds(start);
+	ok = Check(found == 0, "no cell found after every cell changed") && ok;
+
+	/*
+	**	Nothing is found once the cache is flushed.
+	*/
+	for (int index = 0; index < count; index++) {
+		cells[index].SmudgeData--;
+	}
+	cache.Flush();
+	found = 0;
+	for (int index = 0; index < count; index++) {
+		found += cache.Fetch(cells[index], (index % across) * ICON_PIXEL_W, (index / across) * ICON_PIXEL_H);
+	}
+	ok = Check(found == 0, "nothing found after flushing") && ok;
+
+	printf("  window of %d cells: fetch %.0f ns, store %.0f ns, changed cell %.0f ns per cell\n", count, fetchms * 1000000.0 / (passes * count), storems * 1000000.0 / (passes * count), missms * 1000000.0 / (passes * count));
+
+	page.Unlock();
+	memcpy(WindowList[WINDOW_TACTICAL], oldwindow, sizeof(oldwindow));
+	Set_Logic_Page(oldpage);
+	delete [] drawn;
+	delete [] cells;
+	return(ok);
+}
+
+/*
+**	Counts how many times a piece of text is found in a block of text.
+*/
+static int Count_Text(char const * text, char const * find)
+{
+	int count = 0;
+	for (char const * ptr = strstr(text, find); ptr != NULL; ptr = strstr(ptr + 1, find)) {
+		count++;
+	}
+	return(count);
+}
+
+
+/*
+**	Records scopes on a thread of its own, the way the block worker threads do.
+*/
+static void Profile_Thread(ProfilerClass * profiler, int scopes)
+{
+	for (int index = 0; index < scopes; index++) {
+		profiler->Begin(BENCH_SIDEBAR);
+		profiler->End(BENCH_SIDEBAR);
+	}
+}
+
+
+/***********************************************************************************************
+ * Test_Profiler -- Checks the scopes and trace the profiler records, and times a scope.       *
+ *                                                                                             *
+ *    Nested scopes must each be counted once, with an outer scope taking at least as long as  *
+ *    the scopes inside it. An end with no start, a scope left open when its outer scope ends, *
+ *    and a scope left open from before recording started must not be counted, and scopes      *
+ *    nested too deep are left out. Scopes from another thread must count too. The trace must  *
+ *    hold an event for each scope and the counters of each frame. Then the cost of a scope    *
+ *    is timed with recording on and off, and the ring buffer is checked once it has wrapped.  *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  bool; Did all the checks pass?                                                     *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+static bool Test_Profiler(void)
+{
+	char const * filename = "SELFTEST.JSON";
+	bool ok = true;
+
+	ProfilerClass profiler;
+	ok = Check(!profiler.IsActive && !profiler.Dump(filename), "nothing to dump before recording") && ok;
+
+	/*
+	**	A scope left open before recording starts is not counted when it ends.
+	*/
+	profiler.Start();
+	profiler.Begin(BENCH_AI);
+	profiler.Start();
+	profiler.End(BENCH_AI);
+	ok = Check(profiler.Total_Calls(BENCH_AI) == 0, "scope from before recording") && ok;
+
+	profiler.Begin(BENCH_GAME_FRAME);
+	for (int index = 0; index < 3; index++) {
+		profiler.Begin(BENCH_FINDPATH);
+		profiler.End(BENCH_FINDPATH);
+	}
+	profiler.End(BENCH_GAME_FRAME);
+	ok = Check(profiler.Total_Calls(BENCH_GAME_FRAME) == 1 && profiler.Total_Calls(BENCH_FINDPATH) == 3, "nested scopes counted") && ok;
+	ok = Check(profiler.Total_Time(BENCH_GAME_FRAME) >= profiler.Total_Time(BENCH_FINDPATH), "outer scope takes longer") && ok;
+
+	profiler.End(BENCH_RADAR);
+	profiler.Begin(BENCH_GAME_FRAME);
+	profiler.Begin(BENCH_TACTICAL);
+	profiler.End(BENCH_GAME_FRAME);
+	profiler.End(BENCH_TACTICAL);
+	ok = Check(profiler.Total_Calls(BENCH_RADAR) == 0 && profiler.Total_Calls(BENCH_TACTICAL) == 0, "scopes not started or left open") && ok;
+	ok = Check(profiler.Total_Calls(BENCH_GAME_FRAME) == 2, "outer scope of one left open") && ok;
+
+	int const deep = 40;
+	for (int index = 0; index < deep; index++) {
+		profiler.Begin(BENCH_CELL);
+	}
+	for (int index = 0; index < deep; index++) {
+		profiler.End(BENCH_CELL);
+	}
+	ok = Check(profiler.Total_Calls(BENCH_CELL) == 32, "scopes nested too deep") && ok;
+
+	std::thread thread(Profile_Thread, &profiler, 1000);
+	thread.join();
+	ok = Check(profiler.Total_Calls(BENCH_SIDEBAR) == 1000, "scopes on another thread") && ok;
+
+	/*
+	**	Each frame records how far the counters went up during it.
+	*/
+	PathCount += 5;
+	profiler.Frame();
+	TargetScan += 7;
+	profiler.Frame();
+
+	int events = 1 + 3 + 1 + 32 + 1000;
+	if (Check(profiler.Dump(filename), "dump the trace")) {
+		RawFileClass file(filename);
+		long size = file.Size();
+		char * text = new char [size + 1];
+		file.Read(text, size);
+		file.Close();
+		text[size] = '\0';
+
+		ok = Check(strncmp(text, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", strlen("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[")) == 0 && strcmp(text + size - 4, "\n]}\n") == 0, "trace is one JSON object") && ok;
+		ok = Check(Count_Text(text, "\"ph\":\"X\"") == events, "an event for each scope") && ok;
+		ok = Check(Count_Text(text, "\"name\":\"FindPath\"") == 3 && Count_Text(text, "\"name\":\"Sidebar\"") == 1000, "events named") && ok;
+		ok = Check(Count_Text(text, "\"ph\":\"C\"") == 2, "counters for each frame") && ok;
+		ok = Check(strstr(text, "\"PathCount\":5,\"CellCount\":0,\"TargetScan\":0") != NULL && strstr(text, "\"PathCount\":0,\"CellCount\":0,\"TargetScan\":7") != NULL, "counters of each frame") && ok;
+		delete [] text;
+	}
+
+	/*
+	**	Time a scope with recording on and off, the way the BStart and BEnd macros run it.
+	*/
+	int const scopes = 1000000;
+	profiler.Start();
+	double start = MetricsClass::Now();
+	for (int index = 0; index < scopes; index++) {
+		if (profiler.IsActive) profiler.Begin(BENCH_OBJECTS);
+		if (profiler.IsActive) profiler.End(BENCH_OBJECTS);
+	}
+	double onms = Milliseconds(start);
+	profiler.Frame();
+	ok = Check(profiler.Total_Calls(BENCH_OBJECTS) == (unsigned long)scopes, "every timed scope counted") && ok;
+
+	/*
+	**	Once the ring buffer has wrapped, the trace holds the most recent scopes.
+	*/
+	if (Check(profiler.Dump(filename), "dump the wrapped trace")) {
+		RawFileClass file(filename);
+		long size = file.Size();
+		char * text = new char [size + 1];
+		file.Read(text, size);
+		file.Close();
+		text[size] = '\0';
+		ok = Check(Count_Text(text, "\"ph\":\"X\"") == 1 << 17, "wrapped trace holds a full ring buffer") && ok;
+		delete [] text;
+	}
+	profiler.Stop();
+
+	start = MetricsClass::Now();
+	for (int index = 0; index < scopes; index++) {
+		if (profiler.IsActive) profiler.Begin(BENCH_OBJECTS);
+		if (profiler.IsActive) profiler.End(BENCH_OBJECTS);
+	}
+	double offms = Milliseconds(start);
+	ok = Check(profiler.Total_Calls(BENCH_OBJECTS) == (unsigned long)scopes, "nothing counted when stopped") && ok;
+
+	printf("  scope: %.1f ns recording, %.2f ns stopped\n", onms * 1000000.0 / scopes, offms * 1000000.0 / scopes);
+
+	RawFileClass(filename).Delete();
+	return(ok);
+}
+
+/***********************************************************************************************
+ * Test_Metrics -- Checks the metrics written out for scraping, and times them.                *
+ *                                                                                             *
+ *    Counters and gauges must be written with their help and type lines and their values,     *
+ *    and each histogram sample must be counted in the first bucket that it fits under, with   *
+ *    the buckets written as running totals. The published file must hold the same text with   *
+ *    no temporary file left behind. Then adding to a counter, recording a histogram sample    *
+ *    and writing out the whole registry are timed.                                            *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  bool; Did all the checks pass?                                                     *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+static bool Test_Metrics(void)
+{
+	char const * filename = "SELFTEST.PROM";
+	int const size = 16384;
+	bool ok = true;
+
+	MetricsClass metrics;
+	metrics.Add(METRIC_PATH_COUNT);
+	metrics.Add(METRIC_PATH_COUNT);
+	metrics.Add(METRIC_PATH_COUNT);
+	metrics.Add(METRIC_CELL_COUNT, 2.5);
+	metrics.Set(METRIC_RESPONSE_TIME, 0.125);
+
+	/*
+	**	A sample on a bucket bound falls in that bucket, and one past every bound is only
+	**	counted in the +Inf bucket.
+	*/
+	metrics.Observe(HISTOGRAM_FINDPATH_TIME, 0.00001);
+	metrics.Observe(HISTOGRAM_FINDPATH_TIME, 0.00002);
+	metrics.Observe(HISTOGRAM_FINDPATH_TIME, 0.003);
+	metrics.Observe(HISTOGRAM_FINDPATH_TIME, 2.0);
+
+	char * text = new char [size];
+	memset(text, '\0', size);
+	int length;
+	{
+		BufferPipe pipe(text, size-1);
+		length = metrics.Write(pipe);
+	}
+	ok = Check(length > 0 && length == (int)strlen(text), "registry written") && ok;
+	ok = Check(Count_Text(text, "# HELP ") == METRIC_COUNT + HISTOGRAM_COUNT && Count_Text(text, "# TYPE ") == METRIC_COUNT + HISTOGRAM_COUNT, "help and type of every metric") && ok;
+	ok = Check(strstr(text, "# TYPE redalert_findpath_calls_total counter\nredalert_findpath_calls_total 3\n") != NULL, "counter") && ok;
+	ok = Check(strstr(text, "# TYPE redalert_cells_drawn_total counter\nredalert_cells_drawn_total 2.5\n") != NULL, "counter added to") && ok;
+	ok = Check(strstr(text, "# TYPE redalert_network_response_seconds gauge\nredalert_network_response_seconds 0.125\n") != NULL, "gauge") && ok;
+	ok = Check(strstr(text, "# TYPE redalert_findpath_seconds histogram\n"
+		"redalert_findpath_seconds_bucket{le=\"1e-05\"} 1\n"
+		"redalert_findpath_seconds_bucket{le=\"2.5e-05\"} 2\n") != NULL, "histogram buckets") && ok;
+	ok = Check(strstr(text, "redalert_findpath_seconds_bucket{le=\"0.0025\"} 2\n"
+		"redalert_findpath_seconds_bucket{le=\"0.005\"} 3\n"
+		"redalert_findpath_seconds_bucket{le=\"0.01\"} 3\n"
+		"redalert_findpath_seconds_bucket{le=\"+Inf\"} 4\n"
+		"redalert_findpath_seconds_sum 2.00303\n"
+		"redalert_findpath_seconds_count 4\n") != NULL, "histogram totals") && ok;
+	ok = Check(strstr(text, "redalert_frame_seconds_bucket{le=\"+Inf\"} 0\nredalert_frame_seconds_sum 0\nredalert_frame_seconds_count 0\n") != NULL, "empty histogram") && ok;
+
+	/*
+	**	Publishing writes the same counters to the file, and each frame is timed while the
+	**	registry is being published.
+	*/
+	metrics.Frame();
+	metrics.Start(filename, 3600);
+	metrics.Frame();
+	metrics.Frame();
+	metrics.Stop();
+	ok = Check(!metrics.IsActive && !RawFileClass("SELFTEST.PROM.tmp").Is_Available(), "no temporary file left") && ok;
+
+	RawFileClass file(filename);
+	if (Check(file.Is_Available(), "published file")) {
+		memset(text, '\0', size);
+		file.Read(text, size-1);
+		file.Close();
+		ok = Check(strstr(text, "redalert_frames_total 3\n") != NULL && strstr(text, "redalert_findpath_calls_total 3\n") != NULL, "published counters") && ok;
+		ok = Check(strstr(text, "redalert_frame_seconds_count 2\n") != NULL, "only frames while published timed") && ok;
+		ok = Check(strstr(text, "# TYPE redalert_units gauge\nredalert_units 0\n") != NULL, "heap gauges") && ok;
+		file.Delete();
+	}
+
+	/*
+	**	Time the hooks the game calls and writing out the registry.
+	*/
+	int const samples = 1000000;
+	double start = MetricsClass::Now();
+	for (int index = 0; index < samples; index++) {
+		metrics.Add(METRIC_PATH_COUNT);
+	}
+	double addms = Milliseconds(start);
+
+	start = MetricsClass::Now();
+	for (int index = 0; index < samples; index++) {
+		metrics.Observe(HISTOGRAM_FINDPATH_TIME, (index & 1023) * 0.00001);
+	}
+	double observems = Milliseconds(start);
+
+	int const writes = 1000;
+	start = MetricsClass::Now();
+	for (int index = 0; index < writes; index++) {
+		BufferPipe pipe(text, size-1);
+		metrics.Write(pipe);
+	}
+	double writems = Milliseconds(start);
+
+	printf("  add %.2f ns, histogram sample %.1f ns, write %d bytes %.1f us\n", addms * 1000000.0 / samples, observems * 1000000.0 / samples, length, writems * 1000.0 / writes);
+
+	delete [] text;
+	return(ok);
+}
+
+/***********************************************************************************************
+ * Test_Distance -- Checks measuring distance lists against Distance, and times it.            *
+ *                                                                                             *
+ *    Every coordinate on the map is measured from two opposite corners of it, which tries     *
+ *    every distance along each axis in both directions, and the distances that Distance_List  *
+ *    gives must match what Distance gives for each one. Then lists of random coordinates      *
+ *    anywhere, of every length up to 64 and not aligned, are measured from random origins.    *
+ *    Last, measuring a list is timed against measuring each coordinate on its own.            *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  bool; Did all the checks pass?                                                     *
+ *                                                                                             *
+ * WARNINGS:   This measures over two billion distances, so it takes some seconds.             *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+static bool Test_Distance(void)
+{
+	int const across = MAP_CELL_W * CELL_LEPTON_W;
+	int const size = across + 3;
+	bool ok = true;
+
+	COORDINATE * list = new COORDINATE [size];
+	int * distances = new int [size];
+
+	/*
+	**	Each row of the map is one list. The three extra coordinates leave some over for the
+	**	part that is measured one at a time.
+	*/
+	COORDINATE const corners[2] = {XY_Coord(0, 0), XY_Coord(across-1, across-1)};
+	long mismatched = 0;
+	double start = MetricsClass::Now();
+	for (int corner = 0; corner < 2; corner++) {
+		for (int y = 0; y < across; y++) {
+			for (int x = 0; x < across; x++) {
+				list[x] = XY_Coord(x, y);
+			}
+			for (int index = across; index < size; index++) {
+				list[index] = XY_Coord(y, index - across);
+			}
+			Distance_List(corners[corner], list, distances, size);
+			for (int index = 0; index < size; index++) {
+				mismatched += (distances[index] != Distance(corners[corner], list[index]));
+			}
+		}
+	}
+	double mapms = Milliseconds(start);
+	ok = Check(mismatched == 0, "every distance on the map") && ok;
+
+	unsigned long seed = 12345;
+	mismatched = 0;
+	for (int pass = 0; pass < 100000; pass++) {
+		COORDINATE origin = 0;
+		for (int index = 0; index < 4; index++) {
+			origin = (origin << 8) | Random_Byte(seed);
+		}
+		int offset = pass % 4;
+		int count = (pass / 4) % 65;
+		for (int index = 0; index < offset + count; index++) {
+			COORDINATE coord = 0;
+			for (int byte = 0; byte < 4; byte++) {
+				coord = (coord << 8) | Random_Byte(seed);
+			}
+			list[index] = coord;
+		}
+		distances[offset + count] = -1;
+		Distance_List(origin, &list[offset], &distances[offset], count);
+		for (int index = 0; index < count; index++) {
+			mismatched += (distances[offset + index] != Distance(origin, list[offset + index]));
+		}
+		mismatched += (distances[offset + count] != -1);
+	}
+	ok = Check(mismatched == 0, "random coordinates and lengths") && ok;
+
+	/*
+	**	Time lists the length of the batches that the team scan measures.
+	*/
+	int const length = 256;
+	int const passes = 200000;
+	long total = 0;
+	start = MetricsClass::Now();
+	for (int pass = 0; pass < passes; pass++) {
+		COORDINATE origin = list[pass & 1023];
+		for (int index = 0; index < length; index++) {
+			total += Distance(origin, list[index + (pass & 7)]);
+		}
+	}
+	double singlems = Milliseconds(start);
+
+	start = MetricsClass::Now();
+	for (int pass = 0; pass < passes; pass++) {
+		COORDINATE origin = list[pass & 1023];
+		Distance_List(origin, &list[pass & 7], distances, length);
+		for (int index = 0; index < length; index++) {
+			total -= distances[index];
+		}
+	}
+	double listms = Milliseconds(start);
+	ok = Check(total == 0, "same total timed both ways") && ok;
+
+	printf("  %.0f ms to check every distance on the map from two corners\n", mapms);
+	printf("  distance: %.2f ns one at a time, %.2f ns in lists of %d\n", singlems * 1000000.0 / ((double)passes * length), listms * 1000000.0 / ((double)passes * length), length);
+
+	delete [] list;
+	delete [] distances;
+	return(ok);
+}
+
+
+/*
+**	The game state that the checkpoint test takes checkpoints of. It is laid out the way a save
+**	game is: some data, a heap of objects, more data, the map cells, and then the rest.
+*/
+struct CheckpointTestType {
+	enum {
+		OBJECTS=500,
+		OBJECT_SIZE=200,
+		CELLS=1200,
+		CELL_SIZE=60,
+		DATA_SIZE=1500
+	};
+	unsigned char Data[3][DATA_SIZE];
+	bool Alive[OBJECTS];
+	unsigned char Objects[OBJECTS][OBJECT_SIZE];
+	bool Saved[CELLS];
+	unsigned char Cells[CELLS][CELL_SIZE];
+};
+
+
+/*
+**	Captures a checkpoint image of the test game state. The objects and cells are put and
+**	marked just as Put_All puts and marks the heaps and the map.
+*/
+static void Capture_Test_State(CheckpointClass & checkpoint, CheckpointTestType const & state)
+{
+	Pipe & pipe = checkpoint.Capture();
+	pipe.Put(state.Data[0], sizeof(state.Data[0]));
+
+	checkpoint.Mark_Table(sizeof(int), CheckpointTestType::OBJECT_SIZE);
+	int count = 0;
+	for (int index = 0; index < CheckpointTestType::OBJECTS; index++) {
+		count += state.Alive[index];
+	}
+	pipe.Put(&count, sizeof(count));
+	for (int index = 0; index < CheckpointTestType::OBJECTS; index++) {
+		if (state.Alive[index]) {
+			pipe.Put(&index, sizeof(index));
+			pipe.Put(state.Objects[index], CheckpointTestType::OBJECT_SIZE);
+		}
+	}
+
+	checkpoint.Mark_Table(sizeof(short), CheckpointTestType::CELL_SIZE, sizeof(state.Data[1]));
+	pipe.Put(state.Data[1], sizeof(state.Data[1]));
+	count = 0;
+	for (short cell = 0; cell < CheckpointTestType::CELLS; cell++) {
+		count += state.Saved[cell];
+	}
+	pipe.Put(&count, sizeof(count));
+	for (short cell = 0; cell < CheckpointTestType::CELLS; cell++) {
+		if (state.Saved[cell]) {
+			pipe.Put(&cell, sizeof(cell));
+			pipe.Put(state.Cells[cell], CheckpointTestType::CELL_SIZE);
+		}
+	}
+
+	pipe.Put(state.Data[2], sizeof(state.Data[2]));
+}
+
+
+/*
+**	Fetches the size of a file, or zero if there is no such file.
+*/
+static long Test_File_Size(char const * name)
+{
+	RawFileClass file(name);
+	if (!file.Is_Available()) return(0);
+	return(file.Size());
+}
+
+
+/***********************************************************************************************
+ * Test_Checkpoint -- Checks that a chain of checkpoints reads back, and times it.             *
+ *                                                                                             *
+ *    A base checkpoint of a made up game state is written, and then deltas as the state       *
+ *    plays on: each step an object is made in the first free heap slot and another is         *
+ *    removed, which moves every object after them in the image, and a few objects, cells      *
+ *    and other data change. Each delta must store only the records that changed, and so be    *
+ *    much smaller than the base. Reading the chain back must give the last image, reading     *
+ *    to an earlier frame must give the image of that frame, a cut off delta must end the      *
+ *    chain before it, and another version must read nothing.                                  *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  bool; Did all the checks pass?                                                     *
+ *                                                                                             *
+ * WARNINGS:   This writes and then removes the files SELFTEST.000 to SELFTEST.010.            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+static bool Test_Checkpoint(void)
+{
+	int const steps = 10;
+	unsigned long const version = 0x1234;
+	char name[_MAX_FNAME+_MAX_EXT];
+	bool ok = true;
+
+	CheckpointTestType * state = new CheckpointTestType;
+	unsigned long seed = 54321;
+	for (int index = 0; index < 3; index++) {
+		for (int pos = 0; pos < CheckpointTestType::DATA_SIZE; pos++) {
+			state->Data[index][pos] = Random_Byte(seed);
+		}
+	}
+	for (int index = 0; index < CheckpointTestType::OBJECTS; index++) {
+		state->Alive[index] = (index % 5) != 0;
+		for (int pos = 0; pos < CheckpointTestType::OBJECT_SIZE; pos++) {
+			state->Objects[index][pos] = Random_Byte(seed);
+		}
+	}
+	for (int cell = 0; cell < CheckpointTestType::CELLS; cell++) {
+		state->Saved[cell] = (cell % 3) == 0;
+		for (int pos = 0; pos < CheckpointTestType::CELL_SIZE; pos++) {
+			state->Cells[cell][pos] = Random_Byte(seed);
+		}
+	}
+
+	/*
+	**	Write the chain, keeping each image to compare with what is read back.
+	*/
+	char * images[steps+1];
+	int sizes[steps+1];
+	long filesizes[steps+1];
+	int maxchanged = 0;
+	double writems = 0;
+	CheckpointClass writer("SELFTEST");
+	for (int step = 0; step <= steps; step++) {
+		if (step > 0) {
+			int slot = 0;
+			while (state->Alive[slot]) slot++;
+			state->Alive[slot] = true;
+
+			int dead = 100 + (Random_Byte(seed) % 300);
+			while (!state->Alive[dead]) dead++;
+			state->Alive[dead] = false;
+
+			for (int index = 0; index < 3; index++) {
+				int object = Random_Byte(seed) % CheckpointTestType::OBJECTS;
+				state->Objects[object][Random_Byte(seed) % CheckpointTestType::OBJECT_SIZE]++;
+				state->Cells[(Random_Byte(seed) % 400) * 3][Random_Byte(seed) % CheckpointTestType::CELL_SIZE]++;
+			}
+			state->Data[2][Random_Byte(seed)]++;
+		}
+
+		double start = MetricsClass::Now();
+		Capture_Test_State(writer, *state);
+		bool written = writer.Write(version, false, step * 100);
+		writems += Milliseconds(start);
+		ok = Check(written && writer.Get_Sequence() == step, "checkpoint written") && ok;
+
+		sizes[step] = writer.Get_Size();
+		images[step] = new char [sizes[step]];
+		memcpy(images[step], writer.Get_Image(), sizes[step]);
+		sprintf(name, "SELFTEST.%03d", step);
+		filesizes[step] = Test_File_Size(name);
+
+		if (step == 0) {
+			ok = Check(writer.Get_Changed() == writer.Get_Records(), "base stores every record") && ok;
+		} else if (writer.Get_Changed() > maxchanged) {
+			maxchanged = writer.Get_Changed();
+		}
+	}
+	ok = Check(maxchanged <= 12, "deltas store only the changed records") && ok;
+
+	long deltasizes = 0;
+	for (int step = 1; step <= steps; step++) {
+		deltasizes += filesizes[step];
+		ok = Check(filesizes[step] > 0 && filesizes[step] * 10 < filesizes[0], "deltas much smaller than the base") && ok;
+	}
+
+	/*
+	**	Read the whole chain back.
+	*/
+	double start = MetricsClass::Now();
+	CheckpointClass reader("SELFTEST");
+	bool read = reader.Read(version);
+	double readms = Milliseconds(start);
+	ok = Check(read && reader.Get_Sequence() == steps && reader.Get_Size() == sizes[steps] && memcmp(reader.Get_Image(), images[steps], sizes[steps]) == 0, "chain reads back the last image") && ok;
+
+	/*
+	**	Stop at an earlier frame.
+	*/
+	CheckpointClass early("SELFTEST");
+	read = early.Read(version, 550);
+	ok = Check(read && early.Get_Sequence() == 5 && early.Get_Frame() == 500 && early.Get_Size() == sizes[5] && memcmp(early.Get_Image(), images[5], sizes[5]) == 0, "frame limit reads an earlier image") && ok;
+
+	/*
+	**	A delta cut off part way through, as by a crash, ends the chain.
+	*/
+	sprintf(name, "SELFTEST.%03d", 7);
+	{
+		RawFileClass file(name);
+		long length = file.Size();
+		char * data = new char [length];
+		file.Open(READ);
+		file.Read(data, length);
+		file.Close();
+		file.Open(WRITE);
+		file.Write(data, length / 2);
+		file.Close();
+		delete [] data;
+	}
+	CheckpointClass cut("SELFTEST");
+	read = cut.Read(version);
+	ok = Check(read && cut.Get_Sequence() == 6 && cut.Get_Size() == sizes[6] && memcmp(cut.Get_Image(), images[6], sizes[6]) == 0, "cut off delta ends the chain") && ok;
+
+	CheckpointClass other("SELFTEST");
+	ok = Check(!other.Read(version + 1) && other.Get_Sequence() == -1, "other version reads nothing") && ok;
+
+	printf("  base %ld bytes, deltas %ld bytes on average, at most %d of %d records stored\n", filesizes[0], deltasizes / steps, maxchanged, writer.Get_Records());
+	printf("  %.2f ms to capture and write each checkpoint, %.2f ms to read the chain\n", writems / (steps + 1), readms);
+
+	for (int step = 0; step <= steps; step++) {
+		delete [] images[step];
+		sprintf(name, "SELFTEST.%03d", step);
+		RawFileClass(name).Delete();
+	}
+	delete state;
+	return(ok);
+}
+
+
+/*
+**	The base buildings that the placement test sets down, and the types that it finds spots
+**	for. They run from one cell to three by three, with and without bibs, and include a wall.
+*/
+static StructType const PlacementBases[] = {STRUCT_POWER, STRUCT_BARRACKS, STRUCT_REFINERY, STRUCT_WEAP, STRUCT_PILLBOX};
+static StructType const PlacementTypes[] = {STRUCT_POWER, STRUCT_REFINERY, STRUCT_PILLBOX, STRUCT_SAM, STRUCT_SANDBAG_WALL};
+
+
+/***********************************************************************************************
+ * Reference_Find_Cell -- Finds a spot in a zone by checking every square of every cell.       *
+ *                                                                                             *
+ *    This is how the spot for an object was found before the clear cells were put in a table. *
+ *    Every cell in the zone has its whole foundation and its proximity checked, and the       *
+ *    closest legal one to the picked cell is kept.                                            *
+ *                                                                                             *
+ * INPUT:   house    -- The house whose zone it is.                                            *
+ *                                                                                             *
+ *          techno   -- The object to find a spot for.                                         *
+ *                                                                                             *
+ *          zone     -- The zone to find a spot within.                                        *
+ *                                                                                             *
+ * OUTPUT:  Returns with the closest legal cell, or 0 if there is none.                        *
+ *                                                                                             *
+ * WARNINGS:   This picks a random cell the same way that Find_Cell_In_Zone does.              *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+static CELL Reference_Find_Cell(HouseClass const * house, TechnoClass const * techno, ZoneType zone)
+{
+	int bestval = -1;
+	int bestcell = 0;
+	TechnoTypeClass const * ttype = techno->Techno_Type_Class();
+	CELL trycell = house->Random_Cell_In_Zone(zone);
+
+	short const * list = NULL;
+	if (techno->What_Am_I() == RTTI_BUILDING) {
+		list = techno->Occupy_List(true);
+	}
+
+	for (CELL cell = 0; cell < MAP_CELL_TOTAL; cell++) {
+		if (Map.In_Radar(cell) && house->Which_Zone(cell) != ZONE_NONE) {
+			bool ok = ttype->Legal_Placement(cell);
+			if (ok && list != NULL && !Map.Passes_Proximity_Check(ttype, techno->House->Class->House, list, cell)) {
+				ok = false;
+			}
+			if (ok) {
+				int dist = Distance(Cell_Coord(cell), Cell_Coord(trycell));
+				if (bestval == -1 || dist < bestval) {
+					bestval = dist;
+					bestcell = cell;
+				}
+			}
+		}
+	}
+	return(bestcell);
+}
+
+
+/***********************************************************************************************
+ * Test_Placement -- Checks finding building spots against a full scan, and times it.          *
+ *                                                                                             *
+ *    Two houses each set down a base on a map strewn with walls, ore, bibs and craters. For   *
+ *    every cell, checking a foundation against a table of clear cells must agree with         *
+ *    checking each of its squares. Then the spot that each house finds in each of its zones,  *
+ *    for buildings of every size, must be the cell that checking every square of every cell   *
+ *    finds, with the random pick the same for both. Last, finding a spot is timed both ways.  *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  bool; Did all the checks pass?                                                     *
+ *                                                                                             *
+ * WARNINGS:   This sets up the map, the house and building heaps and their types, which the   *
+ *             game would then have to set up again.                                           *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+static bool Test_Placement(void)
+{
+	bool ok = true;
+
+	/*
+	**	The types are made from the tables built into the game. A house takes its name from
+	**	the string table, so it is given one in which every string is empty.
+	*/
+	static unsigned short const _strings[TXT_COMPUTER+1] = {0};
+	char const * oldstrings = SystemStrings;
+	HouseClass * oldplayer = PlayerPtr;
+	GroundType oldground[LAND_COUNT];
+	memcpy(oldground, Ground, sizeof(oldground));
+	SystemStrings = (char const *)_strings;
+
+	HouseTypes.Set_Heap(HOUSE_COUNT);
+	BuildingTypes.Set_Heap(STRUCT_COUNT);
+	UnitTypes.Set_Heap(UNIT_COUNT);
+	OverlayTypes.Set_Heap(OVERLAY_COUNT);
+	SmudgeTypes.Set_Heap(SMUDGE_COUNT);
+	HouseTypeClass::Init_Heap();
+	BuildingTypeClass::Init_Heap();
+	UnitTypeClass::Init_Heap();
+	OverlayTypeClass::Init_Heap();
+	SmudgeTypeClass::Init_Heap();
+	Houses.Set_Heap(HOUSE_MAX);
+	Buildings.Set_Heap(Rule.BuildingMax);
+
+	/*
+	**	Clear land and roads can be built upon and driven over, walls cannot be crossed, and
+	**	ore can be crossed but not built upon, as the rules file has it.
+	*/
+	static char const _lands[] =
+		"[Clear]\r\nBuildable=yes\r\n"
+		"[Road]\r\nBuildable=yes\r\n"
+		"[Wall]\r\nFoot=0%\r\nTrack=0%\r\nWheel=0%\r\nFloat=0%\r\n"
+		"[Ore]\r\nFoot=90%\r\nTrack=70%\r\nWheel=50%\r\nFloat=0%\r\n";
+	CCINIClass rules;
+	BufferStraw straw(_lands, strlen(_lands));
+	rules.Load(straw, false);
+	Rule.Land_Types(rules);
+
+	/*
+	**	Setting up the map clears the hidden page, so it is given one the way the game does.
+	*/
+	HiddenPage.Init(640, 400, NULL, 0, (GBC_Enum)0);
+	HidPage.Attach(&HiddenPage, 0, 0, 640, 400);
+	Map.MapClass::One_Time();
+	Map.MapClass::Init_Clear();
+	Map.Set_Map_Dimensions(16, 16, 96, 96);
+
+	HouseClass * houses[2];
+	houses[0] = new HouseClass(HOUSE_GREECE);
+	houses[1] = new HouseClass(HOUSE_USSR);
+	PlayerPtr = houses[1];
+
+	/*
+	**	Strew the map. The walls belong to one house or the other, so that walls can be placed
+	**	next to them.
+	*/
+	unsigned long seed = 54321;
+	for (CELL cell = 0; cell < MAP_CELL_TOTAL; cell++) {
+		if (!Map.In_Radar(cell)) continue;
+
+		CellClass & mapcell = Map[cell];
+		int pick = Random_Byte(seed) % 100;
+		if (pick < 6) {
+			mapcell.Overlay = OVERLAY_SANDBAG_WALL;
+			mapcell.Owner = houses[pick & 1]->Class->House;
+		} else if (pick < 12) {
+			mapcell.Overlay = OVERLAY_GOLD1;
+		} else if (pick < 15) {
+			mapcell.Smudge = SMUDGE_BIB3;
+		} else if (pick < 20) {
+			mapcell.Smudge = SMUDGE_CRATER1;
+		}
+		mapcell.Recalc_Attributes();
+	}
+
+	/*
+	**	Each house sets its base down around its center, wherever the buildings fit.
+	*/
+	CELL const centers[2] = {XY_Cell(44, 52), XY_Cell(84, 72)};
+	int const bases = 30;
+	BuildingClass * buildings[2][bases];
+	int placed = 0;
+	for (int owner = 0; owner < 2; owner++) {
+		houses[owner]->Center = Cell_Coord(centers[owner]);
+		houses[owner]->Radius = 5 * CELL_LEPTON_W;
+
+		for (int index = 0; index < bases; index++) {
+			StructType type = PlacementBases[index % ARRAY_SIZE(PlacementBases)];
+			buildings[owner][index] = new BuildingClass(type, houses[owner]->Class->House);
+			for (int tries = 0; tries < 50; tries++) {
+				int x = Cell_X(centers[owner]) - 12 + (Random_Byte(seed) % 24);
+				int y = Cell_Y(centers[owner]) - 12 + (Random_Byte(seed) % 24);
+				CELL cell = XY_Cell(x, y);
+				if (BuildingTypeClass::As_Reference(type).Legal_Placement(cell)) {
+					for (short const * offset = buildings[owner][index]->Occupy_List(); *offset != REFRESH_EOL; offset++) {
+						Map[(CELL)(cell + *offset)].Occupy_Down(buildings[owner][index]);
+					}
+					placed++;
+					break;
+				}
+			}
+		}
+	}
+
+	/*
+	**	Every cell, on the map or off it, must give the same answer both ways, for every size
+	**	of building and for a unit, which only needs the cell to be clear to move into.
+	*/
+	static unsigned char _clear[MAP_CELL_TOTAL];
+	TechnoTypeClass const * ttypes[ARRAY_SIZE(PlacementTypes) + 1];
+	for (int index = 0; index < ARRAY_SIZE(PlacementTypes); index++) {
+		ttypes[index] = &BuildingTypeClass::As_Reference(PlacementTypes[index]);
+	}
+	ttypes[ARRAY_SIZE(PlacementTypes)] = &UnitTypeClass::As_Reference(UNIT_HTANK);
+
+	long legal = 0;
+	long mismatched = 0;
+	for (int index = 0; index < ARRAY_SIZE(ttypes); index++) {
+		for (CELL cell = 0; cell < MAP_CELL_TOTAL; cell++) {
+			_clear[cell] = ttypes[index]->Is_Clear_Foundation(cell);
+		}
+		for (CELL cell = 0; cell < MAP_CELL_TOTAL; cell++) {
+			bool full = (ttypes[index]->Legal_Placement(cell) != 0);
+			mismatched += (full != (ttypes[index]->Legal_Placement(cell, _clear) != 0));
+			legal += full;
+		}
+		mismatched += (ttypes[index]->Legal_Placement(-1, _clear) != 0);
+	}
+	ok = Check(placed > bases, "bases set down") && ok;
+	ok = Check(legal > 0 && legal < (long)ARRAY_SIZE(ttypes) * 96 * 96, "some cells legal and some not") && ok;
+	ok = Check(mismatched == 0, "table placement same as checking each square") && ok;
+
+	/*
+	**	Each house looks for a spot in each of its zones, for each type, a number of times.
+	**	The random number is put back before checking every square, so both pick the same cell.
+	**	Every other time the house looks far from its base, where only walls can go.
+	*/
+	BuildingClass * technos[2][ARRAY_SIZE(PlacementTypes)];
+	for (int owner = 0; owner < 2; owner++) {
+		for (int index = 0; index < ARRAY_SIZE(PlacementTypes); index++) {
+			technos[owner][index] = new BuildingClass(PlacementTypes[index], houses[owner]->Class->House);
+		}
+	}
+
+	int found = 0;
+	int tried = 0;
+	mismatched = 0;
+	for (int trial = 0; trial < 4; trial++) {
+		for (int owner = 0; owner < 2; owner++) {
+			houses[owner]->Center = Cell_Coord((trial & 1) ? XY_Cell(24, 104) : centers[owner]);
+			for (int index = 0; index < ARRAY_SIZE(PlacementTypes); index++) {
+				for (ZoneType zone = ZONE_FIRST; zone < ZONE_COUNT; zone++) {
+					RandomClass random = Scen.RandomNumber;
+					CELL cell = houses[owner]->Find_Cell_In_Zone(technos[owner][index], zone);
+					Scen.RandomNumber = random;
+					mismatched += (cell != Reference_Find_Cell(houses[owner], technos[owner][index], zone));
+					found += (cell != 0);
+					tried++;
+				}
+			}
+		}
+	}
+	ok = Check(found > 0 && found < tried, "spots found in some zones and not others") && ok;
+	ok = Check(mismatched == 0, "same spot as checking every square") && ok;
+
+	/*
+	**	Time looking for a power plant spot in each zone of the base both ways.
+	*/
+	houses[0]->Center = Cell_Coord(centers[0]);
+	int const passes = 10;
+	RandomClass random = Scen.RandomNumber;
+	CELL total = 0;
+	double start = MetricsClass::Now();
+	for (int pass = 0; pass < passes; pass++) {
+		for (ZoneType zone = ZONE_FIRST; zone < ZONE_COUNT; zone++) {
+			total += houses[0]->Find_Cell_In_Zone(technos[0][0], zone);
+		}
+	}
+	double tablems = Milliseconds(start);
+
+	Scen.RandomNumber = random;
+	start = MetricsClass::Now();
+	for (int pass = 0; pass < passes; pass++) {
+		for (ZoneType zone = ZONE_FIRST; zone < ZONE_COUNT; zone++) {
+			total -= Reference_Find_Cell(houses[0], technos[0][0], zone);
+		}
+	}
+	double fullms = Milliseconds(start);
+	ok = Check(total == 0, "same spots timed both ways") && ok;
+
+	printf("  %d of %d buildings set down, %d of %d searches found a spot\n", placed, bases * 2, found, tried);
+	printf("  finding a spot: %.2f ms with the table, %.2f ms checking every square\n", tablems / (passes * ZONE_COUNT), fullms / (passes * ZONE_COUNT));
+
+	/*
+	**	Clear the map before the buildings that occupy it go.
+	*/
+	Map.MapClass::Init_Clear();
+	for (int owner = 0; owner < 2; owner++) {
+		for (int index = 0; index < bases; index++) {
+			delete buildings[owner][index];
+		}
+		for (int index = 0; index < ARRAY_SIZE(PlacementTypes); index++) {
+			delete technos[owner][index];
+		}
+		delete houses[owner];
+	}
+	memcpy(Ground, oldground, sizeof(oldground));
+	SystemStrings = oldstrings;
+	PlayerPtr = oldplayer;
+	return(ok);
+}
+
+
+static SelfTestType const SelfTests[] = {
+	{"INI", Test_INI},
+	{"STRAW", Test_Straw},
+	{"BLOWFISH", Test_Blowfish},
+	{"MODEXP", Test_Modexp},
+	{"VQA", Test_VQA},
+	{"UNVQ", Test_UnVQ},
+	{"HEAP", Test_Heap},
+	{"HEAPGROW", Test_Heap_Growth},
+	{"TCACHE", Test_Terrain_Cache},
+	{"PROFILER", Test_Profiler},
+	{"METRICS", Test_Metrics},
+	{"DISTANCE", Test_Distance},
+	{"CHECKPOINT", Test_Checkpoint},
+	{"PLACEMENT", Test_Placement},
+};
+
+
+/***********************************************************************************************
+ * Self_Test -- Runs the self tests and benchmarks named on the command line.                  *
+ *                                                                                             *
+ *    Each test prints its name, any check that failed and its timings, and then whether it    *
+ *    passed.                                                                                  *
+ *                                                                                             *
+ * INPUT:   name  -- The name of the test to run, or an empty string to run them all. A file   *
+ *                   for the test may follow the name after an "=".                            *
+ *                                                                                             *
+ * OUTPUT:  Returns with the code that the game should exit with: EXIT_SUCCESS if every test   *
+ *          run passed.                                                                        *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+int Self_Test(char const * name)
+{
+	int run = 0;
+	int failed = 0;
+
+	/*
+	**	Split off the file given to the test, if there is one.
+	*/
+	char wanted[_MAX_PATH];
+	strncpy(wanted, name, sizeof(wanted)-1);
+	wanted[sizeof(wanted)-1] = '\0';
+	char * file = strchr(wanted, '=');
+	if (file != NULL) {
+		*file++ = '\0';
+		SelfTestFile = file;
+	}
+
+	for (int index = 0; index < (int)(sizeof(SelfTests) / sizeof(SelfTests[0])); index++) {
+		if (*wanted != '\0' && stricmp(wanted, SelfTests[index].Name) != 0) continue;
+
+		printf("%s\n", SelfTests[index].Name);
+		bool ok = SelfTests[index].Test();
+		printf("%s: %s\n", SelfTests[index].Name, ok ? "ok" : "FAILED");
+		run++;
+		if (!ok) failed++;
+	}
+
+	if (run == 0) {
+		printf("Unknown self test: %s\n", wanted);
+		return(EXIT_FAILURE);
+	}
+	printf("%d of %d self tests passed.\n", run - failed, run);
+	return((failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
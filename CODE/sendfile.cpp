@@ -490,6 +490,11 @@ bool Receive_Remote_File ( char *file_name, unsigned int file_length, int gamety
 
 	save_file.Close();
 
+	/*
+	** The file was written behind the file search index's back.
+	*/
+	CCFileClass::Invalidate_Index();
+
 	/*
 	** Update the internal list of scenarios to include the downloaded one so we know about it
 	**  for the next game.
@@ -182,6 +182,10 @@ SessionClass::SessionClass(void)
 	MaxAhead = 5;
 	FrameSendRate = DEFAULT_FRAME_SEND_RATE;
 
+	LatencyAverage = 0;
+	LatencyPercentile = 0;
+	LatencyJitter = 0;
+
 	LoadGame = 0;
 	EmergencySave = 0;
 
@@ -576,6 +576,14 @@ class SessionClass
 
 		int			DesiredFrameRate;
 
+		//.....................................................................
+		// Connection response times seen by the MaxAhead controller, in
+		// ticks; updated each time a timing event is generated.
+		//.....................................................................
+		unsigned long LatencyAverage;
+		unsigned long LatencyPercentile;
+		unsigned long LatencyJitter;
+
 		int			ProcessTimer;
 		int			ProcessTicks;
 		int			ProcessFrames;
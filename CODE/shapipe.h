@@ -49,8 +49,10 @@
 class SHAPipe : public Pipe
 {
 	public:
-		SHAPipe(void) {}
+		SHAPipe(void) : Space(NULL), SpaceLength(0) {}
 		virtual int Put(void const * source, int slen);
+		virtual int Reserve(void * & buffer, int slen);
+		virtual int Commit(int slen);
 
 		// Fetch the SHA hash value (stored in result buffer -- 20 bytes long).
 		int Result(void * result) const;
@@ -59,6 +61,13 @@ class SHAPipe : public Pipe
 		SHAEngine SHA;
 
 	private:
+		/*
+		**	The space last handed out by Reserve. The data is run through the hash
+		**	as it is committed.
+		*/
+		void * Space;
+		int SpaceLength;
+
 		SHAPipe(SHAPipe & rvalue);
 		SHAPipe & operator = (SHAPipe const & pipe);
 };
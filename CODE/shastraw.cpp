@@ -33,7 +33,9 @@
  *                                                                                             *
  *---------------------------------------------------------------------------------------------*
  * Functions:                                                                                  *
+ *   SHAStraw::Consume -- Remove the data looked at and process the SHA with it.               *
  *   SHAStraw::Get -- Fetch data from the straw and process the SHA with the data.             *
+ *   SHAStraw::Peek -- Look at the data in the straw without copying it.                       *
  *   SHAStraw::Result -- Fetches the current SHA digest.                                       *
  * - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
 
@@ -94,3 +96,65 @@ int SHAStraw::Result(void * result) const
 {
 	return(SHA.Result(result));
 }
+
+
+/***********************************************************************************************
+ * SHAStraw::Peek -- Look at the data in the straw without copying it.                         *
+ *                                                                                             *
+ *    The view is passed along from the straw segment that feeds this one. The data is not     *
+ *    submitted to the SHA processor until it is consumed, since it may be looked at again.    *
+ *                                                                                             *
+ * INPUT:   buffer   -- Reference to the pointer that will be set to the start of the data.    *
+ *                                                                                             *
+ *          slen     -- The number of bytes requested.                                         *
+ *                                                                                             *
+ * OUTPUT:  Returns with the number of bytes that may be looked at. Zero means that Get must   *
+ *          be used instead.                                                                   *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+int SHAStraw::Peek(void const * & buffer, int slen)
+{
+	buffer = NULL;
+	View = NULL;
+	ViewLength = 0;
+	if (ChainTo == NULL || slen < 1) {
+		return(0);
+	}
+
+	ViewLength = ChainTo->Peek(buffer, slen);
+	View = buffer;
+	return(ViewLength);
+}
+
+
+/***********************************************************************************************
+ * SHAStraw::Consume -- Remove the data looked at and process the SHA with it.                 *
+ *                                                                                             *
+ *    The data is processed right where it sits in the view, then removed from the straw       *
+ *    segment that feeds this one.                                                             *
+ *                                                                                             *
+ * INPUT:   slen     -- The number of bytes to remove.                                         *
+ *                                                                                             *
+ * OUTPUT:  Returns with the number of bytes removed.                                          *
+ *                                                                                             *
+ * WARNINGS:   Only data looked at by the last call to Peek may be consumed.                   *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+int SHAStraw::Consume(int slen)
+{
+	if (ChainTo == NULL || View == NULL || slen < 1) {
+		return(0);
+	}
+	if (slen > ViewLength) slen = ViewLength;
+
+	SHA.Hash(View, slen);
+	View = NULL;
+	ViewLength = 0;
+	return(ChainTo->Consume(slen));
+}
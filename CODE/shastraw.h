@@ -50,8 +50,10 @@
 class SHAStraw : public Straw
 {
 	public:
-		SHAStraw(void) {}
+		SHAStraw(void) : View(NULL), ViewLength(0) {}
 		virtual int Get(void * source, int slen);
+		virtual int Peek(void const * & buffer, int slen);
+		virtual int Consume(int slen);
 
 		// Fetch the SHA hash value (stored in result buffer -- 20 bytes long).
 		int Result(void * result) const;
@@ -60,6 +62,13 @@ class SHAStraw : public Straw
 		SHAEngine SHA;
 
 	private:
+		/*
+		**	The view last handed out by Peek. The data is run through the hash as it
+		**	is consumed.
+		*/
+		void const * View;
+		int ViewLength;
+
 		SHAStraw(SHAStraw & rvalue);
 		SHAStraw & operator = (SHAStraw const & straw);
 };
@@ -1642,6 +1642,7 @@ void SidebarClass::StripClass::Draw_It(bool complete)
 		IsToRedraw = false;
 
 		SidebarRedraws++;
+		Metrics.Add(METRIC_SIDEBAR_REDRAWS);
 
 		/*
 		**	Fills the background to the side strip. We shouldnt need to do this if the strip
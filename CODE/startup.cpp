@@ -320,6 +320,13 @@ int main(int argc, char * argv[])
 
 	if (Parse_Command_Line(argc, argv)) {
 
+	/*
+	**	The self tests need nothing else set up, and the game is not run after them.
+	*/
+	if (SelfTestName != NULL) {
+		return(Self_Test(SelfTestName));
+	}
+
 #if(TEN)
 	//
 	// Only allow the TEN version of the game to run if the TEN
@@ -656,6 +663,15 @@ int main(int argc, char * argv[])
 
 			Main_Game(argc, argv);
 
+			/*
+			**	Write out anything the profiler is still recording.
+			*/
+			if (Profiler.IsActive) {
+				Profiler.Stop();
+				Profiler.Dump(PROFILE_FILE_NAME);
+			}
+			Metrics.Stop();
+
 			#ifdef MPEGMOVIE // Denzil 6/15/98
 			if (MpgSettings != NULL)
 				delete MpgSettings;
@@ -58,6 +58,16 @@ class Straw
 		void Get_From(Straw & pipe) {Get_From(&pipe);}
 		virtual int Get(void * buffer, int slen);
 
+		/*
+		**	A straw segment that holds the data in a buffer of its own can hand out a view
+		**	of it rather than copy it out. Peek returns how many bytes can be seen (up to the
+		**	number requested) without removing them from the straw, and Consume then removes
+		**	them. The view is only good until the next call to the straw. A segment that
+		**	has no view to offer returns zero from Peek, in which case Get must be used.
+		*/
+		virtual int Peek(void const * & buffer, int slen) {buffer = NULL; return(0);}
+		virtual int Consume(int) {return(0);}
+
 		/*
 		**	Pointer to the next pipe segment in the chain.
 		*/
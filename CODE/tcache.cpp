@@ -0,0 +1,239 @@
+/*
+**	Command & Conquer Red Alert(tm)
+**	Copyright 2025 Electronic Arts Inc.
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/***********************************************************************************************
+ *                                                                                             *
+ *                 Project Name : Command & Conquer                                            *
+ *                                                                                             *
+ *                    File Name : TCACHE.CPP                                                   *
+ *                                                                                             *
+ *                   Start Date : 10/19/26                                                     *
+ *                                                                                             *
+ *                  Last Update : October 19, 2026                                             *
+ *                                                                                             *
+ *---------------------------------------------------------------------------------------------*
+ * Functions:                                                                                  *
+ *   TerrainCacheClass::Fetch -- Copies a cell's terrain image from the cache to the page.     *
+ *   TerrainCacheClass::Flush -- Discards every cached terrain image.                          *
+ *   TerrainCacheClass::Is_Cacheable -- Checks if a cell is drawn whole in the tactical map.   *
+ *   TerrainCacheClass::Make_Key -- Records the terrain a cell is drawn from.                  *
+ *   TerrainCacheClass::Store -- Copies a freshly drawn cell from the page into the cache.     *
+ *   TerrainCacheClass::TerrainCacheClass -- Constructor for the terrain cache.                *
+ *   TerrainCacheClass::~TerrainCacheClass -- Destructor for the terrain cache.                *
+ * - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+#include	"function.h"
+
+
+/***********************************************************************************************
+ * TerrainCacheClass::TerrainCacheClass -- Constructor for the terrain cache.                  *
+ *                                                                                             *
+ *    The cache starts out empty. Chunks are allocated as the cells in them are drawn.         *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+TerrainCacheClass::TerrainCacheClass(void)
+{
+	memset(Chunks, '\0', sizeof(Chunks));
+}
+
+
+/***********************************************************************************************
+ * TerrainCacheClass::~TerrainCacheClass -- Destructor for the terrain cache.                  *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+TerrainCacheClass::~TerrainCacheClass(void)
+{
+	Flush();
+}
+
+
+/***********************************************************************************************
+ * TerrainCacheClass::Flush -- Discards every cached terrain image.                            *
+ *                                                                                             *
+ *    This must be called whenever the imagery that the terrain is drawn with changes, such    *
+ *    as when a new theater is loaded. The cached cells are then drawn again as they are       *
+ *    needed.                                                                                  *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+void TerrainCacheClass::Flush(void)
+{
+	for (int index = 0; index < ARRAY_SIZE(Chunks); index++) {
+		delete Chunks[index];
+		Chunks[index] = NULL;
+	}
+}
+
+
+/***********************************************************************************************
+ * TerrainCacheClass::Is_Cacheable -- Checks if a cell is drawn whole in the tactical map.     *
+ *                                                                                             *
+ *    Cells along the edge of the tactical map are clipped when drawn, so they cannot be       *
+ *    stored in the cache or copied back out of it. They are simply drawn as normal.           *
+ *                                                                                             *
+ * INPUT:   x,y   -- The cell position relative to the tactical window.                        *
+ *                                                                                             *
+ * OUTPUT:  bool; Does the whole cell fit inside the tactical window?                          *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+bool TerrainCacheClass::Is_Cacheable(int x, int y) const
+{
+	return(x >= 0 && y >= 0 &&
+		x + ICON_PIXEL_W <= WindowList[WINDOW_TACTICAL][WINDOWWIDTH] &&
+		y + ICON_PIXEL_H <= WindowList[WINDOW_TACTICAL][WINDOWHEIGHT]);
+}
+
+
+/***********************************************************************************************
+ * TerrainCacheClass::Fetch -- Copies a cell's terrain image from the cache to the page.       *
+ *                                                                                             *
+ *    If the cache holds an image of the cell that was drawn from the terrain the cell has     *
+ *    now, the image is copied to the logic page in place of drawing the cell.                 *
+ *                                                                                             *
+ * INPUT:   cell  -- The cell to draw.                                                         *
+ *                                                                                             *
+ *          x,y   -- The cell position relative to the tactical window.                        *
+ *                                                                                             *
+ * OUTPUT:  bool; Was the cell copied from the cache? If not, it must be drawn.                *
+ *                                                                                             *
+ * WARNINGS:   The logic page must be locked and the cell must be cacheable.                   *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+bool TerrainCacheClass::Fetch(CellClass const & cell, int x, int y) const
+{
+	CELL cellnum = cell.Cell_Number();
+	int cx = Cell_X(cellnum) % CHUNK_CELLS;
+	int cy = Cell_Y(cellnum) % CHUNK_CELLS;
+
+	ChunkType const * chunk = Chunks[(Cell_X(cellnum) / CHUNK_CELLS) + (Cell_Y(cellnum) / CHUNK_CELLS) * CHUNK_W];
+	if (chunk == NULL) return(false);
+
+	KeyType const & key = chunk->Key[cx + cy * CHUNK_CELLS];
+	if (!key.IsValid) return(false);
+
+	KeyType now;
+	Make_Key(cell, now);
+	if (memcmp(&key, &now, sizeof(now)) != 0) return(false);
+
+	int pitch = LogicPage->Get_XAdd() + LogicPage->Get_Width() + LogicPage->Get_Pitch();
+	unsigned char * dest = LogicPage->Get_Offset() + (y + WindowList[WINDOW_TACTICAL][WINDOWY]) * pitch + x + WindowList[WINDOW_TACTICAL][WINDOWX];
+	for (int row = 0; row < ICON_PIXEL_H; row++) {
+		memcpy(dest, &chunk->Image[cy * ICON_PIXEL_H + row][cx * ICON_PIXEL_W], ICON_PIXEL_W);
+		dest += pitch;
+	}
+	return(true);
+}
+
+
+/***********************************************************************************************
+ * TerrainCacheClass::Store -- Copies a freshly drawn cell from the page into the cache.       *
+ *                                                                                             *
+ *    Once the template, smudge and overlay of a cell have been drawn, this copies the result  *
+ *    into the cache along with the terrain it was drawn from.                                 *
+ *                                                                                             *
+ * INPUT:   cell  -- The cell that was drawn.                                                  *
+ *                                                                                             *
+ *          x,y   -- The cell position relative to the tactical window.                        *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   The logic page must be locked and the cell must be cacheable.                   *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+void TerrainCacheClass::Store(CellClass const & cell, int x, int y)
+{
+	CELL cellnum = cell.Cell_Number();
+	int cx = Cell_X(cellnum) % CHUNK_CELLS;
+	int cy = Cell_Y(cellnum) % CHUNK_CELLS;
+
+	ChunkType * & chunk = Chunks[(Cell_X(cellnum) / CHUNK_CELLS) + (Cell_Y(cellnum) / CHUNK_CELLS) * CHUNK_W];
+	if (chunk == NULL) {
+		chunk = new ChunkType;
+		if (chunk == NULL) return;
+		memset(chunk->Key, '\0', sizeof(chunk->Key));
+	}
+
+	int pitch = LogicPage->Get_XAdd() + LogicPage->Get_Width() + LogicPage->Get_Pitch();
+	unsigned char const * source = LogicPage->Get_Offset() + (y + WindowList[WINDOW_TACTICAL][WINDOWY]) * pitch + x + WindowList[WINDOW_TACTICAL][WINDOWX];
+	for (int row = 0; row < ICON_PIXEL_H; row++) {
+		memcpy(&chunk->Image[cy * ICON_PIXEL_H + row][cx * ICON_PIXEL_W], source, ICON_PIXEL_W);
+		source += pitch;
+	}
+	Make_Key(cell, chunk->Key[cx + cy * CHUNK_CELLS]);
+}
+
+
+/***********************************************************************************************
+ * TerrainCacheClass::Make_Key -- Records the terrain a cell is drawn from.                    *
+ *                                                                                             *
+ *    The key holds everything that the static terrain image of a cell depends upon. When      *
+ *    any of it changes, the cached image is out of date.                                      *
+ *                                                                                             *
+ * INPUT:   cell  -- The cell to make the key for.                                             *
+ *                                                                                             *
+ *          key   -- Reference to the key to fill in.                                          *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+void TerrainCacheClass::Make_Key(CellClass const & cell, KeyType & key)
+{
+	memset(&key, '\0', sizeof(key));
+	key.Template = (unsigned short)cell.TType;
+	key.Icon = cell.TIcon;
+	key.Overlay = (signed char)cell.Overlay;
+	key.OverlayData = cell.OverlayData;
+	key.Smudge = (signed char)cell.Smudge;
+	key.SmudgeData = cell.SmudgeData;
+	key.IsValid = true;
+}
@@ -0,0 +1,94 @@
+/*
+**	Command & Conquer Red Alert(tm)
+**	Copyright 2025 Electronic Arts Inc.
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/***********************************************************************************************
+ *                                                                                             *
+ *                 Project Name : Command & Conquer                                            *
+ *                                                                                             *
+ *                    File Name : TCACHE.H                                                     *
+ *                                                                                             *
+ *                   Start Date : 10/19/26                                                     *
+ *                                                                                             *
+ *                  Last Update : October 19, 2026                                             *
+ *                                                                                             *
+ *---------------------------------------------------------------------------------------------*
+ * Functions:                                                                                  *
+ * - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+#ifndef TCACHE_H
+#define TCACHE_H
+
+class CellClass;
+
+
+/*
+**	This holds the finished image of the static terrain layer (template, smudge and overlay)
+**	for the cells of the map. The map is split into square chunks of cells, and a chunk is
+**	only allocated once one of its cells has been drawn. Each cell remembers the terrain it
+**	was drawn with, so a cell whose template, smudge or overlay has changed since then is
+**	drawn again rather than copied from the cache.
+*/
+class TerrainCacheClass
+{
+	public:
+		TerrainCacheClass(void);
+		~TerrainCacheClass(void);
+
+		void Flush(void);
+		bool Is_Cacheable(int x, int y) const;
+		bool Fetch(CellClass const & cell, int x, int y) const;
+		void Store(CellClass const & cell, int x, int y);
+
+	private:
+		enum TerrainCacheEnums {
+			CHUNK_CELLS=16,
+			CHUNK_W=MAP_CELL_W/CHUNK_CELLS,
+			CHUNK_H=MAP_CELL_H/CHUNK_CELLS,
+			CHUNK_PIXEL_W=CHUNK_CELLS*ICON_PIXEL_W,
+			CHUNK_PIXEL_H=CHUNK_CELLS*ICON_PIXEL_H
+		};
+
+		/*
+		**	The cell terrain that an image in the cache was drawn from. A cell that has
+		**	not been stored yet has IsValid cleared.
+		*/
+		struct KeyType {
+			unsigned short Template;
+			unsigned char Icon;
+			signed char Overlay;
+			unsigned char OverlayData;
+			signed char Smudge;
+			unsigned char SmudgeData;
+			unsigned char IsValid;
+		};
+
+		struct ChunkType {
+			KeyType Key[CHUNK_CELLS*CHUNK_CELLS];
+			unsigned char Image[CHUNK_PIXEL_H][CHUNK_PIXEL_W];
+		};
+
+		static void Make_Key(CellClass const & cell, KeyType & key);
+
+		ChunkType * Chunks[CHUNK_W*CHUNK_H];
+
+		TerrainCacheClass(TerrainCacheClass const & rvalue);
+		TerrainCacheClass & operator = (TerrainCacheClass const & rvalue);
+};
+
+
+#endif
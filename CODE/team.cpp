@@ -71,6 +71,7 @@
  *   TeamClass::operator delete -- Deallocates a team object.                                  *
  *   TeamClass::operator new -- Allocates a team object.                                       *
  *   TeamClass::~TeamClass -- Team object destructor.                                          *
+ *   _Closest_Of -- Picks the closest of a batch of objects.                                   *
  *   _Is_It_Breathing -- Checks to see if unit is an active team member.                       *
  *   _Is_It_Playing -- Determines if unit is active and an initiated team member.              *
  * - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
@@ -163,6 +164,53 @@ static inline bool _Is_It_Playing(FootClass const * object)
 }
 
 
+/*
+**	The number of objects whose distance is measured at once when looking for the closest.
+*/
+#define	CLOSEST_BATCH	64
+
+
+/***********************************************************************************************
+ * _Closest_Of -- Picks the closest of a batch of objects.                                     *
+ *                                                                                             *
+ *    The distance to each object in the batch is measured, and the closest one replaces the   *
+ *    closest object found so far if it is nearer. When two are the same distance, the one     *
+ *    that came first is kept, as it is when the distances are measured one at a time.         *
+ *                                                                                             *
+ * INPUT:   coord    -- The coordinate to measure the distances from.                          *
+ *                                                                                             *
+ *          list     -- Pointer to the objects in the batch.                                   *
+ *                                                                                             *
+ *          coords   -- Pointer to the coordinate of each object in the batch.                 *
+ *                                                                                             *
+ *          count    -- The number of objects in the batch.                                    *
+ *                                                                                             *
+ *          closest  -- Reference to the closest object found so far.                          *
+ *                                                                                             *
+ *          distance -- Reference to the distance to the closest object, or -1 if none has     *
+ *                      been found yet.                                                        *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   The batch must hold no more than CLOSEST_BATCH objects.                         *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+static void _Closest_Of(COORDINATE coord, FootClass const ** list, COORDINATE const * coords, int count, FootClass const * & closest, int & distance)
+{
+	int distances[CLOSEST_BATCH];
+
+	Distance_List(coord, coords, distances, count);
+	for (int index = 0; index < count; index++) {
+		if (distance == -1 || distances[index] < distance) {
+			distance = distances[index];
+			closest = list[index];
+		}
+	}
+}
+
+
 #ifdef CHEAT_KEYS
 /***********************************************************************************************
  * TeamClass::Debug_Dump -- Displays debug information about the team.                         *
@@ -1386,6 +1434,7 @@ void TeamClass::Detach(TARGET target, bool )
  *                                                                                             *
  * HISTORY:                                                                                    *
  *   12/29/1994 JLB : Created.                                                                 *
+ *   10/19/2026 AGT : Measures the distance to friendly objects in batches.                    *
  *=============================================================================================*/
 void TeamClass::Calc_Center(TARGET & center, TARGET & close_member) const
 {
@@ -1422,6 +1471,15 @@ void TeamClass::Calc_Center(TARGET & center, TARGET & close_member) const
 		FootClass const * closest = NULL;	// Current closest friendly object.
 		int distance = -1;					// Record of last closest distance calc.
 
+		/*
+		**	The friendly objects are gathered into batches, so that the distances to a whole
+		**	batch can be measured at once.
+		*/
+		COORDINATE coord = team_member->Center_Coord();
+		FootClass const * batch[CLOSEST_BATCH];
+		COORDINATE coords[CLOSEST_BATCH];
+		int count = 0;
+
 		/*
 		**	Scan through all vehicles.
 		*/
@@ -1429,11 +1487,11 @@ void TeamClass::Calc_Center(TARGET & center, TARGET & close_member) const
 			FootClass const * trial_unit = Units.Ptr(unit_index);
 
 			if (_Is_It_Breathing(trial_unit) && trial_unit->House->Is_Ally(House) && trial_unit->Team != this) {
-				int trial_distance = team_member->Distance(trial_unit);
-
-				if (distance == -1 || trial_distance < distance) {
-					distance = trial_distance;
-					closest = trial_unit;
+				batch[count] = trial_unit;
+				coords[count++] = trial_unit->Target_Coord();
+				if (count == CLOSEST_BATCH) {
+					_Closest_Of(coord, batch, coords, count, closest, distance);
+					count = 0;
 				}
 			}
 		}
@@ -1445,11 +1503,11 @@ void TeamClass::Calc_Center(TARGET & center, TARGET & close_member) const
 			FootClass const * trial_infantry = Infantry.Ptr(infantry_index);
 
 			if (_Is_It_Breathing(trial_infantry) && trial_infantry->House->Is_Ally(House) && trial_infantry->Team != this) {
-				int trial_distance = team_member->Distance(trial_infantry);
-
-				if (distance == -1 || trial_distance < distance) {
-					distance = trial_distance;
-					closest = trial_infantry;
+				batch[count] = trial_infantry;
+				coords[count++] = trial_infantry->Target_Coord();
+				if (count == CLOSEST_BATCH) {
+					_Closest_Of(coord, batch, coords, count, closest, distance);
+					count = 0;
 				}
 			}
 		}
@@ -1461,15 +1519,17 @@ void TeamClass::Calc_Center(TARGET & center, TARGET & close_member) const
 			FootClass const * trial_vessel = Vessels.Ptr(vessel_index);
 
 			if (_Is_It_Breathing(trial_vessel) && trial_vessel->House->Is_Ally(House) && trial_vessel->Team != this) {
-				int trial_distance = team_member->Distance(trial_vessel);
-
-				if (distance == -1 || trial_distance < distance) {
-					distance = trial_distance;
-					closest = trial_vessel;
+				batch[count] = trial_vessel;
+				coords[count++] = trial_vessel->Target_Coord();
+				if (count == CLOSEST_BATCH) {
+					_Closest_Of(coord, batch, coords, count, closest, distance);
+					count = 0;
 				}
 			}
 		}
 
+		_Closest_Of(coord, batch, coords, count, closest, distance);
+
 		/*
 		**	Set the center location as actually the friendly object that is closest. If there
 		**	is no friendly object, then don't set any center location at all.
@@ -124,7 +124,9 @@
  *   TechnoTypeClass::Cost_Of -- Fetches the cost of this object type.                         *
  *   TechnoTypeClass::Get_Cameo_Data -- Fetches the cameo image for this object type.          *
  *   TechnoTypeClass::Get_Ownable -- Fetches the ownable bits for this object type.            *
+ *   TechnoTypeClass::Is_Clear_Foundation -- Can this cell be part of the object's foundation? *
  *   TechnoTypeClass::Is_Two_Shooter -- Determines if this object is a double shooter.         *
+ *   TechnoTypeClass::Legal_Placement -- Checks placement against a table of clear cells.      *
  *   TechnoTypeClass::Raw_Cost -- Fetches the raw (base) cost of the object.                   *
  *   TechnoTypeClass::Read_INI -- Reads the techno type data from the INI database.            *
  *   TechnoTypeClass::Repair_Cost -- Fetches the cost to repair one step.                      *
@@ -1995,6 +1997,7 @@ TARGET TechnoClass::Greatest_Threat(ThreatType method)// const
 	int zone = -1;
 
 	TargetScan++;
+	Metrics.Add(METRIC_TARGET_SCAN);
 
 	/*
 	**	Determine the zone that the target must be in. For aircraft and gunboats, they
@@ -6330,20 +6333,73 @@ int TechnoTypeClass::Legal_Placement(CELL pos) const
 	**	routine return that it is legal to place.
 	*/
 	short const * offset = Occupy_List(true);
-	bool build = (What_Am_I() == RTTI_BUILDINGTYPE);
 
 	while (offset != NULL && *offset != REFRESH_EOL) {
 		CELL cell = pos + *offset++;
-		if (!Map.In_Radar(cell)) return(false);
-		if (build) {
-			if (!Map[cell].Is_Clear_To_Build(Speed)) {
-				return(0);
-			}
-		} else {
-			if (!Map[cell].Is_Clear_To_Move(Speed, false, false)) {
-				return(0);
-			}
+		if (!Is_Clear_Foundation(cell)) {
+			return(0);
+		}
+	}
+	return(1);
+}
+
+
+/***********************************************************************************************
+ * TechnoTypeClass::Legal_Placement -- Checks placement against a table of clear cells.        *
+ *                                                                                             *
+ *    This is the same as the normal placement check, except that each foundation square is    *
+ *    looked up in a table that was filled in by Is_Clear_Foundation beforehand. Use this when *
+ *    a great many placements are to be checked against the same map.                          *
+ *                                                                                             *
+ * INPUT:   pos   -- The cell to check placement at.                                           *
+ *                                                                                             *
+ *          clear -- Pointer to the table of MAP_CELL_TOTAL entries. Each is non-zero if that  *
+ *                   cell is a legal foundation square for this object type.                   *
+ *                                                                                             *
+ * OUTPUT:  bool; Can this object be placed at the cell specified?                             *
+ *                                                                                             *
+ * WARNINGS:   The table must be rebuilt if the map changes.                                   *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+int TechnoTypeClass::Legal_Placement(CELL pos, unsigned char const * clear) const
+{
+	if (pos == -1) return(0);
+
+	short const * offset = Occupy_List(true);
+
+	while (offset != NULL && *offset != REFRESH_EOL) {
+		CELL cell = pos + *offset++;
+		if ((unsigned)cell >= MAP_CELL_TOTAL || !clear[cell]) {
+			return(0);
 		}
 	}
 	return(1);
 }
+
+
+/***********************************************************************************************
+ * TechnoTypeClass::Is_Clear_Foundation -- Can this cell be part of the object's foundation?   *
+ *                                                                                             *
+ *    Buildings need every foundation square to be clear to build upon. Other objects only     *
+ *    need the square to be clear to move into.                                                *
+ *                                                                                             *
+ * INPUT:   cell  -- The cell to check.                                                        *
+ *                                                                                             *
+ * OUTPUT:  bool; Could a foundation square of this object type be placed in this cell?        *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+bool TechnoTypeClass::Is_Clear_Foundation(CELL cell) const
+{
+	if (!Map.In_Radar(cell)) return(false);
+
+	if (What_Am_I() == RTTI_BUILDINGTYPE) {
+		return(Map[cell].Is_Clear_To_Build(Speed));
+	}
+	return(Map[cell].Is_Clear_To_Move(Speed, false, false));
+}
@@ -38,9 +38,11 @@
  *   ThemeClass::From_Name -- Determines theme number from specified name.                     *
  *   ThemeClass::Full_Name -- Retrieves the full score name.                                   *
  *   ThemeClass::Is_Allowed -- Checks to see if the specified theme is legal.                  *
+ *   ThemeClass::Load_Theme_Data -- Restores the theme data written by Save_Theme_Data.        *
  *   ThemeClass::Next_Song -- Calculates the next song number to play.                         *
  *   ThemeClass::Play_Song -- Starts the specified song play NOW.                              *
  *   ThemeClass::Queue_Song -- Queues the song to the play queue.                              *
+ *   ThemeClass::Save_Theme_Data -- Writes the rules controlled theme data.                    *
  *   ThemeClass::Scan -- Scans all scores for availability.                                    *
  *   ThemeClass::Set_Theme_Data -- Set the theme data for scenario and owner.                  *
  *   ThemeClass::Still_Playing -- Determines if music is still playing.                        *
@@ -615,3 +617,50 @@ void ThemeClass::Set_Theme_Data(ThemeType theme, int scenario, int owners)
 	}
 }
 
+
+/***********************************************************************************************
+ * ThemeClass::Save_Theme_Data -- Writes the rules controlled theme data.                      *
+ *                                                                                             *
+ *    This writes the values that Set_Theme_Data() can change, so that they can be put back    *
+ *    later without processing the rules again.                                                *
+ *                                                                                             *
+ * INPUT:   pipe     -- The pipe to write the theme data to.                                   *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+void ThemeClass::Save_Theme_Data(Pipe & pipe) const
+{
+	for (ThemeType theme = THEME_FIRST; theme < THEME_COUNT; theme++) {
+		pipe.Put(&_themes[theme].Normal, sizeof(_themes[theme].Normal));
+		pipe.Put(&_themes[theme].Scenario, sizeof(_themes[theme].Scenario));
+		pipe.Put(&_themes[theme].Owner, sizeof(_themes[theme].Owner));
+	}
+}
+
+
+/***********************************************************************************************
+ * ThemeClass::Load_Theme_Data -- Restores the theme data written by Save_Theme_Data.          *
+ *                                                                                             *
+ * INPUT:   straw    -- The straw to read the theme data from.                                 *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+void ThemeClass::Load_Theme_Data(Straw & straw)
+{
+	for (ThemeType theme = THEME_FIRST; theme < THEME_COUNT; theme++) {
+		straw.Get(&_themes[theme].Normal, sizeof(_themes[theme].Normal));
+		straw.Get(&_themes[theme].Scenario, sizeof(_themes[theme].Scenario));
+		straw.Get(&_themes[theme].Owner, sizeof(_themes[theme].Owner));
+	}
+}
+
@@ -38,6 +38,9 @@
 #ifndef THEME_H
 #define THEME_H
 
+class Pipe;
+class Straw;
+
 class ThemeClass
 {
 	private:
@@ -83,6 +86,8 @@ class ThemeClass
 		void Fade_Out(void) {Queue_Song(THEME_QUIET);}
 		void Queue_Song(ThemeType index);
 		void Set_Theme_Data(ThemeType theme, int scenario, int owners);
+		void Save_Theme_Data(Pipe & pipe) const;
+		void Load_Theme_Data(Straw & straw);
 		void Stop(void);
 		void Suspend(void);
 };
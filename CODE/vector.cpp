@@ -408,6 +408,8 @@ template class VectorClass<unsigned char *>;
 template class VectorClass<char const*>;
 template class VectorClass<void *>;
 template class VectorClass<unsigned char>;
+template class VectorClass<int>;
+template class VectorClass<unsigned long>;
 
 #ifdef WINSOCK_IPX
 template class VectorClass<WinsockInterfaceClass::WinsockBufferType *>;
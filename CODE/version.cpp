@@ -68,6 +68,7 @@ static VersionProtocolType VersionProtocol[] = {
 	{0x00001000,COMM_PROTOCOL_SINGLE_NO_COMP},	// (obsolete)
 	{0x00002000,COMM_PROTOCOL_SINGLE_E_COMP},		// (obsolete)
 	{0x00010000,COMM_PROTOCOL_MULTI_E_COMP},
+	{VERSION_RA_301,COMM_PROTOCOL_MULTI_V_COMP},
 };
 
 
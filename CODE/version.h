@@ -46,6 +46,7 @@
 
 //	Aftermath has, in a sense, used version 2.00. (Because of the text on title screen.) Call ourselves version 3.
 #define VERSION_RA_300				0x00030000	//	RA, CS, AM executables unified into one. All are now the same version. -ajw
+#define VERSION_RA_301				0x00030001	//	Adds the varint/delta event packet encoding (COMM_PROTOCOL_MULTI_V_COMP).
 //	It seems that extra information, that didn't belong there, was being stuffed into version number. Namely, whether or not
 //	Counterstrike is installed. I'm going to change things back to the way they should be, as I see it. Version will describe
 //	the version of the executable only. When it comes to communicating whether or not a player has expansions present, separate
@@ -69,8 +70,9 @@ typedef enum CommProtocolEnum {
 	COMM_PROTOCOL_SINGLE_NO_COMP = 0,	// single frame with no compression
 	COMM_PROTOCOL_SINGLE_E_COMP,			// single frame with event compression
 	COMM_PROTOCOL_MULTI_E_COMP,			// multiple frame with event compression
+	COMM_PROTOCOL_MULTI_V_COMP,			// multiple frame with varint/delta event compression
 	COMM_PROTOCOL_COUNT,
-	DEFAULT_COMM_PROTOCOL = COMM_PROTOCOL_MULTI_E_COMP
+	DEFAULT_COMM_PROTOCOL = COMM_PROTOCOL_MULTI_V_COMP
 } CommProtocolType;
 
 typedef struct {
@@ -139,7 +141,7 @@ class VersionClass {
 		enum VersionEnum {
 #ifdef FIXIT_VERSION_3
 			MAJOR_VERSION = 0x0003,
-			MINOR_VERSION = 0x0000
+			MINOR_VERSION = 0x0001
 #else
 			MAJOR_VERSION = 0x0001,
 			MINOR_VERSION = 0x2000
@@ -156,7 +158,7 @@ class VersionClass {
 #ifdef FIXIT_VERSION_3
 			//	ajw - We can only play against same version.
 			MIN_VERSION = VERSION_RA_300,
-			MAX_VERSION = VERSION_RA_300
+			MAX_VERSION = VERSION_RA_301
 #else
 			MIN_VERSION = VERSION_RED_ALERT_104, //0x00010000,	// Version: 1.0
 			MAX_VERSION = VERSION_AFTERMATH		 //0x00012000	// Version: 1.2
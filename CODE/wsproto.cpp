@@ -103,6 +103,7 @@ WinsockInterfaceClass::WinsockInterfaceClass(void)
 	WinsockInitialised = false;
 	ASync = INVALID_HANDLE_VALUE;
 	Socket = INVALID_SOCKET;
+	PacketTime = 0;
 }
 
 
@@ -438,6 +439,7 @@ int WinsockInterfaceClass::Read(void *buffer, int &buffer_len, void *address, in
 	** Return the length of the packet in buffer_len.
 	*/
 	buffer_len = packet->BufferLen;
+	PacketTime = 0;
 
 	/*
 	** Delete the temporary storage for the packet now that it is being passed to the game.
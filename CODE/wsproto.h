@@ -151,6 +151,12 @@ class WinsockInterfaceClass {
 
 		inline ConnectStatusEnum Get_Connection_Status(void) {return (ConnectStatus);}
 
+		/*
+		** Arrival time of the packet last returned by Read, in ConnectionClass::Time() units.
+		** Zero if the transport doesn't timestamp packets.
+		*/
+		inline unsigned long Packet_Time(void) {return (PacketTime);}
+
 	protected:
 		int Get_Last_Error();
 
@@ -196,6 +202,11 @@ class WinsockInterfaceClass {
 		** Current connection status.
 		*/
 		ConnectStatusEnum	ConnectStatus;
+
+		/*
+		** Arrival time of the last packet returned by Read.
+		*/
+		unsigned long		PacketTime;
 };
 
 
@@ -41,6 +41,12 @@
  * UDPInterfaceClass::UDPInterfaceClass -- Class constructor.                                  *
  * UDPInterfaceClass::Set_Broadcast_Address -- Sets the address to send broadcast packets to   *
  * UDPInterfaceClass::Open_Socket -- Opens a socket for communications via the UDP protocol    *
+ * UDPIC::Start_Listening -- Enable callbacks for read/write events on our socket              *
+ * UDPIC::Stop_Listening -- Disable callbacks & stop the network thread                        *
+ * UDPIC::Read -- Get the next packet read by the network thread                               *
+ * UDPIC::Receive_Thread -- Network thread; reads packets into the receive ring                *
+ * UDPIC::Is_Local_Address -- Did a packet come from this machine?                             *
+ * UDPIC::Store_Packet -- Add a received packet to the incoming packet list                    *
  * TMC::Message_Handler -- Message handler function for Winsock related messages               *
  * - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
 
@@ -60,6 +66,8 @@ typedef int socklen_t;
 #include <netdb.h>
 #include <unistd.h>
 #include <netinet/in.h>
+#include <sys/socket.h>
+#include <poll.h>
 
 #define INVALID_SOCKET -1
 #define SOCKET_ERROR -1
@@ -82,7 +90,12 @@ typedef int socklen_t;
  *    8/5/97 12:11PM ST : Created                                                              *
  *=============================================================================================*/
 UDPInterfaceClass::UDPInterfaceClass (void) : WinsockInterfaceClass()
-{}
+{
+#ifdef UDP_RECEIVE_THREAD
+	ReceiveRing = NULL;
+	IsReceiveThreadRunning = false;
+#endif
+}
 
 
 
@@ -102,6 +115,15 @@ UDPInterfaceClass::UDPInterfaceClass (void) : WinsockInterfaceClass()
  *=============================================================================================*/
 UDPInterfaceClass::~UDPInterfaceClass (void)
 {
+	/*
+	** Stop the network thread before freeing anything it reads; it checks incoming
+	** packets against the local address list.
+	*/
+#ifdef UDP_RECEIVE_THREAD
+	Stop_Listening();
+#endif
+	Close();
+
 	while ( BroadcastAddresses.Count() ) {
 		delete BroadcastAddresses[0];
 		BroadcastAddresses.Delete(0);
@@ -112,7 +134,9 @@ UDPInterfaceClass::~UDPInterfaceClass (void)
 		LocalAddresses.Delete(0);
 	}
 
-	Close();
+#ifdef UDP_RECEIVE_THREAD
+	delete ReceiveRing;
+#endif
 }
 
 
@@ -316,6 +340,287 @@ void UDPInterfaceClass::Broadcast (void *buffer, int buffer_len)
 
 
 #ifdef PORTABLE
+/***********************************************************************************************
+ * UDPIC::Start_Listening -- Enable callbacks for read/write events on our socket              *
+ *                                                                                             *
+ *                                                                                             *
+ *                                                                                             *
+ * INPUT:    Nothing                                                                           *
+ *                                                                                             *
+ * OUTPUT:   true if callbacks were enabled                                                    *
+ *                                                                                             *
+ * WARNINGS: None                                                                              *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *    10/19/2026 AGT : Created.                                                                *
+ *=============================================================================================*/
+bool UDPInterfaceClass::Start_Listening (void)
+{
+	if ( !WinsockInterfaceClass::Start_Listening() ) {
+		return (false);
+	}
+
+	/*
+	** Event_Handler reads and writes until the socket would block, so we only need to be told
+	** when the socket becomes ready rather than every time we poll.
+	*/
+	Socket_Edge_Triggered(Socket, true);
+
+#ifdef UDP_RECEIVE_THREAD
+	/*
+	** Hand reading over to the network thread if it's enabled. Writes are still done from
+	** Event_Handler.
+	*/
+	if ( Options.IsNetworkThread && !ReceiveThread.joinable() ) {
+		if ( !ReceiveRing ) {
+			ReceiveRing = new PacketRingClass;
+		}
+		ReceiveRing->Clear();
+		IsReceiveThreadRunning = true;
+		ReceiveThread = std::thread(&UDPInterfaceClass::Receive_Thread, this);
+	}
+#endif
+
+	return (true);
+}
+
+
+#ifdef UDP_RECEIVE_THREAD
+/***********************************************************************************************
+ * UDPIC::Stop_Listening -- Disable callbacks & stop the network thread                        *
+ *                                                                                             *
+ *                                                                                             *
+ *                                                                                             *
+ * INPUT:    Nothing                                                                           *
+ *                                                                                             *
+ * OUTPUT:   Nothing                                                                           *
+ *                                                                                             *
+ * WARNINGS: None                                                                              *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *    10/19/2026 AGT : Created.                                                                *
+ *=============================================================================================*/
+void UDPInterfaceClass::Stop_Listening (void)
+{
+	if ( ReceiveThread.joinable() ) {
+		IsReceiveThreadRunning = false;
+		ReceiveThread.join();
+		ReceiveRing->Clear();
+	}
+
+	WinsockInterfaceClass::Stop_Listening();
+}
+
+
+/***********************************************************************************************
+ * UDPIC::Read -- Get the next packet read by the network thread                               *
+ *                                                                                             *
+ *                                                                                             *
+ *                                                                                             *
+ * INPUT:    buffer to read data into                                                          *
+ *           length of buffer                                                                  *
+ *           buffer to read address into                                                       *
+ *           length of address buffer                                                          *
+ *                                                                                             *
+ * OUTPUT:   Number of bytes read                                                              *
+ *                                                                                             *
+ * WARNINGS: None                                                                              *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *    10/19/2026 AGT : Created.                                                                *
+ *=============================================================================================*/
+int UDPInterfaceClass::Read(void *buffer, int &buffer_len, void *address, int &address_len)
+{
+	if ( !ReceiveThread.joinable() ) {
+		return ( WinsockInterfaceClass::Read(buffer, buffer_len, address, address_len) );
+	}
+
+	/*
+	** Call the message loop so that any outstanding write events are handled.
+	*/
+	Keyboard->Check();
+
+	while ( ReceiveRing->Count() ) {
+		RingPacketType & packet = ReceiveRing->Consumer_Slot();
+
+		/*
+		** Skip packets the network thread discarded.
+		*/
+		if ( packet.BufferLen == 0 ) {
+			ReceiveRing->Release();
+			continue;
+		}
+
+		assert ( buffer_len >= packet.BufferLen );
+		assert ( address_len >= sizeof (packet.Address) );
+
+		memcpy ( buffer, packet.Buffer, packet.BufferLen );
+		memcpy ( address, packet.Address, sizeof (packet.Address) );
+		buffer_len = packet.BufferLen;
+		PacketTime = packet.Time;
+
+		ReceiveRing->Release();
+		return ( buffer_len );
+	}
+
+	return (0);
+}
+
+
+/***********************************************************************************************
+ * UDPIC::Receive_Thread -- Network thread; reads packets into the receive ring                *
+ *                                                                                             *
+ *    Packets are timestamped as they are read, so the time they spend waiting for the main    *
+ *    loop isn't counted in the connection response times.                                    *
+ *                                                                                             *
+ * INPUT:    Nothing                                                                           *
+ *                                                                                             *
+ * OUTPUT:   Nothing                                                                           *
+ *                                                                                             *
+ * WARNINGS: This is the only thread that writes to ReceiveRing.                               *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *    10/19/2026 AGT : Created.                                                                *
+ *=============================================================================================*/
+void UDPInterfaceClass::Receive_Thread (void)
+{
+	struct pollfd fd;
+	fd.fd = Socket;
+	fd.events = POLLIN;
+
+	while ( IsReceiveThreadRunning ) {
+
+		/*
+		** If the main loop hasn't caught up, leave packets in the socket buffer for now.
+		*/
+		int batch = min ( ReceiveRing->Free(), UDP_RECEIVE_BATCH );
+		if ( batch == 0 ) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			continue;
+		}
+
+		/*
+		** Wake up regularly to check whether we've been asked to stop.
+		*/
+		fd.revents = 0;
+		if ( poll (&fd, 1, 10) <= 0 ) continue;
+
+		struct sockaddr_in addrs[UDP_RECEIVE_BATCH];
+#ifdef __linux__
+		struct iovec iovecs[UDP_RECEIVE_BATCH];
+		struct mmsghdr messages[UDP_RECEIVE_BATCH];
+
+		memset (messages, 0, sizeof (messages));
+		for ( int i=0 ; i<batch ; i++ ) {
+			iovecs[i].iov_base = ReceiveRing->Producer_Slot(i).Buffer;
+			iovecs[i].iov_len = sizeof (ReceiveRing->Producer_Slot(i).Buffer);
+			messages[i].msg_hdr.msg_name = &addrs[i];
+			messages[i].msg_hdr.msg_namelen = sizeof (addrs[i]);
+			messages[i].msg_hdr.msg_iov = &iovecs[i];
+			messages[i].msg_hdr.msg_iovlen = 1;
+		}
+
+		int count = recvmmsg ( Socket, messages, batch, MSG_DONTWAIT, NULL );
+		if ( count <= 0 ) continue;
+#else
+		int count = 0;
+		while ( count < batch ) {
+			socklen_t addr_len = sizeof (addrs[count]);
+			RingPacketType & slot = ReceiveRing->Producer_Slot(count);
+			int rc = recvfrom ( Socket, (char*)slot.Buffer, sizeof (slot.Buffer), MSG_DONTWAIT, (sockaddr *)&addrs[count], &addr_len);
+			if ( rc == SOCKET_ERROR ) break;
+			slot.BufferLen = rc;
+			count++;
+		}
+		if ( count == 0 ) continue;
+#endif
+
+		unsigned long time = ConnectionClass::Time();
+
+		for ( int i=0 ; i<count ; i++ ) {
+			RingPacketType & slot = ReceiveRing->Producer_Slot(i);
+#ifdef __linux__
+			slot.BufferLen = messages[i].msg_len;
+#endif
+			slot.Time = time;
+
+			/*
+			** Make sure this packet didn't come from us. If it did then throw it away.
+			*/
+			if ( Is_Local_Address (&addrs[i]) ) {
+				slot.BufferLen = 0;
+			}
+
+			memset ( slot.Address, 0, sizeof (slot.Address) );
+			memcpy ( slot.Address+4, &addrs[i].sin_addr.s_addr, 4 );
+		}
+
+		ReceiveRing->Commit(count);
+	}
+}
+#endif
+
+
+/***********************************************************************************************
+ * UDPIC::Is_Local_Address -- Did a packet come from this machine?                             *
+ *                                                                                             *
+ *                                                                                             *
+ *                                                                                             *
+ * INPUT:    address the packet came from                                                      *
+ *                                                                                             *
+ * OUTPUT:   true if the address is one of ours                                                *
+ *                                                                                             *
+ * WARNINGS: None                                                                              *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *    10/19/2026 AGT : Created.                                                                *
+ *=============================================================================================*/
+bool UDPInterfaceClass::Is_Local_Address (struct sockaddr_in const *addr)
+{
+	for ( int i=0 ; i<LocalAddresses.Count() ; i++ ) {
+		if ( ! memcmp (LocalAddresses[i], &addr->sin_addr.s_addr, 4) ) return (true);
+	}
+	return (false);
+}
+
+
+/***********************************************************************************************
+ * UDPIC::Store_Packet -- Add a received packet to the incoming packet list                    *
+ *                                                                                             *
+ *                                                                                             *
+ *                                                                                             *
+ * INPUT:    ptr to packet data                                                                *
+ *           length of packet                                                                  *
+ *           address the packet came from                                                      *
+ *                                                                                             *
+ * OUTPUT:   Nothing                                                                           *
+ *                                                                                             *
+ * WARNINGS: None                                                                              *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *    10/19/2026 AGT : Created.                                                                *
+ *=============================================================================================*/
+void UDPInterfaceClass::Store_Packet (void const *buffer, int length, struct sockaddr_in const *addr)
+{
+	if ( !length ) return;
+
+	/*
+	** Make sure this packet didn't come from us. If it did then throw it away.
+	*/
+	if ( Is_Local_Address (addr) ) return;
+
+	/*
+	** Create a new buffer and store this packet in it.
+	*/
+	WinsockBufferType *packet = new WinsockBufferType;
+	packet->BufferLen = length;
+	memcpy ( packet->Buffer, buffer, length );
+	memset ( packet->Address, 0, sizeof (packet->Address) );
+	memcpy ( packet->Address+4, &addr->sin_addr.s_addr, 4 );
+	InBuffers.Add (packet);
+}
+
+
 // like below, but less windows-y
 void UDPInterfaceClass::Event_Handler(int socket, SocketEvent event)
 {
@@ -326,84 +631,112 @@ void UDPInterfaceClass::Event_Handler(int socket, SocketEvent event)
 	{
 		case SOCKEV_READ:
 		{
+#ifdef UDP_RECEIVE_THREAD
 			/*
-			** Call the recvfrom function to get the outstanding packet.
+			** The network thread does all the reading when it's running.
 			*/
-			socklen_t addr_len = sizeof(addr);
-			int rc = recvfrom ( Socket, (char*)ReceiveBuffer, sizeof (ReceiveBuffer), 0, (sockaddr *)&addr, &addr_len);
-			if (rc == SOCKET_ERROR) {
-				Clear_Socket_Error (Socket);
-				return;
-			}
+			if ( ReceiveThread.joinable() ) break;
+#endif
 
+#ifdef __linux__
 			/*
-			** rc is the number of bytes received
+			** Fetch all the outstanding packets, UDP_RECEIVE_BATCH at a time. A short batch means
+			** the socket is empty; anything arriving after that raises a new read event.
 			*/
-			if ( rc ) {
+			static unsigned char buffers[UDP_RECEIVE_BATCH][WS_RECEIVE_BUFFER_LEN];
+			struct sockaddr_in addrs[UDP_RECEIVE_BATCH];
+			struct iovec iovecs[UDP_RECEIVE_BATCH];
+			struct mmsghdr messages[UDP_RECEIVE_BATCH];
+
+			for (;;) {
+				memset (messages, 0, sizeof (messages));
+				for ( int i=0 ; i<UDP_RECEIVE_BATCH ; i++ ) {
+					iovecs[i].iov_base = buffers[i];
+					iovecs[i].iov_len = WS_RECEIVE_BUFFER_LEN;
+					messages[i].msg_hdr.msg_name = &addrs[i];
+					messages[i].msg_hdr.msg_namelen = sizeof (addrs[i]);
+					messages[i].msg_hdr.msg_iov = &iovecs[i];
+					messages[i].msg_hdr.msg_iovlen = 1;
+				}
 
-				/*
-				** Make sure this packet didn't come from us. If it did then throw it away.
-				*/
-				for ( int i=0 ; i<LocalAddresses.Count() ; i++ ) {
-					if ( ! memcmp (LocalAddresses[i], &addr.sin_addr.s_addr, 4) ) return;
+				int rc = recvmmsg ( Socket, messages, UDP_RECEIVE_BATCH, 0, NULL );
+				if (rc == SOCKET_ERROR) {
+					Clear_Socket_Error (Socket);
+					return;
+				}
+
+				for ( int i=0 ; i<rc ; i++ ) {
+					Store_Packet ( buffers[i], messages[i].msg_len, &addrs[i] );
+				}
+
+				if ( rc < UDP_RECEIVE_BATCH ) break;
+			}
+#else
+			/*
+			** Call the recvfrom function until there are no more outstanding packets.
+			*/
+			for (;;) {
+				socklen_t addr_len = sizeof(addr);
+				int rc = recvfrom ( Socket, (char*)ReceiveBuffer, sizeof (ReceiveBuffer), 0, (sockaddr *)&addr, &addr_len);
+				if (rc == SOCKET_ERROR) {
+					Clear_Socket_Error (Socket);
+					return;
 				}
 
 				/*
-				** Create a new buffer and store this packet in it.
+				** rc is the number of bytes received
 				*/
-				packet = new WinsockBufferType;
-				packet->BufferLen = rc;
-				memcpy ( packet->Buffer, ReceiveBuffer, rc );
-				memset ( packet->Address, 0, sizeof (packet->Address) );
-				memcpy ( packet->Address+4, &addr.sin_addr.s_addr, 4 );
-				InBuffers.Add (packet);
+				Store_Packet ( ReceiveBuffer, rc, &addr );
 			}
+#endif
 			break;
 		}
 		case SOCKEV_WRITE:
 		{
 			/*
-			** If there are no packets waiting to be sent then bail.
+			** Send packets until we run out or Winsock can't take any more.
 			*/
-			if ( OutBuffers.Count() == 0 ) {
-				Socket_Check_Write(Socket, false); // don't need to be notified any more
-				return;
-			}
-			int packetnum = 0;
+			while ( OutBuffers.Count() ) {
+				int packetnum = 0;
 
-			/*
-			** Get a pointer to the packet.
-			*/
-			packet = OutBuffers [ packetnum ];
+				/*
+				** Get a pointer to the packet.
+				*/
+				packet = OutBuffers [ packetnum ];
 
-			/*
-			** Set up the address structure of the outgoing packet
-			*/
-			addr.sin_family = AF_INET;
-			addr.sin_port = (unsigned short) htons ((unsigned short)PlanetWestwoodPortNumber);
-			memcpy (&addr.sin_addr.s_addr, packet->Address+4, 4);
+				/*
+				** Set up the address structure of the outgoing packet
+				*/
+				addr.sin_family = AF_INET;
+				addr.sin_port = (unsigned short) htons ((unsigned short)PlanetWestwoodPortNumber);
+				memcpy (&addr.sin_addr.s_addr, packet->Address+4, 4);
 
-			/*
-			** Send it.
-			** If we get a WSAWOULDBLOCK error it means that Winsock is unable to accept the packet
-			** at this time. In this case, we clear the socket error and just exit. Winsock will
-			** send us another WRITE message when it is ready to receive more data.
-			*/
-			int rc = sendto ( Socket, (const char*) packet->Buffer, packet->BufferLen, 0, (sockaddr *)&addr, sizeof (addr) );
+				/*
+				** Send it.
+				** If we get a WSAWOULDBLOCK error it means that Winsock is unable to accept the packet
+				** at this time. In this case, we clear the socket error and just exit. Winsock will
+				** send us another WRITE message when it is ready to receive more data.
+				*/
+				int rc = sendto ( Socket, (const char*) packet->Buffer, packet->BufferLen, 0, (sockaddr *)&addr, sizeof (addr) );
 
-			if (rc == -1){
-				if (Get_Last_Error() == EWOULDBLOCK) {
-					Clear_Socket_Error (Socket);
-					return;
+				if (rc == -1){
+					if (Get_Last_Error() == EWOULDBLOCK) {
+						Clear_Socket_Error (Socket);
+						return;
+					}
 				}
+
+				/*
+				** Delete the sent packet.
+				*/
+				OutBuffers.Delete ( packetnum );
+				delete packet;
 			}
 
 			/*
-			** Delete the sent packet.
+			** If there are no packets waiting to be sent then we don't need to be notified any more.
 			*/
-			OutBuffers.Delete ( packetnum );
-			delete packet;
-
+			Socket_Check_Write(Socket, false);
 			break;
 		}
 	}
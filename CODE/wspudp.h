@@ -39,6 +39,22 @@
 
 #include	"wsproto.h"
 
+#ifdef PORTABLE
+/*
+** Max number of datagrams fetched by one receive call.
+*/
+#define	UDP_RECEIVE_BATCH	16
+
+/*
+** Packets can be read on a network thread where poll() is available.
+*/
+#ifndef _WIN32
+#define	UDP_RECEIVE_THREAD
+#include	"pktring.h"
+#include	<thread>
+#endif
+#endif
+
 
 
 /*
@@ -53,6 +69,11 @@ class UDPInterfaceClass : public WinsockInterfaceClass {
 		virtual ~UDPInterfaceClass(void);
 #ifdef PORTABLE
 		virtual void Event_Handler(int, SocketEvent);
+		virtual bool Start_Listening (void);
+#ifdef UDP_RECEIVE_THREAD
+		virtual void Stop_Listening (void);
+		virtual int  Read(void *buffer, int &buffer_len, void *address, int &address_len);
+#endif
 #else
 	 	virtual long Message_Handler(HWND window, UINT message, UINT wParam, LONG lParam);
 #endif
@@ -80,6 +101,26 @@ class UDPInterfaceClass : public WinsockInterfaceClass {
 		** List of local addresses.
 		*/
 		DynamicVectorClass <unsigned char *> LocalAddresses;
+
+#ifdef PORTABLE
+		void Store_Packet (void const *buffer, int length, struct sockaddr_in const *addr);
+		bool Is_Local_Address (struct sockaddr_in const *addr);
+#endif
+
+#ifdef UDP_RECEIVE_THREAD
+		void Receive_Thread (void);
+
+		/*
+		** Packets read by the network thread, waiting for Read.
+		*/
+		PacketRingClass *			ReceiveRing;
+
+		/*
+		** The network thread, and the flag that tells it to keep running.
+		*/
+		std::thread					ReceiveThread;
+		std::atomic<bool>			IsReceiveThreadRunning;
+#endif
 };
 
 
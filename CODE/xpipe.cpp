@@ -33,7 +33,12 @@
  *                                                                                             *
  *---------------------------------------------------------------------------------------------*
  * Functions:                                                                                  *
+ *   BufferPipe::Commit -- Keep the data written to the reserved space.                        *
  *   BufferPipe::Put -- Submit data to the buffered pipe segment.                              *
+ *   BufferPipe::Reserve -- Fetch space to write data to in the buffer.                        *
+ *   DynamicBufferPipe::Commit -- Append the data written to the reserved space.               *
+ *   DynamicBufferPipe::Put -- Append data to the growable memory buffer.                      *
+ *   DynamicBufferPipe::Reserve -- Fetch space at the end of the growable memory buffer.       *
  *   FilePipe::Put -- Submit a block of data to the pipe.                                      *
  *   FilePipe::End -- End the file pipe handler.                                               *
  * - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
@@ -91,6 +96,180 @@ int BufferPipe::Put(void const * source, int slen)
 }
 
 
+/***********************************************************************************************
+ * BufferPipe::Reserve -- Fetch space to write data to in the buffer.                          *
+ *                                                                                             *
+ *    The space handed out is the part of the buffer that the next data put would be stored    *
+ *    into. If the buffer is nearly full, there will be less space than asked for.             *
+ *                                                                                             *
+ * INPUT:   buffer   -- Reference to the pointer that will be set to the start of the space.   *
+ *                                                                                             *
+ *          slen     -- The number of bytes of space requested.                                *
+ *                                                                                             *
+ * OUTPUT:  Returns with the number of bytes that may be written.                              *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+int BufferPipe::Reserve(void * & buffer, int slen)
+{
+	buffer = NULL;
+	if (!Is_Valid() || slen < 1) return(0);
+
+	int len = slen;
+	if (BufferPtr.Get_Size() != 0) {
+		int theoretical_max = BufferPtr.Get_Size() - Index;
+		len = (slen < theoretical_max) ? slen : theoretical_max;
+	}
+
+	buffer = ((char *)BufferPtr.Get_Buffer()) + Index;
+	return(len);
+}
+
+
+/***********************************************************************************************
+ * BufferPipe::Commit -- Keep the data written to the reserved space.                          *
+ *                                                                                             *
+ *    The data is already where it belongs, so this just advances past it as if it had been    *
+ *    submitted with Put.                                                                      *
+ *                                                                                             *
+ * INPUT:   slen     -- The number of bytes written to the reserved space.                     *
+ *                                                                                             *
+ * OUTPUT:  Returns with the number of bytes output to the destination buffer.                 *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+int BufferPipe::Commit(int slen)
+{
+	if (!Is_Valid() || slen < 1) return(0);
+
+	int len = slen;
+	if (BufferPtr.Get_Size() != 0) {
+		int theoretical_max = BufferPtr.Get_Size() - Index;
+		len = (slen < theoretical_max) ? slen : theoretical_max;
+	}
+
+	Index += len;
+	return(len);
+}
+
+//---------------------------------------------------------------------------------------------------------
+// DynamicBufferPipe
+//---------------------------------------------------------------------------------------------------------
+
+DynamicBufferPipe::~DynamicBufferPipe(void)
+{
+	delete [] BufferPtr;
+	BufferPtr = NULL;
+	Length = 0;
+	MaxLength = 0;
+}
+
+
+/***********************************************************************************************
+ * DynamicBufferPipe::Put -- Append data to the growable memory buffer.                        *
+ *                                                                                             *
+ *    This pipe terminator stores all data submitted to it into a memory buffer. The buffer    *
+ *    is doubled in size whenever it would overflow, so the amortized cost of a put is just    *
+ *    the copy itself.                                                                         *
+ *                                                                                             *
+ * INPUT:   source   -- Pointer to the data to submit.                                         *
+ *                                                                                             *
+ *          slen     -- The number of bytes to be submitted.                                   *
+ *                                                                                             *
+ * OUTPUT:  Returns with the number of bytes stored into the buffer.                           *
+ *                                                                                             *
+ * WARNINGS:   Pointers previously fetched by Get_Buffer() are invalidated by this routine.    *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+int DynamicBufferPipe::Put(void const * source, int slen)
+{
+	if (source == NULL || slen <= 0) return(0);
+
+	void * buffer;
+	if (Reserve(buffer, slen) != slen) return(0);
+
+	memcpy(buffer, source, slen);
+	return(Commit(slen));
+}
+
+
+/***********************************************************************************************
+ * DynamicBufferPipe::Reserve -- Fetch space at the end of the growable memory buffer.         *
+ *                                                                                             *
+ *    The buffer is grown (by doubling it) until there is room for the space asked for after   *
+ *    the data already stored.                                                                 *
+ *                                                                                             *
+ * INPUT:   buffer   -- Reference to the pointer that will be set to the start of the space.   *
+ *                                                                                             *
+ *          slen     -- The number of bytes of space requested.                                *
+ *                                                                                             *
+ * OUTPUT:  Returns with the number of bytes that may be written. This is zero if the buffer   *
+ *          could not be grown.                                                                *
+ *                                                                                             *
+ * WARNINGS:   Pointers previously fetched by Get_Buffer() are invalidated by this routine.    *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+int DynamicBufferPipe::Reserve(void * & buffer, int slen)
+{
+	buffer = NULL;
+	if (slen <= 0) return(0);
+
+	if (Length + slen > MaxLength) {
+		int newmax = (MaxLength != 0) ? MaxLength : 0x10000;
+		while (newmax < Length + slen) {
+			newmax *= 2;
+		}
+
+		char * newbuf = new char[newmax];
+		if (newbuf == NULL) return(0);
+		if (BufferPtr != NULL) {
+			memcpy(newbuf, BufferPtr, Length);
+			delete [] BufferPtr;
+		}
+		BufferPtr = newbuf;
+		MaxLength = newmax;
+	}
+
+	buffer = BufferPtr + Length;
+	return(slen);
+}
+
+
+/***********************************************************************************************
+ * DynamicBufferPipe::Commit -- Append the data written to the reserved space.                 *
+ *                                                                                             *
+ *    The data written after the end of the stored data becomes part of it.                    *
+ *                                                                                             *
+ * INPUT:   slen     -- The number of bytes written to the reserved space.                     *
+ *                                                                                             *
+ * OUTPUT:  Returns with the number of bytes stored into the buffer.                           *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+int DynamicBufferPipe::Commit(int slen)
+{
+	if (slen <= 0) return(0);
+
+	if (slen > MaxLength - Length) {
+		slen = MaxLength - Length;
+	}
+	Length += slen;
+	return(slen);
+}
+
 //---------------------------------------------------------------------------------------------------------
 // FilePipe
 //---------------------------------------------------------------------------------------------------------
@@ -53,6 +53,8 @@ class BufferPipe : public Pipe
 		BufferPipe(Buffer const & buffer) : BufferPtr(buffer), Index(0) {}
 		BufferPipe(void * buffer, int length) : BufferPtr(buffer, length), Index(0) {}
 		virtual int Put(void const * source, int slen);
+		virtual int Reserve(void * & buffer, int slen);
+		virtual int Commit(int slen);
 
 	private:
 		Buffer BufferPtr;
@@ -67,6 +69,35 @@ class BufferPipe : public Pipe
 };
 
 
+/*
+**	This is a store-into-memory pipe terminator that grows its buffer as needed. Use it when
+**	the amount of data that will flow through the pipe is not known in advance (such as when
+**	capturing a complete game state image). The buffer is retained across Reset() calls so
+**	that repeated captures don't thrash the heap.
+*/
+class DynamicBufferPipe : public Pipe
+{
+	public:
+		DynamicBufferPipe(void) : BufferPtr(NULL), Length(0), MaxLength(0) {}
+		virtual ~DynamicBufferPipe(void);
+		virtual int Put(void const * source, int slen);
+		virtual int Reserve(void * & buffer, int slen);
+		virtual int Commit(int slen);
+
+		void Reset(void) {Length = 0;}
+		void * Get_Buffer(void) const {return(BufferPtr);}
+		int Get_Length(void) const {return(Length);}
+
+	private:
+		char * BufferPtr;
+		int Length;
+		int MaxLength;
+
+		DynamicBufferPipe(DynamicBufferPipe & rvalue);
+		DynamicBufferPipe & operator = (DynamicBufferPipe const & pipe);
+};
+
+
 /*
 **	This is a store-to-file pipe terminator. Use it as the final link in a pipe process that
 **	needs to store the data to a file. This can only serve as the last link in the chain
@@ -33,7 +33,9 @@
  *                                                                                             *
  *---------------------------------------------------------------------------------------------*
  * Functions:                                                                                  *
+ *   BufferStraw::Consume -- Remove data that was looked at through Peek.                      *
  *   BufferStraw::Get -- Fetch data from the straw's buffer holding tank.                      *
+ *   BufferStraw::Peek -- Look at the data in the buffer holding tank without copying it.      *
  *   FileStraw::Get -- Fetch data from the file.                                               *
  *   FileStraw::~FileStraw -- The destructor for the file straw.                               *
  * - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
@@ -89,6 +91,69 @@ int BufferStraw::Get(void * source, int slen)
 }
 
 
+/***********************************************************************************************
+ * BufferStraw::Peek -- Look at the data in the buffer holding tank without copying it.        *
+ *                                                                                             *
+ *    The view returned is the buffer holding tank itself, so it remains good for as long as   *
+ *    the buffer does.                                                                         *
+ *                                                                                             *
+ * INPUT:   buffer   -- Reference to the pointer that will be set to the start of the data.    *
+ *                                                                                             *
+ *          slen     -- The number of bytes requested.                                         *
+ *                                                                                             *
+ * OUTPUT:  Returns with the number of bytes that may be looked at. If this is less than       *
+ *          requested, then it indicates that the data holding tank buffer is almost used up.  *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+int BufferStraw::Peek(void const * & buffer, int slen)
+{
+	buffer = NULL;
+	if (!Is_Valid() || slen < 1) return(0);
+
+	int len = slen;
+	if (BufferPtr.Get_Size() != 0) {
+		int theoretical_max = BufferPtr.Get_Size() - Index;
+		len = (slen < theoretical_max) ? slen : theoretical_max;
+	}
+
+	buffer = ((char const *)BufferPtr.Get_Buffer()) + Index;
+	return(len);
+}
+
+
+/***********************************************************************************************
+ * BufferStraw::Consume -- Remove data that was looked at through Peek.                        *
+ *                                                                                             *
+ *    This advances past the data just as if it had been fetched with Get.                     *
+ *                                                                                             *
+ * INPUT:   slen     -- The number of bytes to remove.                                         *
+ *                                                                                             *
+ * OUTPUT:  Returns with the number of bytes removed.                                          *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *   10/19/2026 AGT : Created.                                                                 *
+ *=============================================================================================*/
+int BufferStraw::Consume(int slen)
+{
+	if (!Is_Valid() || slen < 1) return(0);
+
+	int len = slen;
+	if (BufferPtr.Get_Size() != 0) {
+		int theoretical_max = BufferPtr.Get_Size() - Index;
+		len = (slen < theoretical_max) ? slen : theoretical_max;
+	}
+
+	Index += len;
+	return(len);
+}
+
+
 //---------------------------------------------------------------------------------------------------------
 // FileStraw
 //---------------------------------------------------------------------------------------------------------
@@ -54,6 +54,8 @@ class BufferStraw : public Straw
 		BufferStraw(Buffer const & buffer) : BufferPtr(buffer), Index(0) {}
 		BufferStraw(void const * buffer, int length) : BufferPtr((void*)buffer, length), Index(0) {}
 		virtual int Get(void * source, int slen);
+		virtual int Peek(void const * & buffer, int slen);
+		virtual int Consume(int slen);
 
 	private:
 		Buffer BufferPtr;
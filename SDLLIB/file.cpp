@@ -4,6 +4,7 @@
 #else
 #include <glob.h>
 #include <unistd.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/statvfs.h>
 #endif
@@ -67,6 +68,45 @@ size_t IO_Get_File_Size(void *handle)
     return length;
 }
 
+const void *IO_Map_File(void *handle, size_t offset, size_t length)
+{
+    // emscripten's mmap just reads the whole range into a heap copy, no better than the read path
+#if defined(_WIN32) || defined(__EMSCRIPTEN__)
+    return NULL;
+#else
+    if(!handle || !length)
+        return NULL;
+
+    auto file = (FILE *)handle;
+    int fd = fileno(file);
+
+    struct stat st;
+    if(fstat(fd, &st) != 0 || (size_t)st.st_size < offset + length)
+        return NULL;
+
+    // private so that callers can patch data in place like a cached copy
+    // mappings have to start on a page boundary
+    size_t skip = offset % sysconf(_SC_PAGESIZE);
+
+    void *base = mmap(NULL, length + skip, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, offset - skip);
+    if(base == MAP_FAILED)
+        return NULL;
+
+    return (const char *)base + skip;
+#endif
+}
+
+void IO_Unmap_File(const void *data, size_t offset, size_t length)
+{
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+    if(!data)
+        return;
+
+    size_t skip = offset % sysconf(_SC_PAGESIZE);
+    munmap((char *)data - skip, length + skip);
+#endif
+}
+
 bool IO_Delete_File(const char *filename)
 {
     return unlink(filename) == 0;
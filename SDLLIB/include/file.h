@@ -78,6 +78,12 @@ bool IO_Write_File(void *handle, const void *buffer, size_t count, size_t &actua
 size_t IO_Seek_File(void *handle, size_t offset, int origin);
 size_t IO_Get_File_Size(void *handle);
 
+// copy-on-write view of part of an open file, NULL if it can't be mapped
+// (always on Windows and emscripten, callers fall back to reading)
+// changes are never written back, the view stays valid after the file is closed
+const void *IO_Map_File(void *handle, size_t offset, size_t length);
+void IO_Unmap_File(const void *data, size_t offset, size_t length);
+
 bool IO_Delete_File(const char *filename);
 
 // file searching
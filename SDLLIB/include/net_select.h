@@ -14,4 +14,8 @@ void Socket_Unregister_Select(int socket);
 
 void Socket_Check_Write(int socket, bool check);
 
+// The callback reads until the socket would block, so the backend may
+// report readiness only when it changes (edge-triggered epoll on Linux).
+void Socket_Edge_Triggered(int socket, bool edge);
+
 void Socket_Select();
\ No newline at end of file
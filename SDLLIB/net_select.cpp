@@ -1,6 +1,5 @@
-#include <algorithm>
 #include <stdio.h>
-#include <forward_list>
+#include <unordered_map>
 
 #include "net_select.h"
 
@@ -10,19 +9,67 @@
 #include <sys/select.h>
 #endif
 
+#ifdef __linux__
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#define USE_EPOLL
+#endif
+
 struct SocketInfo
 {
     int socket;
     SocketCallback callback;
     void *data;
     bool check_write;
+    bool edge_triggered;
 };
 
-static std::forward_list<SocketInfo> Sockets;
+static std::unordered_map<int, SocketInfo> Sockets;
+
+#ifdef USE_EPOLL
+// -1 = not created yet, -2 = unavailable, use select
+static int EpollFD = -1;
+
+static const int max_epoll_events = 64;
+
+static bool Epoll_Available()
+{
+    if(EpollFD == -1)
+    {
+        EpollFD = epoll_create1(EPOLL_CLOEXEC);
+        if(EpollFD == -1)
+        {
+            printf("epoll_create1 failed, falling back to select\n");
+            EpollFD = -2;
+        }
+    }
+
+    return EpollFD >= 0;
+}
+
+static uint32_t Epoll_Events(const SocketInfo &info)
+{
+    uint32_t events = EPOLLIN;
+    if(info.check_write)
+        events |= EPOLLOUT;
+    if(info.edge_triggered)
+        events |= EPOLLET;
+    return events;
+}
+
+static bool Epoll_Update(const SocketInfo &info, int op)
+{
+    epoll_event ev = {};
+    ev.events = Epoll_Events(info);
+    ev.data.fd = info.socket;
+    return epoll_ctl(EpollFD, op, info.socket, &ev) == 0;
+}
+#endif
 
-static std::forward_list<SocketInfo>::iterator Find_Socket(int socket)
+static SocketInfo *Find_Socket(int socket)
 {
-    return std::find_if(Sockets.begin(), Sockets.end(), [socket](SocketInfo &s) {return s.socket == socket;});
+    auto it = Sockets.find(socket);
+    return it == Sockets.end() ? nullptr : &it->second;
 }
 
 bool Socket_Register_Select(int socket, SocketCallback callback, void *data)
@@ -30,35 +77,128 @@ bool Socket_Register_Select(int socket, SocketCallback callback, void *data)
     if(!callback)
         return false;
 
-    if(Find_Socket(socket) != Sockets.end())
+    if(Find_Socket(socket))
         return false;
 
-    // add to list
     SocketInfo info;
     info.socket = socket;
     info.callback = callback;
     info.data = data;
     info.check_write = false;
-    Sockets.push_front(info);
+    info.edge_triggered = false;
+
+#ifdef USE_EPOLL
+    if(Epoll_Available() && !Epoll_Update(info, EPOLL_CTL_ADD))
+        return false;
+#endif
+
+    Sockets.emplace(socket, info);
 
     return true;
 }
 
 void Socket_Unregister_Select(int socket)
 {
-    Sockets.remove_if([socket](SocketInfo &s){return s.socket == socket;});
+    if(!Sockets.erase(socket))
+        return;
+
+#ifdef USE_EPOLL
+    // may already be gone if the socket was closed first
+    if(EpollFD >= 0)
+        epoll_ctl(EpollFD, EPOLL_CTL_DEL, socket, nullptr);
+#endif
 }
 
 void Socket_Check_Write(int socket, bool check)
 {
-    auto it = Find_Socket(socket);
-    if(it != Sockets.end())
-        it->check_write = check;
+    auto info = Find_Socket(socket);
+    if(!info || info->check_write == check)
+        return;
+
+    info->check_write = check;
+
+#ifdef USE_EPOLL
+    // re-arming also reports the current state, so no edge is missed
+    if(EpollFD >= 0)
+        Epoll_Update(*info, EPOLL_CTL_MOD);
+#endif
+}
+
+void Socket_Edge_Triggered(int socket, bool edge)
+{
+    auto info = Find_Socket(socket);
+    if(!info || info->edge_triggered == edge)
+        return;
+
+    info->edge_triggered = edge;
+
+#ifdef USE_EPOLL
+    if(EpollFD >= 0)
+        Epoll_Update(*info, EPOLL_CTL_MOD);
+#endif
+}
+
+#ifdef USE_EPOLL
+// errors and hangups are reported on every wait until they are dealt with,
+// so a socket the owner doesn't close would keep the loop busy
+static void Epoll_Clear_Error(const SocketInfo &info, uint32_t events)
+{
+    if(events & EPOLLHUP)
+    {
+        // nothing more will arrive, stop watching until the owner unregisters it
+        epoll_ctl(EpollFD, EPOLL_CTL_DEL, info.socket, nullptr);
+        return;
+    }
+
+    // reading the pending error clears it (e.g. ICMP unreachable on UDP),
+    // then re-arm so edge-triggered sockets report the current state again
+    int error = 0;
+    socklen_t len = sizeof(error);
+    getsockopt(info.socket, SOL_SOCKET, SO_ERROR, &error, &len);
+    Epoll_Update(info, EPOLL_CTL_MOD);
+}
+
+static void Epoll_Select()
+{
+    epoll_event events[max_epoll_events];
+
+    int ready = epoll_wait(EpollFD, events, max_epoll_events, 0);
+
+    for(int i = 0; i < ready; i++)
+    {
+        int socket = events[i].data.fd;
+
+        // look up again each time, a callback may unregister any socket
+        auto info = Find_Socket(socket);
+        if(info && (events[i].events & EPOLLIN))
+            info->callback(socket, SOCKEV_READ, info->data);
+
+        info = Find_Socket(socket);
+        if(info && info->check_write && (events[i].events & EPOLLOUT))
+            info->callback(socket, SOCKEV_WRITE, info->data);
+
+        info = Find_Socket(socket);
+        if(info && (events[i].events & (EPOLLERR | EPOLLHUP)))
+        {
+            info->callback(socket, SOCKEV_ERROR, info->data);
+
+            info = Find_Socket(socket);
+            if(info)
+                Epoll_Clear_Error(*info, events[i].events);
+        }
+    }
 }
+#endif
 
 void Socket_Select()
 {
-    // something something poll something
+#ifdef USE_EPOLL
+    if(EpollFD >= 0)
+    {
+        Epoll_Select();
+        return;
+    }
+#endif
 
     fd_set read_set, write_set, err_set;
     int max_fd = -1;
@@ -66,8 +206,9 @@ void Socket_Select()
     FD_ZERO(&write_set);
     FD_ZERO(&err_set);
 
-    for(auto &sock : Sockets)
+    for(auto &it : Sockets)
     {
+        auto &sock = it.second;
         FD_SET(sock.socket, &read_set);
         if(sock.check_write)
             FD_SET(sock.socket, &write_set);
@@ -82,16 +223,32 @@ void Socket_Select()
 
     int ready = select(max_fd + 1, &read_set, &write_set, &err_set, &timeout);
 
-    if(ready)
+    if(ready > 0)
     {
-        for(auto &sock : Sockets)
+        // callbacks may unregister sockets, so work from a copy
+        int sockets[FD_SETSIZE];
+        int count = 0;
+        for(auto &it : Sockets)
+        {
+            if(count < FD_SETSIZE)
+                sockets[count++] = it.first;
+        }
+
+        for(int i = 0; i < count; i++)
         {
-            if(FD_ISSET(sock.socket, &read_set))
-                sock.callback(sock.socket, SOCKEV_READ, sock.data);
-            if(FD_ISSET(sock.socket, &write_set))
-                sock.callback(sock.socket, SOCKEV_WRITE, sock.data);
-            if(FD_ISSET(sock.socket, &err_set))
-                sock.callback(sock.socket, SOCKEV_ERROR, sock.data);
+            int socket = sockets[i];
+
+            auto sock = Find_Socket(socket);
+            if(sock && FD_ISSET(socket, &read_set))
+                sock->callback(socket, SOCKEV_READ, sock->data);
+
+            sock = Find_Socket(socket);
+            if(sock && FD_ISSET(socket, &write_set))
+                sock->callback(socket, SOCKEV_WRITE, sock->data);
+
+            sock = Find_Socket(socket);
+            if(sock && FD_ISSET(socket, &err_set))
+                sock->callback(socket, SOCKEV_ERROR, sock->data);
         }
     }
-}
\ No newline at end of file
+}
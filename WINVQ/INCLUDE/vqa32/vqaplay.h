@@ -261,6 +261,7 @@ typedef struct _VQAConfig {
 #define VQAOPTB_ALTAUDIO 6 /* Use alternate audio track. */
 #define VQAOPTB_CAPTIONS 7 /* Show captions. */
 #define VQAOPTB_EVA      8 /* Show EVA text (For C&C only) */
+#define VQAOPTB_PRELOAD  9 /* Load frames ahead on a separate thread. */
 #define	VQAOPTF_AUDIO    (1<<VQAOPTB_AUDIO)
 #define	VQAOPTF_STEP     (1<<VQAOPTB_STEP)
 #define	VQAOPTF_MONO     (1<<VQAOPTB_MONO)
@@ -270,6 +271,7 @@ typedef struct _VQAConfig {
 #define	VQAOPTF_ALTAUDIO (1<<VQAOPTB_ALTAUDIO)
 #define VQAOPTF_CAPTIONS (1<<VQAOPTB_CAPTIONS)
 #define VQAOPTF_EVA      (1<<VQAOPTB_EVA) /* For C&C only */
+#define VQAOPTF_PRELOAD  (1<<VQAOPTB_PRELOAD)
 
 
 /* VQAInfo: Information about the VQA movie.
@@ -297,6 +299,11 @@ typedef struct _VQAInfo {
  * MaxFrameSize  - Size of largest frame.
  * SamplesPlayed - Number of sample bytes played.
  * MemUsed       - Total bytes used. (Low memory)
+ * FramesQueued  - Frames loaded and waiting to be drawn.
+ * MinQueued     - Fewest frames waiting while the loader was still running.
+ *                 (-1 = not measured)
+ * LoaderWaits   - Number of times the loader waited for a free frame buffer.
+ * DrawerWaits   - Number of times the drawer found no frame ready to draw.
  */
 typedef struct _VQAStatistics {
 	long          StartTime;
@@ -307,6 +314,10 @@ typedef struct _VQAStatistics {
 	long          MaxFrameSize;
 	unsigned long SamplesPlayed;
 	unsigned long MemUsed;
+	long          FramesQueued;
+	long          MinQueued;
+	long          LoaderWaits;
+	long          DrawerWaits;
 } VQAStatistics;
 
 
@@ -491,6 +491,15 @@ void VQA_INIConfig(VQAConfig *config)
 		config->OptionFlags &= (~VQAOPTF_MONO);
 	}
 
+	/* Enable/Disable loading on a separate thread */
+	GetINIString("Player", "ReadAhead", "False", buf, 80, ininame);
+
+	if (!stricmp(buf, "True") || !stricmp(buf, "1")) {
+		config->OptionFlags |= VQAOPTF_PRELOAD;
+	} else {
+		config->OptionFlags &= (~VQAOPTF_PRELOAD);
+	}
+
 	/* Frame and codebook buffers */
 	config->NumFrameBufs = 6;
 	config->NumCBBufs = 3;
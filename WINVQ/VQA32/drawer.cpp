@@ -46,6 +46,7 @@
 * PRIVATE
 *     Select_Frame             - Selects frame to draw and preforms frame
 *                                skip.
+*     Pick_Frame               - Select_Frame with the frame lock held.
 *     Prepare_Frame            - Process/Decompress frame information.
 *     DrawFrame_Xmode          - Draws a frame directly to Xmode screen.
 *     DrawFrame_XmodeBuf       - Draws a frame in Xmode format to a buffer.
@@ -83,6 +84,7 @@
  * PRIVATE DECLARATIONS
  *-------------------------------------------------------------------------*/
 static long Select_Frame(VQAHandleP *vqap);
+static long Pick_Frame(VQAHandleP *vqap);
 static void Prepare_Frame(VQAData *vqabuf);
 
 #if(VQAMCGA_ON)
@@ -573,7 +575,9 @@ void VQA_Configure_Drawer(VQAHandleP *vqap)
 *
 * FUNCTION
 *     Select a frame to draw. This is were the frame skipping/delay is
-*     performed.
+*     performed. The frame flags are shared with the read-ahead task, so they
+*     are only looked at with the frame lock held; the lock is let go again
+*     before the frame is drawn.
 *
 * INPUTS
 *     VQA - Pointer to private VQAHandle.
@@ -584,12 +588,48 @@ void VQA_Configure_Drawer(VQAHandleP *vqap)
 ****************************************************************************/
 
 static long Select_Frame(VQAHandleP *vqap)
+{
+	long rc;
+
+	VQA_LockFrames(vqap);
+	rc = Pick_Frame(vqap);
+	VQA_UnlockFrames(vqap);
+
+	return (rc);
+}
+
+
+/****************************************************************************
+*
+* NAME
+*     Pick_Frame - Select_Frame with the frame lock held.
+*
+* SYNOPSIS
+*     Error = Pick_Frame(VQA)
+*
+*     long Pick_Frame(VQAHandleP *);
+*
+* FUNCTION
+*     Does the work of Select_Frame(). The lock is only let go while the
+*     user's callback is told of a skipped frame; the Loader does not touch
+*     a loaded frame, so the frame stays as it is meanwhile.
+*
+* INPUTS
+*     VQA - Pointer to private VQAHandle.
+*
+* RESULT
+*     Error - 0 if successful, or VQAERR_??? error code.
+*
+****************************************************************************/
+
+static long Pick_Frame(VQAHandleP *vqap)
 {
 	VQAData      *vqabuf;
 	VQADrawer    *drawer;
 	VQAConfig    *config;
 	VQAFrameNode *curframe;
 	long         desiredframe;
+	long         rc;
 	// MEG 11.29.95 - changed from long to unsigned long
 	unsigned long curtime;
 
@@ -703,7 +743,11 @@ static long Select_Frame(VQAHandleP *vqap)
 
 			/* Invoke callback with NULL screen ptr */
 			if (config->DrawerCallback != NULL) {
-				if ((config->DrawerCallback(NULL, curframe->FrameNum)) != 0) {
+				VQA_UnlockFrames(vqap);
+				rc = config->DrawerCallback(NULL, curframe->FrameNum);
+				VQA_LockFrames(vqap);
+
+				if (rc != 0) {
 					return (VQAERR_EOF);
 				}
 			}
@@ -737,7 +781,8 @@ static long Select_Frame(VQAHandleP *vqap)
 *
 * FUNCTION
 *     Decompress and preprocess the various frame elements (codebook,
-*     pointers, palette, etc...)
+*     pointers, palette, etc...) When the read-ahead task is running, the
+*     Loader has already done this, so the frame flags are only read here.
 *
 * INPUTS
 *     VQAData - Pointer to VQAData structure.
@@ -2207,7 +2252,9 @@ static long DrawFrame_Buffer(VQAHandle *vqa)
 	if ((curframe->Flags & VQAFRMF_PALETTE)
 			|| (drawer->Flags & VQADRWF_SETPAL)) {
 		Flag_To_Set_Palette(pal, palsize, slowpal);
+		VQA_LockFrames((VQAHandleP *)vqa);
 		curframe->Flags &= ~VQAFRMF_PALETTE;
+		VQA_UnlockFrames((VQAHandleP *)vqa);
 		drawer->Flags &= ~VQADRWF_SETPAL;
  	}
 
@@ -64,6 +64,8 @@
 *     Load_SND0     - Loads an uncompressed sound chunk
 *     Load_SND1     - Loads a compressed sound chunk
 *     Load_AudFrame - Loads blocks from separate audio file, if needed.
+*     Unpack_Codebook - Decompress a codebook as soon as it is loaded.
+*     Unpack_Frame  - Decompress a frame's palette and pointers.
 *
 ****************************************************************************/
 
@@ -99,6 +101,8 @@ static long Load_CPL0(VQAHandleP *vqap, unsigned long iffsize);
 static long Load_CPLZ(VQAHandleP *vqap, unsigned long iffsize);
 static long Load_VPT0(VQAHandleP *vqap, unsigned long iffsize);
 static long Load_VPTZ(VQAHandleP *vqap, unsigned long iffsize);
+static void Unpack_Codebook(VQAData *vqabuf, VQACBNode *codebook);
+static void Unpack_Frame(VQAData *vqabuf);
 
 #if(VQAAUDIO_ON)
 static long Load_SND0(VQAHandleP *vqap, unsigned long iffsize);
@@ -581,6 +585,11 @@ void VQA_Close(VQAHandle *vqa)
 {
 	long (*iohandler)(VQAHandle *, long, void *, long);
 
+	/* Stop the read-ahead task before anything it uses goes away. */
+	if (((VQAHandleP *)vqa)->VQABuf != NULL) {
+		VQA_FreeReadAhead((VQAHandleP *)vqa);
+	}
+
 	/* Restore video mode to text. */
 	#if(VQAVIDEO_ON)
 	SetVideoMode(TEXT_VIDEO);
@@ -722,9 +731,10 @@ long VQA_LoadFrame(VQAHandle *vqa)
 	}
 
 	/* If we're not sleeping, initialize */
-	if (!(vqabuf->Flags & VQADATF_LSLEEP)) {
+	if (!(loader->Flags & VQALDRF_SLEEP)) {
 		frame_loaded = 0;
 		loader->FrameSize = 0;
+		loader->FrameFlags = 0;
 
 		/* Initialize the codebook ptr for the frame we're about to load:
 		 * (This frame's codebook is the last full codebook; we have to init it
@@ -740,7 +750,7 @@ long VQA_LoadFrame(VQAHandle *vqa)
 	while (frame_loaded == 0) {
 
 		/* Read new chunk, only if we're not sleeping */
-		if (!(vqabuf->Flags & VQADATF_LSLEEP)) {
+		if (!(loader->Flags & VQALDRF_SLEEP)) {
 
 			/* Read chunk ID */
 			if (vqap->IOHandler(vqa, VQACMD_READ, chunk, 8)) {
@@ -770,7 +780,7 @@ long VQA_LoadFrame(VQAHandle *vqa)
 				}
 
 				/* Flag this frame as being key. */
-				curframe->Flags |= VQAFRMF_KEY;
+				loader->FrameFlags |= VQAFRMF_KEY;
 				frame_loaded = 1;
 				break;
 
@@ -817,7 +827,7 @@ long VQA_LoadFrame(VQAHandle *vqa)
 				}
 
 				/* Flag this frame as having a palette. */
-				curframe->Flags |= VQAFRMF_PALETTE;
+				loader->FrameFlags |= VQAFRMF_PALETTE;
 				break;
 
 			/* Compressed palette */
@@ -836,7 +846,7 @@ long VQA_LoadFrame(VQAHandle *vqa)
 				}
 
 				/* Flag this frame as having a palette. */
-				curframe->Flags |= VQAFRMF_PALETTE;
+				loader->FrameFlags |= VQAFRMF_PALETTE;
 				break;
 
 			/* Uncompressed pointer data */
@@ -865,7 +875,7 @@ long VQA_LoadFrame(VQAHandle *vqa)
 				}
 
 				/* Flag this frame as being key. */
-				curframe->Flags |= VQAFRMF_KEY;
+				loader->FrameFlags |= VQAFRMF_KEY;
 				frame_loaded = 1;
 				break;
 
@@ -881,10 +891,10 @@ long VQA_LoadFrame(VQAHandle *vqa)
 
 					/* Move the last audio frame to the play buffer. */
 					if (CopyAudio(vqap) == VQAERR_SLEEPING) {
-						vqabuf->Flags |= VQADATF_LSLEEP;
+						loader->Flags |= VQALDRF_SLEEP;
 						return (VQAERR_SLEEPING);
 					} else {
-						vqabuf->Flags &= (~VQADATF_LSLEEP);
+						loader->Flags &= (~VQALDRF_SLEEP);
 					}
 
 					/* Load an uncompressed audio frame. */
@@ -904,10 +914,10 @@ long VQA_LoadFrame(VQAHandle *vqa)
 
 					/* Move the last audio frame to the play buffer. */
 					if (CopyAudio(vqap) == VQAERR_SLEEPING) {
-						vqabuf->Flags |= VQADATF_LSLEEP;
+						loader->Flags |= VQALDRF_SLEEP;
 						return (VQAERR_SLEEPING);
 					} else {
-						vqabuf->Flags &= (~VQADATF_LSLEEP);
+						loader->Flags &= (~VQALDRF_SLEEP);
 					}
 
 					/* Load an uncompressed audio frame. */
@@ -933,10 +943,10 @@ long VQA_LoadFrame(VQAHandle *vqa)
 
 					/* Move the last audio frame to the play buffer. */
 					if (CopyAudio(vqap) == VQAERR_SLEEPING) {
-						vqabuf->Flags |= VQADATF_LSLEEP;
+						loader->Flags |= VQALDRF_SLEEP;
 						return (VQAERR_SLEEPING);
 					} else {
-						vqabuf->Flags &= (~VQADATF_LSLEEP);
+						loader->Flags &= (~VQALDRF_SLEEP);
 					}
 
 					/* Load a compressed audio frame. */
@@ -956,10 +966,10 @@ long VQA_LoadFrame(VQAHandle *vqa)
 
 					/* Move the last audio frame to the play buffer. */
 					if (CopyAudio(vqap) == VQAERR_SLEEPING) {
-						vqabuf->Flags |= VQADATF_LSLEEP;
+						loader->Flags |= VQALDRF_SLEEP;
 						return (VQAERR_SLEEPING);
 					} else {
-						vqabuf->Flags &= (~VQADATF_LSLEEP);
+						loader->Flags &= (~VQALDRF_SLEEP);
 					}
 
 					/* Load a compressed audio frame. */
@@ -985,10 +995,10 @@ long VQA_LoadFrame(VQAHandle *vqa)
 
 					/* Move the last audio frame to the play buffer. */
 					if (CopyAudio(vqap) == VQAERR_SLEEPING) {
-						vqabuf->Flags |= VQADATF_LSLEEP;
+						loader->Flags |= VQALDRF_SLEEP;
 						return (VQAERR_SLEEPING);
 					} else {
-						vqabuf->Flags &= (~VQADATF_LSLEEP);
+						loader->Flags &= (~VQALDRF_SLEEP);
 					}
 
 					/* Load a compressed audio frame. */
@@ -1008,10 +1018,10 @@ long VQA_LoadFrame(VQAHandle *vqa)
 
 					/* Move the last audio frame to the play buffer. */
 					if (CopyAudio(vqap) == VQAERR_SLEEPING) {
-						vqabuf->Flags |= VQADATF_LSLEEP;
+						loader->Flags |= VQALDRF_SLEEP;
 						return (VQAERR_SLEEPING);
 					} else {
-						vqabuf->Flags &= (~VQADATF_LSLEEP);
+						loader->Flags &= (~VQALDRF_SLEEP);
 					}
 
 					/* Load a compressed audio frame. */
@@ -1053,8 +1063,18 @@ long VQA_LoadFrame(VQAHandle *vqa)
 	/* Update data for mono output */
 	loader->LastFrameNum = loader->CurFrameNum;
 
-	/* Loader is finished with this frame; tell Drawer to draw it */
-	curframe->Flags |= VQAFRMF_LOADED;
+	/* Decompress the frame now if the Drawer is not going to. */
+	if (loader->Flags & VQALDRF_UNPACK) {
+		Unpack_Frame(vqabuf);
+	}
+
+	/* Loader is finished with this frame; tell Drawer to draw it. The flags
+	 * are only given to the frame now, since the Drawer may be looking at
+	 * them from another thread.
+	 */
+	VQA_LockFrames(vqap);
+	curframe->Flags = (loader->FrameFlags | VQAFRMF_LOADED);
+	VQA_UnlockFrames(vqap);
 	loader->CurFrame = curframe->Next;
 
 	return (0);
@@ -1345,6 +1365,7 @@ static VQAData *AllocBuffers(VQAHeader *header, VQAConfig *config)
 	memset(vqa, 0, sizeof(VQAData));
 	vqa->MemUsed = sizeof(VQAData);
 	vqa->Drawer.LastTime = (-VQA_TIMETICKS);
+	vqa->MinQueued = -1;
 
 	/* Set maximum codebook size. */
 	vqa->Max_CB_Size = ((header->CBentries) * header->BlockWidth
@@ -1930,7 +1951,7 @@ static long Load_VQF(VQAHandleP *vqap, unsigned long frame_iffsize)
 				}
 
 				/* Flag this frame as having a palette. */
-				curframe->Flags |= VQAFRMF_PALETTE;
+				vqabuf->Loader.FrameFlags |= VQAFRMF_PALETTE;
 				break;
 
 			/* Compressed palette */
@@ -1949,7 +1970,7 @@ static long Load_VQF(VQAHandleP *vqap, unsigned long frame_iffsize)
 				}
 
 				/* Flag this frame as having a palette. */
-				curframe->Flags |= VQAFRMF_PALETTE;
+				vqabuf->Loader.FrameFlags |= VQAFRMF_PALETTE;
 				break;
 
 			/* Uncompressed pointer data */
@@ -1974,7 +1995,7 @@ static long Load_VQF(VQAHandleP *vqap, unsigned long frame_iffsize)
 				}
 
 				/* Flag this frame as being key. */
-				curframe->Flags |= VQAFRMF_KEY;
+				vqabuf->Loader.FrameFlags |= VQAFRMF_KEY;
 				break;
 
 			/* An unknown chunk in the video frame is an error. */
@@ -2180,6 +2201,11 @@ static long Load_CBFZ(VQAHandleP *vqap, unsigned long iffsize)
 	loader->FullCB->Flags &= (~VQACBF_DOWNLOADED);
 	loader->CurCB = curcb->Next;
 
+	/* Decompress it now if the Drawer is not going to. */
+	if (loader->Flags & VQALDRF_UNPACK) {
+		Unpack_Codebook(vqap->VQABuf, curcb);
+	}
+
 	return (0);
 }
 
@@ -2333,6 +2359,11 @@ static long Load_CBPZ(VQAHandleP *vqap, unsigned long iffsize)
 		loader->FullCB = curcb;
 		loader->FullCB->Flags &= (~VQACBF_DOWNLOADED);
 		loader->CurCB = curcb->Next;
+
+		/* Decompress it now if the Drawer is not going to. */
+		if (loader->Flags & VQALDRF_UNPACK) {
+			Unpack_Codebook(vqabuf, curcb);
+		}
 	}
 
 	return (0);
@@ -2375,7 +2406,7 @@ static long Load_CPL0(VQAHandleP *vqap, unsigned long iffsize)
 	}
 
 	/* Flag the palette as uncompressed. */
-	curframe->Flags &= ~VQAFRMF_PALCOMP;
+	vqap->VQABuf->Loader.FrameFlags &= ~VQAFRMF_PALCOMP;
 	curframe->PalOffset = 0;
 	curframe->PaletteSize = iffsize;
 
@@ -2424,7 +2455,7 @@ static long Load_CPLZ(VQAHandleP *vqap, unsigned long iffsize)
 	}
 
 	/* Flag this palette as compressed. */
-	curframe->Flags |= VQAFRMF_PALCOMP;
+	vqap->VQABuf->Loader.FrameFlags |= VQAFRMF_PALCOMP;
 	curframe->PalOffset = lcwoffset;
 	curframe->PaletteSize = iffsize;
 
@@ -2468,7 +2499,7 @@ static long Load_VPT0(VQAHandleP *vqap, unsigned long iffsize)
 	}
 
 	/* Flag this frame as uncompressed */
-	curframe->Flags &= ~VQAFRMF_PTRCOMP;
+	vqap->VQABuf->Loader.FrameFlags &= ~VQAFRMF_PTRCOMP;
 	curframe->PtrOffset = 0;
 
 	return (0);
@@ -2516,7 +2547,7 @@ static long Load_VPTZ(VQAHandleP *vqap, unsigned long iffsize)
 	}
 
 	/* Flag this frame as compressed. */
-	curframe->Flags |= VQAFRMF_PTRCOMP;
+	vqap->VQABuf->Loader.FrameFlags |= VQAFRMF_PTRCOMP;
 	curframe->PtrOffset = lcwoffset;
 
 	return (0);
@@ -2959,3 +2990,86 @@ static void Load_AudFrame(VQAHandleP *vqap)
 #endif /* VQAVOC_ON */
 #endif /* VQAAUDIO_ON */
 
+
+/****************************************************************************
+*
+* NAME
+*     Unpack_Codebook - Decompress a codebook as soon as it is loaded.
+*
+* SYNOPSIS
+*     Unpack_Codebook(VQAData, Codebook)
+*
+*     void Unpack_Codebook(VQAData *, VQACBNode *);
+*
+* FUNCTION
+*     This does the work of the Drawer's Prepare_Frame() ahead of time, when
+*     the Loader runs on the read-ahead thread. It must be done before any
+*     frame that uses the codebook is handed to the Drawer.
+*
+* INPUTS
+*     VQAData  - Pointer to VQAData structure.
+*     Codebook - Pointer to the codebook node that was just filled.
+*
+* RESULT
+*     NONE
+*
+****************************************************************************/
+
+static void Unpack_Codebook(VQAData *vqabuf, VQACBNode *codebook)
+{
+	if (codebook->Flags & VQACBF_CBCOMP) {
+		LCW_Uncompress((char *)codebook->Buffer + codebook->CBOffset,
+				(char *)codebook->Buffer, vqabuf->Max_CB_Size);
+
+		codebook->Flags &= (~VQACBF_CBCOMP);
+	}
+}
+
+
+/****************************************************************************
+*
+* NAME
+*     Unpack_Frame - Decompress a frame's palette and pointers.
+*
+* SYNOPSIS
+*     Unpack_Frame(VQAData)
+*
+*     void Unpack_Frame(VQAData *);
+*
+* FUNCTION
+*     Decompress the palette and vector pointers of the frame being loaded,
+*     so the Drawer has nothing left to do but draw it.
+*
+* INPUTS
+*     VQAData - Pointer to VQAData structure.
+*
+* RESULT
+*     NONE
+*
+****************************************************************************/
+
+static void Unpack_Frame(VQAData *vqabuf)
+{
+	VQALoader    *loader;
+	VQAFrameNode *curframe;
+
+	/* Dereference commonly used data members for quicker access. */
+	loader = &vqabuf->Loader;
+	curframe = loader->CurFrame;
+
+	/* Decompress the palette, if needed */
+	if (loader->FrameFlags & VQAFRMF_PALCOMP) {
+		curframe->PaletteSize = LCW_Uncompress((char *)curframe->Palette +
+				curframe->PalOffset,(char *)curframe->Palette,vqabuf->Max_Pal_Size);
+
+		loader->FrameFlags &= ~VQAFRMF_PALCOMP;
+	}
+
+	/* Decompress the pointer data, if needed */
+	if (loader->FrameFlags & VQAFRMF_PTRCOMP) {
+		LCW_Uncompress((char *)curframe->Pointers + curframe->PtrOffset,
+				(char *)curframe->Pointers, vqabuf->Max_Ptr_Size);
+
+		loader->FrameFlags &= ~VQAFRMF_PTRCOMP;
+	}
+}
@@ -50,11 +50,18 @@
 *     VQA_GetStats - Get VQA movie statistics.
 *     VQA_Version  - Get VQA library version number.
 *     VQA_IDString - Get the VQA player library's ID string.
+*     VQA_FreeReadAhead - Stop the read-ahead task and free it.
+*     VQA_LockFrames    - Take the frame buffer lock.
+*     VQA_UnlockFrames  - Release the frame buffer lock.
 *
 * PRIVATE
 *     VQA_IO_Task        - Loader task for multitasking.
 *     VQA_Rendering_Task - Drawer task for multitasking.
 *     User_Update        - Page flip routine called by the task interrupt.
+*     StartReadAhead     - Start the read-ahead task loading frames.
+*     HoldReadAhead      - Stop the read-ahead task between frames.
+*     WaitReadAhead      - Wait for the read-ahead task to load a frame.
+*     QueuedFrames       - Count the frames waiting to be drawn.
 *
 ****************************************************************************/
 
@@ -65,6 +72,11 @@
 #include <vqm32/all.h>
 #include "vqaplayp.h"
 #include <vqm32/font.h>
+#include <new>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
 
 #ifdef _WIN32
 #include <windows.h>
@@ -86,6 +98,34 @@ extern int __cdecl Get_Key(void);
 }
 #endif
 
+/* VQAReadAhead: The read-ahead task. The Loader runs on a thread of its own
+ *               and fills the circular list of frame buffers ahead of the
+ *               display clock, while the Drawer takes frames from the other
+ *               end. Disk reads and decompression no longer hold up drawing.
+ *
+ * Thread     - Thread running VQA_IO_Task().
+ * Lock       - Guards the frame buffer flags and the members below.
+ * Changed    - Signalled whenever a frame is loaded or freed.
+ * IsHeld     - The task must not start loading another frame.
+ * IsBusy     - The task is loading a frame.
+ * IsDone     - The Loader has reached the end of the movie (or failed).
+ * IsQuitting - The task must exit.
+ */
+typedef struct _VQAReadAhead {
+	std::thread             Thread;
+	std::mutex              Lock;
+	std::condition_variable Changed;
+	bool                    IsHeld;
+	bool                    IsBusy;
+	bool                    IsDone;
+	bool                    IsQuitting;
+} VQAReadAhead;
+
+static long StartReadAhead(VQAHandleP *vqap);
+static void HoldReadAhead(VQAHandleP *vqap);
+static void WaitReadAhead(VQAData *vqabuf);
+static long QueuedFrames(VQAData *vqabuf);
+
 
 /****************************************************************************
 *
@@ -208,10 +248,12 @@ void VQA_Reset(VQAHandle *vqa)
 	vqabuf = ((VQAHandleP *)vqa)->VQABuf;
 
 	vqabuf->Flags = 0;
+	vqabuf->Loader.Flags &= ~VQALDRF_SLEEP;
 	vqabuf->LoadedFrames = 0;
 	vqabuf->DrawnFrames = 0;
 	vqabuf->StartTime = 0;
 	vqabuf->EndTime = 0;
+	vqabuf->MinQueued = -1;
 }
 
 int	VQAMovieDone;
@@ -249,6 +291,7 @@ long VQA_Play(VQAHandle *vqa, long mode)
 	long      rc;
 	long      i;
 	long      key;
+	long      readahead = 0;
 
 #ifdef WIN32
 	unsigned char *pal;
@@ -351,13 +394,28 @@ long VQA_Play(VQAHandle *vqa, long mode)
 				VQA_SetTimer((VQAHandleP *)vqa, vqabuf->EndTime, config->TimerMethod);
 			}
 
+			/* Hand the loading over to the read-ahead task, if wanted. */
+			if ((config->OptionFlags & VQAOPTF_PRELOAD)
+					&& !(vqabuf->Flags & VQADATF_LDONE)) {
+				readahead = (StartReadAhead((VQAHandleP *)vqa) == 0);
+			}
+
 			/* Load, Draw, Load, Draw, Load, Draw ... */
 			while ((vqabuf->Flags & (VQADATF_DDONE|VQADATF_LDONE))
 					!= (VQADATF_DDONE|VQADATF_LDONE)) {
 
-				/* Load a frame */
+				/* Load a frame (or see if the read-ahead task has loaded them all) */
 				if (!(vqabuf->Flags & VQADATF_LDONE)) {
-					if ((rc = VQA_LoadFrame(vqa)) == 0) {
+					if (readahead) {
+						VQA_LockFrames((VQAHandleP *)vqa);
+
+						if (vqabuf->ReadAhead->IsDone) {
+							vqabuf->Flags |= VQADATF_LDONE;
+						}
+
+						VQA_UnlockFrames((VQAHandleP *)vqa);
+					}
+					else if ((rc = VQA_LoadFrame(vqa)) == 0) {
 						vqabuf->LoadedFrames++;
 					}
 					else {
@@ -371,7 +429,10 @@ long VQA_Play(VQAHandle *vqa, long mode)
 				}
 
 
-				/* Draw a frame */
+				/* Draw a frame. The Drawer and flipper only take the frame lock
+				 * while they look at the frame flags, so the read-ahead task goes
+				 * on loading while the frame is drawn and shown.
+				 */
 				if ((config->DrawFlags & VQACFGF_NODRAW) == 0) {
 					if ((rc = (*(vqabuf->Draw_Frame))(vqa)) == 0) {
 						vqabuf->DrawnFrames++;
@@ -393,6 +454,17 @@ long VQA_Play(VQAHandle *vqa, long mode)
 						if (User_Update(vqa)) {
 							vqabuf->Flags |= (VQADATF_DDONE|VQADATF_LDONE);
 						}
+
+						/* Note how far ahead the read-ahead task is. */
+						if (readahead && !(vqabuf->Flags & VQADATF_LDONE)) {
+							VQA_LockFrames((VQAHandleP *)vqa);
+							i = QueuedFrames(vqabuf);
+							VQA_UnlockFrames((VQAHandleP *)vqa);
+
+							if ((vqabuf->MinQueued < 0) || (i < vqabuf->MinQueued)) {
+								vqabuf->MinQueued = i;
+							}
+						}
 						#ifdef WIN32never
 						/*
 						** Set the palette if neccessary
@@ -410,6 +482,11 @@ long VQA_Play(VQAHandle *vqa, long mode)
 							vqabuf->Flags |= VQADATF_DDONE;
 						}
 
+						/* Rather than spin, wait for the read-ahead task to catch up. */
+						if (readahead && (rc == VQAERR_NOBUFFER)) {
+							WaitReadAhead(vqabuf);
+						}
+
 #ifdef PORTABLE
 						if(rc == VQAERR_NOT_TIME && config->EventHandler) {
 							//zzz
@@ -419,7 +496,9 @@ long VQA_Play(VQAHandle *vqa, long mode)
 					}
 				} else {
 					vqabuf->Flags |= VQADATF_DDONE;
+					VQA_LockFrames((VQAHandleP *)vqa);
 					drawer->CurFrame->Flags = 0L;
+					VQA_UnlockFrames((VQAHandleP *)vqa);
 					drawer->CurFrame = drawer->CurFrame->Next;
 				}
 
@@ -458,6 +537,9 @@ long VQA_Play(VQAHandle *vqa, long mode)
 			break;
 	}
 
+	/* The Loader must be idle once we return to the caller. */
+	HoldReadAhead((VQAHandleP *)vqa);
+
 	/* If the movie is finished or we are requested to stop then shutdown. */
 	if (((vqabuf->Flags & (VQADATF_DDONE|VQADATF_LDONE))
 			== (VQADATF_DDONE|VQADATF_LDONE)) || (mode == VQAMODE_STOP)) {
@@ -602,6 +684,13 @@ void VQA_GetStats(VQAHandle *vqa, VQAStatistics *stats)
 	stats->FramesDrawn = vqabuf->DrawnFrames;
 	stats->FramesSkipped = vqabuf->Drawer.NumSkipped;
 	stats->MaxFrameSize = vqabuf->Loader.MaxFrameSize;
+	stats->MinQueued = vqabuf->MinQueued;
+	stats->LoaderWaits = vqabuf->Loader.WaitsOnDrawer;
+	stats->DrawerWaits = vqabuf->Drawer.WaitsOnLoader;
+
+	VQA_LockFrames((VQAHandleP *)vqa);
+	stats->FramesQueued = QueuedFrames(vqabuf);
+	VQA_UnlockFrames((VQAHandleP *)vqa);
 
 	#if(VQAAUDIO_ON)
 	stats->SamplesPlayed = vqabuf->Audio.SamplesPlayed;
@@ -702,13 +791,373 @@ long User_Update(VQAHandle *vqa)
 		vqabuf->Flipper.LastFrameNum = vqabuf->Flipper.CurFrame->FrameNum;
 
 		/* Mark the frame as loadable */
+		VQA_LockFrames((VQAHandleP *)vqa);
 		vqabuf->Flipper.CurFrame->Flags = 0L;
+		VQA_UnlockFrames((VQAHandleP *)vqa);
 		vqabuf->Flags &= (~VQADATF_UPDATE);
 	}
 
 	return (rc);
 }
 
+/****************************************************************************
+*
+* NAME
+*     VQA_IO_Task - Loader task for multitasking.
+*
+* SYNOPSIS
+*     VQA_IO_Task(VQA)
+*
+*     void VQA_IO_Task(VQAHandleP *);
+*
+* FUNCTION
+*     Body of the read-ahead thread. Frames are loaded into the circular list
+*     of frame buffers whenever there is a free one, until the end of the
+*     movie. The task sleeps while it is held, while all the buffers are full,
+*     or while the Loader waits for the audio to play out some of its buffer.
+*
+* INPUTS
+*     VQA - Pointer to private VQAHandle.
+*
+* RESULT
+*     NONE
+*
+****************************************************************************/
+
+static void VQA_IO_Task(VQAHandleP *vqap)
+{
+	VQAData      *vqabuf;
+	VQAReadAhead *task;
+	long         rc;
+
+	/* Dereference commonly used data members for quicker access. */
+	vqabuf = vqap->VQABuf;
+	task = vqabuf->ReadAhead;
+
+	std::unique_lock<std::mutex> lock(task->Lock);
+
+	while (!task->IsQuitting) {
+
+		/* Sleep while held, or after the end of the movie. */
+		if (task->IsHeld || task->IsDone) {
+			task->Changed.wait(lock);
+			continue;
+		}
+
+		/* Sleep until the Drawer frees the next buffer. */
+		if (vqabuf->Loader.CurFrame->Flags & VQAFRMF_LOADED) {
+			vqabuf->Loader.WaitsOnDrawer++;
+
+			while (!task->IsQuitting && !task->IsHeld
+					&& (vqabuf->Loader.CurFrame->Flags & VQAFRMF_LOADED)) {
+				task->Changed.wait(lock);
+			}
+			continue;
+		}
+
+		/* Load the frame; the lock is only taken again to hand it over. */
+		task->IsBusy = true;
+		lock.unlock();
+		rc = VQA_LoadFrame((VQAHandle *)vqap);
+		lock.lock();
+		task->IsBusy = false;
+
+		if (rc == 0) {
+			vqabuf->LoadedFrames++;
+		} else if (rc == VQAERR_SLEEPING) {
+			task->Changed.wait_for(lock, std::chrono::milliseconds(1000 / VQA_TIMETICKS));
+		} else if (rc != VQAERR_NOBUFFER) {
+			task->IsDone = true;
+		}
+
+		task->Changed.notify_all();
+	}
+}
+
+
+/****************************************************************************
+*
+* NAME
+*     StartReadAhead - Start the read-ahead task loading frames.
+*
+* SYNOPSIS
+*     Error = StartReadAhead(VQA)
+*
+*     long StartReadAhead(VQAHandleP *);
+*
+* FUNCTION
+*     The task is created the first time through, and from then on is only
+*     held and released. From the time the task is created, the Loader
+*     decompresses everything it loads, so the Drawer has less to do.
+*
+* INPUTS
+*     VQA - Pointer to private VQAHandle.
+*
+* RESULT
+*     Error - 0 if successful, or VQAERR_??? error code.
+*
+****************************************************************************/
+
+static long StartReadAhead(VQAHandleP *vqap)
+{
+	VQAData      *vqabuf;
+	VQAReadAhead *task;
+
+	/* Dereference commonly used data members for quicker access. */
+	vqabuf = vqap->VQABuf;
+	task = vqabuf->ReadAhead;
+
+	/* Create the task, held until it is set up. */
+	if (task == NULL) {
+		if ((task = new(std::nothrow) VQAReadAhead) == NULL) {
+			return (VQAERR_NOMEM);
+		}
+
+		task->IsHeld = true;
+		task->IsBusy = false;
+		task->IsDone = false;
+		task->IsQuitting = false;
+
+		vqabuf->ReadAhead = task;
+		vqabuf->Loader.Flags |= VQALDRF_UNPACK;
+		task->Thread = std::thread(VQA_IO_Task, vqap);
+	}
+
+	/* Let it run. */
+	{
+		std::lock_guard<std::mutex> lock(task->Lock);
+		task->IsHeld = false;
+		task->IsDone = false;
+	}
+
+	task->Changed.notify_all();
+
+	return (0);
+}
+
+
+/****************************************************************************
+*
+* NAME
+*     HoldReadAhead - Stop the read-ahead task between frames.
+*
+* SYNOPSIS
+*     HoldReadAhead(VQA)
+*
+*     void HoldReadAhead(VQAHandleP *);
+*
+* FUNCTION
+*     Stop the task from loading any more frames, and wait for it to finish
+*     the frame it is loading, if any. After this the Loader's data and the
+*     movie file may be used from this thread until the task is started again.
+*
+* INPUTS
+*     VQA - Pointer to private VQAHandle.
+*
+* RESULT
+*     NONE
+*
+****************************************************************************/
+
+static void HoldReadAhead(VQAHandleP *vqap)
+{
+	VQAReadAhead *task;
+
+	task = vqap->VQABuf->ReadAhead;
+
+	if (task != NULL) {
+		std::unique_lock<std::mutex> lock(task->Lock);
+		task->IsHeld = true;
+		task->Changed.notify_all();
+
+		while (task->IsBusy) {
+			task->Changed.wait(lock);
+		}
+	}
+}
+
+
+/****************************************************************************
+*
+* NAME
+*     WaitReadAhead - Wait for the read-ahead task to load a frame.
+*
+* SYNOPSIS
+*     WaitReadAhead(VQAData)
+*
+*     void WaitReadAhead(VQAData *);
+*
+* FUNCTION
+*     Called when the Drawer finds no frame ready to draw. Rather than spin,
+*     sleep until the next frame is loaded or for at most one clock tick.
+*
+* INPUTS
+*     VQAData - Pointer to VQAData structure.
+*
+* RESULT
+*     NONE
+*
+****************************************************************************/
+
+static void WaitReadAhead(VQAData *vqabuf)
+{
+	VQAReadAhead *task;
+
+	task = vqabuf->ReadAhead;
+
+	std::unique_lock<std::mutex> lock(task->Lock);
+
+	if (!task->IsDone && !(vqabuf->Drawer.CurFrame->Flags & VQAFRMF_LOADED)) {
+		task->Changed.wait_for(lock, std::chrono::milliseconds(1000 / VQA_TIMETICKS));
+	}
+}
+
+
+/****************************************************************************
+*
+* NAME
+*     QueuedFrames - Count the frames waiting to be drawn.
+*
+* SYNOPSIS
+*     Frames = QueuedFrames(VQAData)
+*
+*     long QueuedFrames(VQAData *);
+*
+* FUNCTION
+*     Count the loaded frame buffers. The frame buffer lock must be held.
+*
+* INPUTS
+*     VQAData - Pointer to VQAData structure.
+*
+* RESULT
+*     Frames - Number of frame buffers that are loaded.
+*
+****************************************************************************/
+
+static long QueuedFrames(VQAData *vqabuf)
+{
+	VQAFrameNode *frame;
+	long         count = 0;
+
+	frame = vqabuf->FrameData;
+
+	do {
+		if (frame->Flags & VQAFRMF_LOADED) {
+			count++;
+		}
+
+		frame = frame->Next;
+	} while (frame != vqabuf->FrameData);
+
+	return (count);
+}
+
+
+/****************************************************************************
+*
+* NAME
+*     VQA_FreeReadAhead - Stop the read-ahead task and free it.
+*
+* SYNOPSIS
+*     VQA_FreeReadAhead(VQA)
+*
+*     void VQA_FreeReadAhead(VQAHandleP *);
+*
+* FUNCTION
+*     Must be called before the buffers the task loads into are freed.
+*
+* INPUTS
+*     VQA - Pointer to private VQAHandle.
+*
+* RESULT
+*     NONE
+*
+****************************************************************************/
+
+void VQA_FreeReadAhead(VQAHandleP *vqap)
+{
+	VQAReadAhead *task;
+
+	task = vqap->VQABuf->ReadAhead;
+
+	if (task != NULL) {
+		{
+			std::lock_guard<std::mutex> lock(task->Lock);
+			task->IsQuitting = true;
+		}
+
+		task->Changed.notify_all();
+		task->Thread.join();
+		delete task;
+
+		vqap->VQABuf->ReadAhead = NULL;
+		vqap->VQABuf->Loader.Flags &= ~VQALDRF_UNPACK;
+	}
+}
+
+
+/****************************************************************************
+*
+* NAME
+*     VQA_LockFrames - Take the frame buffer lock.
+*
+* SYNOPSIS
+*     VQA_LockFrames(VQA)
+*
+*     void VQA_LockFrames(VQAHandleP *);
+*
+* FUNCTION
+*     The flags of the frame buffers are shared with the read-ahead task, so
+*     they may only be changed (or tested, by the Drawer) while this lock is
+*     held. Does nothing if there is no read-ahead task.
+*
+* INPUTS
+*     VQA - Pointer to private VQAHandle.
+*
+* RESULT
+*     NONE
+*
+****************************************************************************/
+
+void VQA_LockFrames(VQAHandleP *vqap)
+{
+	if (vqap->VQABuf->ReadAhead != NULL) {
+		vqap->VQABuf->ReadAhead->Lock.lock();
+	}
+}
+
+
+/****************************************************************************
+*
+* NAME
+*     VQA_UnlockFrames - Release the frame buffer lock.
+*
+* SYNOPSIS
+*     VQA_UnlockFrames(VQA)
+*
+*     void VQA_UnlockFrames(VQAHandleP *);
+*
+* FUNCTION
+*     Whoever is waiting on the other side is woken up, since a frame may
+*     have been loaded or freed while the lock was held.
+*
+* INPUTS
+*     VQA - Pointer to private VQAHandle.
+*
+* RESULT
+*     NONE
+*
+****************************************************************************/
+
+void VQA_UnlockFrames(VQAHandleP *vqap)
+{
+	if (vqap->VQABuf->ReadAhead != NULL) {
+		vqap->VQABuf->ReadAhead->Lock.unlock();
+		vqap->VQABuf->ReadAhead->Changed.notify_all();
+	}
+}
+
+
 void VQA_Dummy(void)
 {
 	Set_Font(NULL);
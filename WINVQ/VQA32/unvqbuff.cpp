@@ -1,13 +1,89 @@
 #include <stdint.h>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define UNVQ_SSE2 1
+#endif
+
 #include "vqa32/unvq.h"
 
+// Draw a single 4x2 block
+static inline void Draw_4x2(unsigned char *codebook, int v, int cb,
+    unsigned char *dst_ptr, unsigned long bufwidth)
+{
+    if(cb == 0xF) // Is it a one color block?
+    {
+        // Draw 1-color block
+        uint32_t col32 = v | v << 8 | v << 16 | v << 24; // Duplicate colour
+        *(uint32_t *)dst_ptr = col32; // Write 1st row to dest
+        *(uint32_t *)(dst_ptr + bufwidth) = col32; // Write 2st row to dest
+    }
+    else
+    {
+        // Draw multi-color block
+        int index = (cb << 8 | v) * 8;
+        auto row1 = *(uint32_t *)(codebook + index); // Read 1st row of codeword
+        auto row2 = *(uint32_t *)(codebook + index + 4); // Read 2nd row of codeword
+        *(uint32_t *)dst_ptr = row1; // Write 1st row to dest
+        *(uint32_t *)(dst_ptr + bufwidth) = row2; // Write 2st row to dest
+    }
+}
+
+// Draw a single 4x4 block
+static inline void Draw_4x4(unsigned char *codebook, int v, int cb,
+    unsigned char *dst_ptr, unsigned long bufwidth)
+{
+    if(cb == 0xFF) // Is it a one color block?
+    {
+        // Draw 1-color block
+        uint32_t col32 = v | v << 8 | v << 16 | v << 24; // Duplicate colour
+        *(uint32_t *)dst_ptr = col32; // Write 1st row to dest
+        *(uint32_t *)(dst_ptr + bufwidth) = col32; // Write 2nd row to dest
+        *(uint32_t *)(dst_ptr + bufwidth * 2) = col32; // Write 3rd row to dest
+        *(uint32_t *)(dst_ptr + bufwidth * 3) = col32; // Write 4th row to dest
+    }
+    else
+    {
+        // Draw multi-color block
+        int index = (cb << 8 | v) * 16;
+        auto row1 = *(uint32_t *)(codebook + index); // Read 1st row of codeword
+        auto row2 = *(uint32_t *)(codebook + index + 4); // Read 2nd row of codeword
+        auto row3 = *(uint32_t *)(codebook + index + 8); // Read 3rd row of codeword
+        auto row4 = *(uint32_t *)(codebook + index + 12); // Read 4th row of codeword
+
+        *(uint32_t *)dst_ptr = row1; // Write 1st row to dest
+        *(uint32_t *)(dst_ptr + bufwidth) = row2; // Write 2nd row to dest
+        *(uint32_t *)(dst_ptr + bufwidth * 2) = row3; // Write 3rt row to dest
+        *(uint32_t *)(dst_ptr + bufwidth * 3) = row4; // Write 4th row to dest
+    }
+}
+
+#ifdef UNVQ_SSE2
+// Fetch the codeword of a 4x2 block into the low 8 bytes of a vector
+static inline __m128i Fetch_4x2(unsigned char *codebook, int v, int cb)
+{
+    if(cb == 0xF) // One color block, fill both rows with the colour
+        return _mm_set1_epi8((char)v);
+
+    return _mm_loadl_epi64((__m128i const *)(codebook + (cb << 8 | v) * 8));
+}
+
+// Fetch the codeword of a 4x4 block, one row in each 32 bit lane
+static inline __m128i Fetch_4x4(unsigned char *codebook, int v, int cb)
+{
+    if(cb == 0xFF) // One color block, fill all four rows with the colour
+        return _mm_set1_epi8((char)v);
+
+    return _mm_loadu_si128((__m128i const *)(codebook + (cb << 8 | v) * 16));
+}
+#endif
+
 void UnVQ_4x2(unsigned char *codebook, unsigned char *pointers,
     unsigned char *buffer, unsigned long blocksperrow,
     unsigned long numrows, unsigned long bufwidth)
 {
     // Compute the offset to the next row of blocks
-    auto rowoffset = bufwidth * 2; 
+    auto rowoffset = bufwidth * 2;
 
     // Compute the end address of the pointer data
     auto entries = numrows * blocksperrow;
@@ -20,33 +96,35 @@ void UnVQ_4x2(unsigned char *codebook, unsigned char *pointers,
     // Drawing loop
     do
     {
-        int count = blocksperrow; // Number of blocks in a line
-        do
-        {
-            int v = *src_ptr;
-            int cb = src_ptr[entries]; // Get the codebook pointer value
-            src_ptr++;
+        long count = blocksperrow; // Number of blocks in a line
 
-            if(cb == 0xF) // Is it a one color block?
-            {
-                // Draw 1-color block
-                uint32_t col32 = v | v << 8 | v << 16 | v << 24; // Duplicate colour
-                *(uint32_t *)dst_ptr = col32; // Write 1st row to dest
-                *(uint32_t *)(dst_ptr + bufwidth) = col32; // Write 2st row to dest
-            }
-            else
-            {
-                // Draw multi-color block
-                int index = (cb << 8 | v) * 8;
-                auto row1 = *(uint32_t *)(codebook + index); // Read 1st row of codeword
-                auto row2 = *(uint32_t *)(codebook + index + 4); // Read 2nd row of codeword
-                *(uint32_t *)dst_ptr = row1; // Write 1st row to dest
-                *(uint32_t *)(dst_ptr + bufwidth) = row2; // Write 2st row to dest
-            }
+#ifdef UNVQ_SSE2
+        // Draw four blocks at a time. Their codewords are interleaved so that each
+        // row of all four blocks goes to the destination in a single 16 byte write.
+        for(; count >= 4; count -= 4)
+        {
+            __m128i b0 = Fetch_4x2(codebook, src_ptr[0], src_ptr[entries + 0]);
+            __m128i b1 = Fetch_4x2(codebook, src_ptr[1], src_ptr[entries + 1]);
+            __m128i b2 = Fetch_4x2(codebook, src_ptr[2], src_ptr[entries + 2]);
+            __m128i b3 = Fetch_4x2(codebook, src_ptr[3], src_ptr[entries + 3]);
+            src_ptr += 4;
+
+            __m128i b01 = _mm_unpacklo_epi32(b0, b1);
+            __m128i b23 = _mm_unpacklo_epi32(b2, b3);
+            _mm_storeu_si128((__m128i *)dst_ptr, _mm_unpacklo_epi64(b01, b23)); // Write 1st row to dest
+            _mm_storeu_si128((__m128i *)(dst_ptr + bufwidth), _mm_unpackhi_epi64(b01, b23)); // Write 2nd row to dest
+
+            dst_ptr += 16;
+        }
+#endif
 
+        // Draw the rest of the line one block at a time
+        for(; count > 0; count--)
+        {
+            Draw_4x2(codebook, src_ptr[0], src_ptr[entries], dst_ptr, bufwidth);
+            src_ptr++;
             dst_ptr += 4;
         }
-        while(--count);
 
         dst_ptr = dst_ptr_start + rowoffset;
         dst_ptr_start = dst_ptr;
@@ -72,43 +150,42 @@ void UnVQ_4x4(unsigned char *codebook, unsigned char *pointers,
     // Drawing loop
     do
     {
-        int count = blocksperrow; // Number of blocks in a line
-        do
-        {
-            int v = *src_ptr;
-            int cb = src_ptr[entries]; // Get the codebook pointer value
-            src_ptr++;
+        long count = blocksperrow; // Number of blocks in a line
 
-            if(cb == 0xFF) // Is it a one color block?
-            {
-                // Draw 1-color block
-                uint32_t col32 = v | v << 8 | v << 16 | v << 24; // Duplicate colour
-                *(uint32_t *)dst_ptr = col32; // Write 1st row to dest
-                *(uint32_t *)(dst_ptr + bufwidth) = col32; // Write 2nd row to dest
-                *(uint32_t *)(dst_ptr + bufwidth * 2) = col32; // Write 3rd row to dest
-                *(uint32_t *)(dst_ptr + bufwidth * 3) = col32; // Write 4th row to dest
-            }
-            else
-            {
-                // Draw multi-color block
-                int index = (cb << 8 | v) * 16;
-                auto row1 = *(uint32_t *)(codebook + index); // Read 1st row of codeword
-                auto row2 = *(uint32_t *)(codebook + index + 4); // Read 2nd row of codeword
-                auto row3 = *(uint32_t *)(codebook + index + 8); // Read 3rd row of codeword
-                auto row4 = *(uint32_t *)(codebook + index + 12); // Read 4th row of codeword
-
-                *(uint32_t *)dst_ptr = row1; // Write 1st row to dest
-                *(uint32_t *)(dst_ptr + bufwidth) = row2; // Write 2nd row to dest
-                *(uint32_t *)(dst_ptr + bufwidth * 2) = row3; // Write 3rt row to dest
-                *(uint32_t *)(dst_ptr + bufwidth * 3) = row4; // Write 4th row to dest
-            }
+#ifdef UNVQ_SSE2
+        // Draw four blocks at a time. The 4x4 group of codeword rows is transposed so
+        // that each row of all four blocks goes to the destination in a single write.
+        for(; count >= 4; count -= 4)
+        {
+            __m128i b0 = Fetch_4x4(codebook, src_ptr[0], src_ptr[entries + 0]);
+            __m128i b1 = Fetch_4x4(codebook, src_ptr[1], src_ptr[entries + 1]);
+            __m128i b2 = Fetch_4x4(codebook, src_ptr[2], src_ptr[entries + 2]);
+            __m128i b3 = Fetch_4x4(codebook, src_ptr[3], src_ptr[entries + 3]);
+            src_ptr += 4;
+
+            __m128i lo01 = _mm_unpacklo_epi32(b0, b1);
+            __m128i lo23 = _mm_unpacklo_epi32(b2, b3);
+            __m128i hi01 = _mm_unpackhi_epi32(b0, b1);
+            __m128i hi23 = _mm_unpackhi_epi32(b2, b3);
+            _mm_storeu_si128((__m128i *)dst_ptr, _mm_unpacklo_epi64(lo01, lo23)); // Write 1st row to dest
+            _mm_storeu_si128((__m128i *)(dst_ptr + bufwidth), _mm_unpackhi_epi64(lo01, lo23)); // Write 2nd row to dest
+            _mm_storeu_si128((__m128i *)(dst_ptr + bufwidth * 2), _mm_unpacklo_epi64(hi01, hi23)); // Write 3rd row to dest
+            _mm_storeu_si128((__m128i *)(dst_ptr + bufwidth * 3), _mm_unpackhi_epi64(hi01, hi23)); // Write 4th row to dest
+
+            dst_ptr += 16;
+        }
+#endif
 
+        // Draw the rest of the line one block at a time
+        for(; count > 0; count--)
+        {
+            Draw_4x4(codebook, src_ptr[0], src_ptr[entries], dst_ptr, bufwidth);
+            src_ptr++;
             dst_ptr += 4;
         }
-        while(--count);
 
         dst_ptr = dst_ptr_start + rowoffset;
         dst_ptr_start = dst_ptr;
     }
     while(src_ptr < data_end);
-}
\ No newline at end of file
+}
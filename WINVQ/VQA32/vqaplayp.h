@@ -203,6 +203,9 @@ typedef struct _VQAFrameNode {
  * FrameSize     - Size of the last frame in bytes.
  * MaxFrameSize  - Size of the largest frame in the animation.
  * CurChunkHdr   - Chunk header of the chunk currently being processed.
+ * Flags         - Loader state flags. (See below)
+ * FrameFlags    - Flags for the frame being loaded; they are given to the
+ *                 frame when it is handed to the Drawer.
  */
 typedef struct _VQALoader {
 	VQACBNode    *CurCB;
@@ -218,8 +221,16 @@ typedef struct _VQALoader {
 	long         FrameSize;
 	long         MaxFrameSize;
 	ChunkHeader  CurChunkHdr;
+	unsigned long Flags;
+	unsigned long FrameFlags;
 } VQALoader;
 
+/* Loader flags */
+#define VQALDRB_SLEEP  0 /* Loader sleep state. */
+#define VQALDRB_UNPACK 1 /* Decompress data as it is loaded. */
+#define VQALDRF_SLEEP  (1<<VQALDRB_SLEEP)
+#define VQALDRF_UNPACK (1<<VQALDRB_UNPACK)
+
 
 /* VQADrawer: Data needed exclusively by the Drawer.
  *            (Make sure this structure's size is always DWORD aligned.)
@@ -436,6 +447,8 @@ typedef struct _VQAAudio {
  * StartTime    - Start time in VQA time ticks
  * EndTime      - Stop time in VQA time ticks
  * MemUsed      - Number of bytes allocated by VQA_AllocBuffers
+ * ReadAhead    - Read-ahead task that runs the Loader (NULL = none)
+ * MinQueued    - Fewest loaded frames waiting to be drawn (-1 = none yet)
  */
 typedef struct _VQAData {
 	long (*Draw_Frame)(VQAHandle *vqa);
@@ -472,19 +485,19 @@ typedef struct _VQAData {
 	long          StartTime;
 	long          EndTime;
 	long          MemUsed;
+	struct _VQAReadAhead *ReadAhead;
+	long          MinQueued;
 } VQAData;
 
 /* VQAData flags */
 #define VQADATB_UPDATE 0 /* Update the display. */
 #define VQADATB_DSLEEP 1 /* Drawer sleep state. */
-#define VQADATB_LSLEEP 2 /* Loader sleep state. */
 #define VQADATB_DDONE  3 /* Drawer done flag. (0 = done) */
 #define VQADATB_LDONE  4 /* Loader done flag. (0 = done) */
 #define VQADATB_PRIMED 5 /* Buffers are primed. */
 #define VQADATB_PAUSED 6 /* The player is paused. */
 #define VQADATF_UPDATE (1<<VQADATB_UPDATE)
 #define VQADATF_DSLEEP (1<<VQADATB_DSLEEP)
-#define VQADATF_LSLEEP (1<<VQADATB_LSLEEP)
 #define VQADATF_DDONE  (1<<VQADATB_DDONE)
 #define VQADATF_LDONE  (1<<VQADATB_LDONE)
 #define VQADATF_PRIMED (1<<VQADATB_PRIMED)
@@ -521,6 +534,9 @@ typedef struct _VQAHandleP {
 
 /* Loader/Drawer system. */
 long VQA_LoadFrame(VQAHandle *vqa);
+void VQA_FreeReadAhead(VQAHandleP *vqap);
+void VQA_LockFrames(VQAHandleP *vqap);
+void VQA_UnlockFrames(VQAHandleP *vqap);
 void VQA_Configure_Drawer(VQAHandleP *vqap);
 long User_Update(VQAHandle *vqa);
 